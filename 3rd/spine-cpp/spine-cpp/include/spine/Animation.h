@@ -47,6 +47,22 @@ namespace spine {
 
 	class AnimationState;
 
+	class BakedAnimation;
+
+	class SkeletonData;
+
+	class Animation;
+
+	/// Decodes the timelines of animations created with Animation(const String &, AnimationLoader *).
+	class SP_API AnimationLoader : public SpineObject {
+	public:
+		virtual ~AnimationLoader() {
+		}
+
+		/// @return False if the timelines could not be decoded, the animation is then left without any.
+		virtual bool load(Animation &animation, Vector<Timeline *> &timelines) = 0;
+	};
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -99,8 +115,20 @@ namespace spine {
 	public:
 		Animation(const String &name, Vector<Timeline *> &timelines, float duration);
 
+		/// Creates an animation whose timelines are decoded by the loader the first time they, or the duration, are
+		/// needed. The loader must outlive the animation.
+		Animation(const String &name, AnimationLoader *loader);
+
 		~Animation();
 
+		/// False only for an animation with a loader whose timelines have not been decoded yet or were unloaded.
+		bool isLoaded();
+
+		/// Frees the timelines of an animation with a loader, they are decoded again the next time they are needed. The
+		/// baked data is kept, it refers to the timelines by index and they decode in the same order. Must not be called
+		/// while the animation is being applied.
+		void unload();
+
 		/// Applies all the animation's timelines to the specified skeleton.
 		/// See also Timeline::apply(Skeleton&, float, float, Vector, float, MixPose, MixDirection)
 		void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
@@ -120,11 +148,38 @@ namespace spine {
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
+		/// Like search(values, target, step), but first tries the frame stored in cursor by the previous call and its
+		/// neighbours, falling back to a binary search after seeks or loops. Sampling a timeline at a time that advances a
+		/// little each frame is O(1).
+		/// @param cursor Frame index hint, updated with the result. May be NULL.
+		static int search(Vector<float> &values, float target, int step, int *cursor);
+
+		/// Resamples the bone timelines at the specified rate, replacing any previous baked data. AnimationState then plays
+		/// them back from the samples when this animation is the only one applied to a bone, see BakedAnimation. Must not
+		/// be called while the animation is being applied.
+		/// @param fps Samples per second.
+		/// @param quantize Stores the samples in 16 bits instead of 32.
+		BakedAnimation *bake(SkeletonData &skeletonData, float fps, bool quantize = false);
+
+		/// @return May be NULL.
+		BakedAnimation *getBaked();
+
+		/// Discards the baked data, the timelines are used again.
+		void clearBaked();
+
 	private:
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+		BakedAnimation *_baked;
+		AnimationLoader *_loader;
+		bool _loaded;
+
+		void setTimelines();
+
+		void load();
 	};
 }
 
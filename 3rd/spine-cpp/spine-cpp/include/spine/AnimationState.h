@@ -307,6 +307,8 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		/// Frame index hints for Animation::search, one per timeline.
+		Vector<int> _timelineCursors;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
@@ -515,6 +517,9 @@ namespace spine {
 		void computeHold(TrackEntry *entry);
 
 		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
+
+		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, unsigned int hash,
+						   bool attachments);
 	};
 }
 
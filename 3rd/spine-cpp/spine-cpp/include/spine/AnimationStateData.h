@@ -79,6 +79,9 @@ namespace spine {
 			explicit AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL);
 
 			bool operator==(const AnimationPair &other) const;
+
+			/// Hashes the animation names, as operator== compares them.
+			size_t hash() const;
 		};
 
 		SkeletonData *_skeletonData;
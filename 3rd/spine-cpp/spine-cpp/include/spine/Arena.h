@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_Arena_h
+#define Spine_Arena_h
+
+#include <stddef.h>
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Bump allocator for data that lives and dies together, such as a SkeletonData and everything read into it.
+	///
+	/// While an arena is current on a thread, see ArenaScope, every allocation made through SpineExtension and
+	/// SpineObject on that thread is cut from blocks of the arena instead of being allocated one by one. The blocks
+	/// are released together when the arena is destroyed.
+	///
+	/// Arena memory belongs to the object holding the arena. It can only be freed or reallocated on a thread where
+	/// that arena is current: freeing then hands the most recent allocation back and does nothing otherwise, and
+	/// reallocating grows it in place or moves it within the arena. Everywhere else frees and reallocations go
+	/// straight to the SpineExtension instance without looking at the pointer, so memory of an arena must not reach
+	/// them. The holder makes its arena current around code that changes what lives in it, and calls retire() in its
+	/// destructor.
+	class SP_API Arena : public SpineObject {
+	public:
+		/// @param blockSize Size of the blocks the allocations are cut from. Allocations larger than a quarter of it
+		/// get a block of their own, so every block but the last is at least three quarters used.
+		explicit Arena(size_t blockSize = 16 * 1024);
+
+		~Arena();
+
+		/// @param zero Clears the memory, as SpineExtension::calloc does.
+		void *alloc(size_t size, bool zero);
+
+		/// Grows or shrinks ptr in place if it is the most recent allocation and still fits in its block.
+		/// @return False if ptr has to be moved.
+		bool resize(void *ptr, size_t size);
+
+		/// Resizes ptr in place if possible, otherwise moves it to a new allocation of this arena.
+		/// @param ptr Memory of this arena.
+		void *realloc(void *ptr, size_t size);
+
+		/// Hands ptr back if it is the most recent allocation, otherwise its memory stays in use until the arena is
+		/// destroyed.
+		void free(void *ptr);
+
+		/// Whether ptr points into one of the blocks of this arena.
+		bool owns(const void *ptr) const;
+
+		/// Makes the arena current on this thread for the rest of its life. Called first in the destructor of the
+		/// object holding it, whose members are destroyed after the destructor body and before the arena, so that
+		/// their frees of arena memory do nothing. Does nothing if the arena is empty.
+		void retire();
+
+		/// Bytes handed out, including the alignment padding.
+		size_t getUsed() const { return _used; }
+
+		/// Bytes held in blocks, including their headers.
+		size_t getCapacity() const { return _capacity; }
+
+		size_t getBlockCount() const { return _blockCount; }
+
+		/// The arena allocations go to on this thread, or NULL if they go to the SpineExtension instance.
+		static Arena *getCurrent();
+
+	private:
+		struct Block {
+			Block *next;
+			size_t size;
+			size_t used;
+		};
+
+		Block *newBlock(size_t size);
+
+		Block *findBlock(const void *ptr) const;
+
+		size_t _blockSize;
+		Block *_block;
+		Block *_blocks;
+		Block **_sorted; // The blocks by address, in _inline until there are more.
+		Block *_inline[4];
+		size_t _sortedCapacity;
+		char *_last;
+		size_t _used;
+		size_t _capacity;
+		size_t _blockCount;
+		bool _retired;
+		Arena *_previous;
+	};
+
+	/// Makes an arena current on this thread until the scope ends, then restores the previous one. A NULL arena
+	/// sends allocations to the SpineExtension instance, for memory that has to outlive the current arena.
+	class SP_API ArenaScope {
+	public:
+		explicit ArenaScope(Arena *arena);
+
+		~ArenaScope();
+
+	private:
+		Arena *_previous;
+	};
+}
+
+#endif /* Spine_Arena_h */
@@ -96,6 +96,9 @@ namespace spine {
 
 	class SP_API AtlasRegion : public TextureRegion {
 	public:
+		AtlasRegion() : page(NULL), index(-1), x(0), y(0) {
+		}
+
 		AtlasPage *page;
 		String name;
 		int index;
@@ -127,12 +130,23 @@ namespace spine {
 
 		Vector<AtlasRegion *> &getRegions();
 
+		/// Writes the pages and regions in the binary atlas format. The constructors detect binary data and load it
+		/// without parsing text. UVs are stored as computed, including any flipV().
+		void writeBinary(Vector<unsigned char> &output);
+
+		/// Returns true if the data starts with the binary atlas header.
+		static bool isBinary(const char *data, int length);
+
 	private:
 		Vector<AtlasPage *> _pages;
 		Vector<AtlasRegion *> _regions;
 		TextureLoader *_textureLoader;
 
 		void load(const char *begin, int length, const char *dir, bool createTexture);
+
+		void loadBinary(const char *begin, int length, const char *dir, bool createTexture);
+
+		void loadPage(AtlasPage *page, const char *dir, bool createTexture);
 	};
 }
 
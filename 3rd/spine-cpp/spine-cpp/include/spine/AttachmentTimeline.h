@@ -64,8 +64,12 @@ namespace spine {
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, const String &attachmentName);
 
+		/// Names must be changed through setFrame so the hashes stay in sync.
 		Vector<String> &getAttachmentNames();
 
+		/// NameIndex::hashName of each attachment name, used to look up the attachments without hashing every apply.
+		Vector<unsigned int> &getAttachmentHashes();
+
 		int getSlotIndex() { return _slotIndex; }
 
 		void setSlotIndex(int inValue) { _slotIndex = inValue; }
@@ -75,7 +79,11 @@ namespace spine {
 
 		Vector<String> _attachmentNames;
 
+		Vector<unsigned int> _attachmentHashes;
+
 		void setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName);
+
+		void setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName, unsigned int hash);
 	};
 }
 
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class SkeletonData;
+
+	class Skeleton;
+
+	/// An animation's bone timelines resampled at a fixed rate into packed per bone local transform tracks. Playing it
+	/// back lerps two samples per keyed bone property instead of evaluating the timelines and their curves.
+	///
+	/// Only the rotate, translate, scale and shear timelines are baked. Timelines for other properties, like attachments,
+	/// deform, draw order, events, colors and constraints are not and are still applied exactly. Stepped keys are
+	/// smoothed over one sample interval.
+	class SP_API BakedAnimation : public SpineObject {
+	public:
+		/// Samples the bone timelines of the animation.
+		/// @param fps Samples per second.
+		/// @param quantize Stores each sample in 16 bits, scaled to the range of its track, instead of as a float.
+		BakedAnimation(SkeletonData &skeletonData, Animation &animation, float fps, bool quantize);
+
+		~BakedAnimation();
+
+		/// Sets the bone properties keyed by the animation to their value at the specified time, in seconds. Like applying
+		/// the baked timelines with alpha 1 and MixBlend_Setup.
+		void apply(Skeleton &skeleton, float time);
+
+		/// Whether the timeline at the specified index in Animation::getTimelines() is covered by this baked animation.
+		bool isBaked(size_t timelineIndex);
+
+		float getFps();
+
+		bool isQuantized();
+
+		size_t getFrameCount();
+
+		/// The number of baked bone properties.
+		size_t getTrackCount();
+
+		/// The memory used by the samples, in bytes.
+		size_t getSampleSize();
+
+	private:
+		float _fps;
+		float _duration;
+		size_t _frameCount;
+		Vector<bool> _baked;
+		Vector<int> _bones;
+		Vector<int> _properties;
+		Vector<float> _samples;
+		Vector<unsigned short> _quantized;
+		Vector<float> _offsets;
+		Vector<float> _scales;
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
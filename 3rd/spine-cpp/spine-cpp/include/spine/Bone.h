@@ -40,11 +40,31 @@ namespace spine {
 
 	class Skeleton;
 
+	/// A bone's local transform, or its applied transform. Stored contiguously per Skeleton and indexed by bone index.
+	struct SP_API BoneLocal {
+		float x, y, rotation, scaleX, scaleY, shearX, shearY;
+		Inherit inherit;
+
+		BoneLocal() : x(0), y(0), rotation(0), scaleX(0), scaleY(0), shearX(0), shearY(0), inherit(Inherit_Normal) {
+		}
+	};
+
+	/// A bone's world transform. Stored contiguously per Skeleton and indexed by bone index.
+	struct SP_API BoneWorld {
+		float a, b, worldX;
+		float c, d, worldY;
+
+		BoneWorld() : a(1), b(0), worldX(0), c(0), d(1), worldY(0) {
+		}
+	};
+
 /// Stores a bone's current pose.
 ///
 /// A bone has a local transform which is used to compute its world transform. A bone also has an applied transform, which is a
 /// local transform that can be applied to compute the world transform. The local transform and applied transform may differ if a
 /// constraint or application code modifies the world transform after it was computed from the local transform.
+///
+/// The transforms are not stored in the bone itself, the bone is a view onto its Skeleton's pose arrays.
 	class SP_API Bone : public Updatable {
 		friend class AnimationState;
 
@@ -118,6 +138,11 @@ namespace spine {
 		void
 		updateWorldTransform(float x, float y, float rotation, float scaleX, float scaleY, float shearX, float shearY);
 
+		/// Computes a world transform from an applied transform and the parent's world transform.
+		/// @param parent NULL for the root bone, which uses the skeleton position and scale instead.
+		static void computeWorldTransform(const BoneLocal &applied, Inherit inherit, const BoneWorld *parent,
+										  Skeleton &skeleton, BoneWorld &world);
+
         /// Computes the individual applied transform values from the world transform. This can be useful to perform processing using
 		/// the applied transform after the world transform has been modified directly (eg, by a constraint)..
 		///
@@ -262,9 +287,9 @@ namespace spine {
 
 		void setActive(bool inValue);
 
-        Inherit getInherit() { return _inherit; }
+        Inherit getInherit() { return _local.inherit; }
 
-        void setInherit(Inherit inValue) { _inherit = inValue; }
+        void setInherit(Inherit inValue) { _local.inherit = inValue; }
 
 	private:
 		static bool yDown;
@@ -273,13 +298,11 @@ namespace spine {
 		Skeleton &_skeleton;
 		Bone *_parent;
 		Vector<Bone *> _children;
-		float _x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY;
-		float _ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY;
-		float _a, _b, _worldX;
-		float _c, _d, _worldY;
+		BoneLocal &_local;
+		BoneLocal &_applied;
+		BoneWorld &_world;
 		bool _sorted;
 		bool _active;
-        Inherit _inherit;
 	};
 }
 
@@ -33,6 +33,13 @@
 #include <spine/Timeline.h>
 #include <spine/Vector.h>
 
+/// Number of uniform time buckets per bezier curve. Each bucket stores the first segment of the curve's BEZIER_SIZE
+/// segment table it overlaps, so evaluating a curve starts next to the right segment instead of scanning from the first
+/// one. Costs one byte per bucket per curve, define as 0 to disable for memory constrained builds.
+#ifndef SPINE_BEZIER_LUT_SIZE
+#define SPINE_BEZIER_LUT_SIZE 16
+#endif
+
 namespace spine {
 	/// Base class for frames that use an interpolation bezier curve.
 	class SP_API CurveTimeline : public Timeline {
@@ -53,6 +60,18 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
+		/// Stores each bezier as its 4 control values, evaluated when the timeline is applied, instead of BEZIER_SIZE
+		/// precomputed segment points. Uses less than a quarter of the memory per bezier but costs a few iterations to
+		/// solve the curve's time on every evaluation. Must be set before the first setBezier call.
+		void setCompact(bool inValue);
+
+		bool isCompact();
+
+		/// Releases the bezier storage past the specified number of beziers, for loaders that size it for the worst case.
+		void shrink(size_t bezierCount);
+
+		/// The frame types followed by the bezier data, BEZIER_SIZE segment points or, when compact, the 4 control values
+		/// cx1, cy1, cx2, cy2 per bezier.
 		Vector<float> &getCurves();
 
 	protected:
@@ -60,8 +79,23 @@ namespace spine {
 		static const int STEPPED = 1;
 		static const int BEZIER = 2;
 		static const int BEZIER_SIZE = 18;
+		static const int COMPACT_BEZIER_SIZE = 4;
+		static const int BEZIER_LUT_SIZE = SPINE_BEZIER_LUT_SIZE;
 
 		Vector<float> _curves; // type, x, y, ...
+		int _bezierSize; // Stride of the bezier data in _curves, BEZIER_SIZE or COMPACT_BEZIER_SIZE.
+		Vector<unsigned char> _bezierLut; // first segment per time bucket, BEZIER_LUT_SIZE per bezier
+
+		/// Fills the time buckets of the bezier starting at _curves[i], which runs from time1 to time2.
+		void setBezierLut(size_t i, float time1, float time2);
+
+		/// Returns the index of the first segment point in _curves at or after time, the same one a linear scan of the
+		/// bezier starting at _curves[i] finds: i when time is before the first point, i + BEZIER_SIZE when it is after
+		/// the last one.
+		size_t searchBezier(float time, size_t i, float time1, float time2);
+
+		/// Evaluates the compact bezier starting at _curves[i], between the keys (time1, value1) and (time2, value2).
+		float getCompactBezierValue(float time, size_t i, float time1, float value1, float time2, float value2);
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -74,15 +108,17 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value);
 
-		float getCurveValue(float time);
+		/// @param cursor Frame index hint, see Animation::search. May be NULL.
+		float getCurveValue(float time, int *cursor = NULL);
 
-        float getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup);
+        float getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup, int *cursor = NULL);
 
-        float getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup);
+        float getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup, int *cursor = NULL);
 
         float getAbsoluteValue (float time, float alpha, MixBlend blend, float current, float setup, float value);
 
-        float getScaleValue (float time, float alpha, MixBlend blend, MixDirection direction, float current, float setup);
+        float getScaleValue (float time, float alpha, MixBlend blend, MixDirection direction, float current, float setup,
+                             int *cursor = NULL);
 
 	protected:
 		static const int ENTRIES = 2;
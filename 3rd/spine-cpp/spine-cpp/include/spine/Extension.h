@@ -43,22 +43,22 @@ namespace spine {
 	public:
 		template<typename T>
 		static T *alloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_alloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, false, file, line);
 		}
 
 		template<typename T>
 		static T *calloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_calloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, true, file, line);
 		}
 
 		template<typename T>
 		static T *realloc(T *ptr, size_t num, const char *file, int line) {
-			return (T *) getInstance()->_realloc(ptr, sizeof(T) * num, file, line);
+			return (T *) reallocate((void *) ptr, sizeof(T) * num, file, line);
 		}
 
 		template<typename T>
 		static void free(T *ptr, const char *file, int line) {
-			getInstance()->_free((void *) ptr, file, line);
+			release((void *) ptr, file, line);
 		}
 
 		template<typename T>
@@ -66,6 +66,17 @@ namespace spine {
 			getInstance()->_beforeFree((void *) ptr);
 		}
 
+		/// Allocates from the Arena current on this thread, see ArenaScope, or else from the instance.
+		static void *allocate(size_t size, bool zero, const char *file, int line);
+
+		/// Reallocates memory of the current arena within the arena, see Arena::realloc, and anything else with the
+		/// instance. Memory of an arena that isn't current must not be passed here.
+		static void *reallocate(void *ptr, size_t size, const char *file, int line);
+
+		/// Frees memory of the instance. Memory of the current arena stays with it, see Arena::free. Memory of an
+		/// arena that isn't current must not be passed here.
+		static void release(void *ptr, const char *file, int line);
+
 		static char *readFile(const String &path, int *length) {
 			return getInstance()->_readFile(path, length);
 		}
@@ -42,11 +42,49 @@
 #endif
 
 namespace spine {
+	/// Spreads the bits of an integer key over the whole hash (MurmurHash3 finalizer), so the low bits used as the slot
+	/// index depend on all of them.
+	inline size_t hashMapMix(unsigned long long hash) {
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53ULL;
+		hash ^= hash >> 33;
+		return (size_t) hash;
+	}
+
+	/// Hash of a HashMap key. Integers and pointers are hashed directly, other keys provide a hash() method consistent
+	/// with their operator==.
+	template<typename K>
+	struct HashMapHash {
+		static size_t hash(const K &key) { return key.hash(); }
+	};
+
+	template<>
+	struct HashMapHash<int> {
+		static size_t hash(int key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<long long> {
+		static size_t hash(long long key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<typename T>
+	struct HashMapHash<T *> {
+		static size_t hash(T *key) { return hashMapMix((unsigned long long) (size_t) key); }
+	};
+
+	/// Open addressing hash table with linear probing. Small maps live in the inline slots, larger ones in a single
+	/// array that doubles when it is three quarters full. clear() keeps the slots, so a map that is cleared and refilled
+	/// does not allocate again.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
 	private:
 		class Entry;
 
+		static const size_t InlineCapacity = 8;
+
 	public:
 		class SP_API Pair {
 		public:
@@ -60,47 +98,59 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Entry *entries, size_t capacity) : _entries(entries), _capacity(capacity), _index(0),
+																 _hasChecked(false) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				Entry &entry = _entries[_index++];
+				Pair pair(entry._key, entry._value);
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				while (_index < _capacity && !_entries[_index]._used) _index++;
+				return _index < _capacity;
 			}
 
 		private:
+			Entry *_entries;
+			size_t _capacity;
+			size_t _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
 		};
 
 		HashMap() :
-				_head(NULL),
+				_entries(_inline),
+				_mask(InlineCapacity - 1),
+				_size(0) {
+		}
+
+		HashMap(const HashMap &other) :
+				_entries(_inline),
+				_mask(InlineCapacity - 1),
 				_size(0) {
+			putAll(other);
+		}
+
+		HashMap &operator=(const HashMap &other) {
+			if (this != &other) {
+				clear();
+				putAll(other);
+			}
+			return *this;
 		}
 
 		~HashMap() {
-			clear();
+			releaseEntries();
 		}
 
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
-			}
-			_head = NULL;
+			for (size_t i = 0; i <= _mask; i++)
+				_entries[i]._used = false;
 			_size = 0;
 		}
 
@@ -109,26 +159,17 @@ namespace spine {
 		}
 
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
+			size_t hash = HashMapHash<K>::hash(key);
+			Entry *entry = find(key, hash);
+			if (!entry) {
+				if ((_size + 1) * 4 > (_mask + 1) * 3) grow();
+				entry = emptySlot(hash);
+				entry->_hash = hash;
+				entry->_used = true;
 				_size++;
 			}
+			entry->_key = key;
+			entry->_value = value;
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
@@ -140,28 +181,31 @@ namespace spine {
 		}
 
 		bool containsKey(const K &key) {
-			return find(key) != NULL;
+			return find(key, HashMapHash<K>::hash(key)) != NULL;
 		}
 
 		bool remove(const K &key) {
-			Entry *entry = find(key);
+			Entry *entry = find(key, HashMapHash<K>::hash(key));
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			// Backward shift: later entries of the probe run move into the hole unless that would put them before
+			// their home slot, so lookups never need tombstones.
+			size_t hole = entry - _entries;
+			for (size_t next = (hole + 1) & _mask; _entries[next]._used; next = (next + 1) & _mask) {
+				size_t home = _entries[next]._hash & _mask;
+				if (((next - home) & _mask) >= ((next - hole) & _mask)) {
+					_entries[hole] = _entries[next];
+					hole = next;
+				}
+			}
+			_entries[hole]._used = false;
 			_size--;
 
 			return true;
 		}
 
 		V operator[](const K &key) {
-			Entry *entry = find(key);
+			Entry *entry = find(key, HashMapHash<K>::hash(key));
 			if (entry) return entry->_value;
 			else {
 				assert(false);
@@ -170,30 +214,76 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(_entries, _mask + 1);
 		}
 
 	private:
-		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+		Entry *find(const K &key, size_t hash) {
+			for (size_t slot = hash & _mask; _entries[slot]._used; slot = (slot + 1) & _mask) {
+				Entry &entry = _entries[slot];
+				if (entry._hash == hash && entry._key == key) return &entry;
 			}
 			return NULL;
 		}
 
-		class SP_API Entry : public SpineObject {
+		Entry *emptySlot(size_t hash) {
+			size_t slot = hash & _mask;
+			while (_entries[slot]._used)
+				slot = (slot + 1) & _mask;
+			return _entries + slot;
+		}
+
+		void putAll(const HashMap &other) {
+			for (size_t i = 0; i <= other._mask; i++) {
+				if (other._entries[i]._used) put(other._entries[i]._key, other._entries[i]._value);
+			}
+		}
+
+		void grow() {
+			Entry *oldEntries = _entries;
+			size_t oldCapacity = _mask + 1;
+
+			_mask = oldCapacity * 2 - 1;
+			_entries = SpineExtension::alloc<Entry>(_mask + 1, __FILE__, __LINE__);
+			for (size_t i = 0; i <= _mask; i++)
+				new (_entries + i) Entry();
+
+			for (size_t i = 0; i < oldCapacity; i++) {
+				if (oldEntries[i]._used) *emptySlot(oldEntries[i]._hash) = oldEntries[i];
+			}
+
+			if (oldEntries == _inline) {
+				for (size_t i = 0; i < oldCapacity; i++)
+					_inline[i]._used = false;
+			} else {
+				releaseEntries(oldEntries, oldCapacity);
+			}
+		}
+
+		void releaseEntries() {
+			if (_entries != _inline) releaseEntries(_entries, _mask + 1);
+		}
+
+		static void releaseEntries(Entry *entries, size_t capacity) {
+			for (size_t i = 0; i < capacity; i++)
+				entries[i].~Entry();
+			SpineExtension::free(entries, __FILE__, __LINE__);
+		}
+
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
+			size_t _hash;
+			bool _used;
 
-			Entry() : next(NULL), prev(NULL) {}
+			Entry() : _key(), _value(), _hash(0), _used(false) {}
 		};
 
-		Entry *_head;
+		Entry *_entries;
+		size_t _mask;
 		size_t _size;
+		Entry _inline[InlineCapacity];
 	};
 }
 
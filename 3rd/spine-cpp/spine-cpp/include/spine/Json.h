@@ -70,6 +70,10 @@ namespace spine {
 		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
 		explicit Json(const char *value);
 
+		/* Like Json(value), but the value of the top-level member named deferName is only skipped over and its text is
+		 * returned in deferred, so a large member can be parsed piece by piece. Returns NULL when the text is invalid. */
+		static Json *parse(const char *value, const char *deferName, const char **deferred);
+
 		~Json();
 
 
@@ -107,7 +111,14 @@ namespace spine {
 		static const char *parseArray(Json *item, const char *value);
 
 		/* Build an object from the text. */
-		static const char *parseObject(Json *item, const char *value);
+		static const char *parseObject(Json *item, const char *value, const char *deferName = NULL,
+									   const char **deferred = NULL);
+
+		/* Parse the name of an object member and the colon after it, returns the start of the member's value. */
+		static const char *parseName(Json *item, const char *value);
+
+		/* Skip over a value without building items. */
+		static const char *skipValue(const char *value);
 
 		static int json_strcasecmp(const char *s1, const char *s2);
 	};
@@ -74,6 +74,18 @@ namespace spine {
 		/// Returns the cosine in radians from a lookup table.
 		static float cosDeg(float degrees);
 
+		/// Computes the sine and cosine of the same angle in one call, sharing the range reduction. When fast trig is
+		/// enabled a float polynomial is used instead of libm, with a largest absolute error of about 1e-7 for angles
+		/// up to +/-100000 radians; larger angles always fall back to libm.
+		static void sinCos(float radians, float &outSin, float &outCos);
+
+		/// Selects the polynomial sin/cos path for sin, cos, sinDeg, cosDeg and sinCos. Defaults to false, or true when
+		/// compiled with SPINE_FAST_TRIG. Intended for targets without a fast FPU where libm trig dominates the bone
+		/// update; results are no longer bit-identical to libm.
+		static void setFastTrig(bool enabled);
+
+		static bool isFastTrig();
+
 		/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
 		/// degrees), largest error of 0.00488 radians (0.2796 degrees).
 		static float atan2(float y, float x);
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+namespace spine {
+	/// Open addressing hash table from item names to positions in a Vector of named items. Only hashes and
+	/// indices are stored, names are compared against the items themselves, so building the index copies no strings.
+	///
+	/// The index is a snapshot: it is ignored when the Vector size no longer matches the size it was built
+	/// for, and must be rebuilt with build() if items are replaced in place.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() : _count(0), _mask(0) {
+		}
+
+		template<typename T>
+		void build(Vector<T *> &items) {
+			size_t capacity = 4;
+			while (capacity < items.size() * 2) capacity <<= 1;
+
+			Entry empty = {0, -1};
+			_entries.clear();
+			_entries.ensureCapacity(capacity);
+			_entries.setSize(capacity, empty);
+			_mask = capacity - 1;
+			_count = items.size();
+
+			for (size_t i = 0; i < items.size(); i++) {
+				const String &name = items[i]->getName();
+				unsigned int hash = hashName(name);
+				size_t slot = hash & _mask;
+				bool duplicate = false;
+				for (; _entries[slot].index != -1; slot = (slot + 1) & _mask) {
+					// Keep the first item with a name, as the linear search does.
+					if (_entries[slot].hash == hash && items[_entries[slot].index]->getName() == name) {
+						duplicate = true;
+						break;
+					}
+				}
+				if (!duplicate) {
+					_entries[slot].hash = hash;
+					_entries[slot].index = (int) i;
+				}
+			}
+		}
+
+		/// @return -1 if the item was not found.
+		template<typename T>
+		int findIndex(Vector<T *> &items, const String &name) {
+			if (_count != items.size() || _entries.size() == 0) {
+				for (size_t i = 0; i < items.size(); i++) {
+					if (items[i]->getName() == name) return (int) i;
+				}
+				return -1;
+			}
+
+			unsigned int hash = hashName(name);
+			for (size_t slot = hash & _mask; _entries[slot].index != -1; slot = (slot + 1) & _mask) {
+				Entry &entry = _entries[slot];
+				if (entry.hash == hash && items[entry.index]->getName() == name) return entry.index;
+			}
+			return -1;
+		}
+
+		/// @return May be NULL.
+		template<typename T>
+		T *find(Vector<T *> &items, const String &name) {
+			int index = findIndex(items, name);
+			return index == -1 ? NULL : items[index];
+		}
+
+		/// FNV-1a hash of the name.
+		static unsigned int hashName(const String &name) {
+			unsigned int hash = 2166136261u;
+			const char *chars = name.buffer();
+			for (size_t i = 0, n = name.length(); i < n; i++) {
+				hash ^= (unsigned char) chars[i];
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+
+	private:
+		struct Entry {
+			unsigned int hash;
+			int index;
+		};
+
+		Vector<Entry> _entries;
+		size_t _count;
+		size_t _mask;
+	};
+}
+
+#endif /* Spine_NameIndex_h */
@@ -31,11 +31,13 @@
 #define Spine_Skeleton_h
 
 #include <spine/Vector.h>
+#include <spine/Arena.h>
 #include <spine/MathUtil.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
 #include <spine/Physics.h>
+#include <spine/Bone.h>
 
 namespace spine {
 	class SkeletonData;
@@ -63,6 +65,8 @@ namespace spine {
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class Bone;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
@@ -136,6 +140,21 @@ namespace spine {
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// In render-driven mode updateWorldTransform(Physics) only computes the bones that feed a visible region, mesh or
+		/// clipping attachment, the bones the constraints acting on them depend on and the bones marked with
+		/// setBoneRequired. The other bones keep the world transform of the last frame they were needed in. Off by default.
+		void setRenderDriven(bool renderDriven);
+
+		bool isRenderDriven();
+
+		/// Keeps the bone and its parents updated in render-driven mode, for callers that read bone world transforms.
+		void setBoneRequired(Bone &bone, bool required);
+
+		bool isBoneRequired(Bone &bone);
+
+		/// Returns true if the last updateWorldTransform(Physics) computed the world transform of the bone.
+		bool isBoneUpdated(Bone &bone);
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -168,6 +187,10 @@ namespace spine {
 		/// @return May be NULL.
 		Attachment *getAttachment(int slotIndex, const String &attachmentName);
 
+		/// @param hash NameIndex::hashName of the attachment name.
+		/// @return May be NULL.
+		Attachment *getAttachment(int slotIndex, const String &attachmentName, unsigned int hash);
+
 		/// @param attachmentName May be empty.
 		void setAttachment(const String &slotName, const String &attachmentName);
 
@@ -199,8 +222,21 @@ namespace spine {
 
 		Vector<Bone *> &getBones();
 
+		/// Local transforms of all bones, indexed by bone index.
+		Vector<BoneLocal> &getBonePoses();
+
+		/// World transforms of all bones, indexed by bone index.
+		Vector<BoneWorld> &getBoneWorlds();
+
 		Vector<Updatable *> &getUpdateCacheList();
 
+		/// Frame index hint for the timeline currently being applied, passed to Animation::search so sampling can
+		/// continue from the previous frame. AnimationState sets it to a per TrackEntry, per timeline cursor while
+		/// applying. May be NULL.
+		int *getTimelineCursor();
+
+		void setTimelineCursor(int *cursor);
+
 		Vector<Slot *> &getSlots();
 
 		Vector<Slot *> &getDrawOrder();
@@ -248,7 +284,14 @@ namespace spine {
         /// Calls {@link PhysicsConstraint#rotate(float, float, float)} for each physics constraint. */
         void physicsRotate(float x, float y, float degrees);
 
+		/// The bones, slots and constraints of this skeleton, with the vectors they are created with, are cut from
+		/// this arena, usually a single block sized from the skeleton data. It is current while the skeleton is
+		/// constructed, while updateCache runs and while the skeleton is deleted. Vectors that start empty, such as
+		/// the slot deforms, grow on the heap.
+		Arena &getArena();
+
 	private:
+		Arena _arena; // First, so it is destroyed after the members that live in it.
 		SkeletonData *_data;
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
@@ -258,11 +301,24 @@ namespace spine {
 		Vector<PathConstraint *> _pathConstraints;
         Vector<PhysicsConstraint *> _physicsConstraints;
 		Vector<Updatable *> _updateCache;
+		/// Bone index of each update cache entry, -1 for constraints.
+		Vector<int> _updateCacheBones;
+		/// Pose store, indexed by bone index. Sized once in the constructor, bones keep references into it.
+		Vector<BoneLocal> _bonePoses;
+		Vector<BoneLocal> _boneAppliedPoses;
+		Vector<BoneWorld> _boneWorlds;
+		Vector<int> _boneParents;
+		Vector<bool> _requiredBones;
+		/// Render-driven mode: bones and update cache entries computed by the last updateWorldTransform(Physics).
+		Vector<bool> _neededBones;
+		Vector<bool> _neededCache;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		bool _renderDriven;
+		int *_timelineCursor;
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -278,6 +334,8 @@ namespace spine {
 
 		void sortBone(Bone *bone);
 
+		void updateNeededBones();
+
 		static void sortReset(Vector<Bone *> &bones);
 	};
 }
@@ -39,6 +39,8 @@
 namespace spine {
 	class SkeletonData;
 
+	class SkeletonDataBuffer;
+
 	class Atlas;
 
 	class AttachmentLoader;
@@ -63,7 +65,13 @@ namespace spine {
 
 	class Sequence;
 
+	class BinaryAnimationLoader;
+
+	class Animation;
+
 	class SP_API SkeletonBinary : public SpineObject {
+		friend class BinaryAnimationLoader;
+
 	public:
 		static const int BONE_ROTATE = 0;
 		static const int BONE_TRANSLATE = 1;
@@ -112,16 +120,46 @@ namespace spine {
 
 		SkeletonData *readSkeletonData(const unsigned char *binary, int length);
 
+		/// Reads the skeleton in place: names and strings are terminated inside binary and referenced rather than
+		/// copied, so binary must be writable, must not be read again and must stay alive as long as the returned
+		/// SkeletonData. The SkeletonData takes ownership of dataBuffer to ensure that and deletes it with itself, or right
+		/// away if reading fails. A NULL dataBuffer reads binary like readSkeletonData(const unsigned char *, int).
+		SkeletonData *readSkeletonData(unsigned char *binary, int length, SkeletonDataBuffer *dataBuffer);
+
 		SkeletonData *readSkeletonDataFile(const String &path);
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// Loads bezier curves as their control values, see CurveTimeline::setCompact.
+		void setCompactCurves(bool compactCurves) { _compactCurves = compactCurves; }
+
+		/// Skips over the animations while reading and decodes each one the first time it is used, see
+		/// Animation::unload. Only applies when reading in place with a SkeletonDataBuffer, which keeps the bytes alive.
+		void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+
+		/// Allocates everything read into the SkeletonData from its arena, see SkeletonData::getArena: a few blocks
+		/// instead of thousands of small allocations, all released together when the SkeletonData is deleted.
+		void setArena(bool arena) { _arena = arena; }
+
+		/// Writes the skeleton data in the format read by readSkeletonData, without the nonessential data, so skeletons
+		/// loaded from JSON can be converted offline. The curves must have been loaded compact, see setCompactCurves, and
+		/// the values are written as loaded, the scale is not applied. Attachment timelines of attachments that no skin
+		/// holds are left out, which lets tools drop skins from the vector before writing.
+		/// @return False if the data can't be written, see getError.
+		bool writeSkeletonData(SkeletonData *skeletonData, Vector<unsigned char> &binary);
+
 		String &getError() { return _error; }
 
 	private:
 		struct DataInput : public SpineObject {
 			const unsigned char *cursor;
 			const unsigned char *end;
+			bool inPlace;
+		};
+
+		struct DataOutput : public SpineObject {
+			Vector<unsigned char> bytes;
+			Vector<const char *> strings;
 		};
 
 		AttachmentLoader *_attachmentLoader;
@@ -129,13 +167,20 @@ namespace spine {
 		String _error;
 		float _scale;
 		const bool _ownsLoader;
+		bool _compactCurves;
+		bool _lazyAnimations;
+		bool _arena;
 
 		void setError(const char *value1, const char *value2);
 
 		char *readString(DataInput *input);
 
+		void readString(DataInput *input, String &string);
+
 		char *readStringRef(DataInput *input, SkeletonData *skeletonData);
 
+		void readStringRef(DataInput *input, SkeletonData *skeletonData, String &string);
+
 		float readFloat(DataInput *input);
 
 		unsigned char readByte(DataInput *input);
@@ -165,6 +210,12 @@ namespace spine {
 
 		Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData);
 
+		bool readTimelines(DataInput *input, SkeletonData *skeletonData, Vector<Timeline *> &timelines);
+
+		bool skipAnimation(DataInput *input, SkeletonData *skeletonData);
+
+		void skipCurveFrames(DataInput *input, int frameCount, int valueSize, int channels);
+
 		void
 		setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
 				  float value1, float value2, float scale);
@@ -172,6 +223,37 @@ namespace spine {
 		void readTimeline(DataInput *input, Vector<Timeline*> &timelines, CurveTimeline1 *timeline, float scale);
 
 		void readTimeline2(DataInput *input, Vector<Timeline*> &timelines, CurveTimeline2 *timeline, float scale);
+
+		void writeByte(DataOutput *output, int value);
+
+		void writeBoolean(DataOutput *output, bool value);
+
+		void writeInt(DataOutput *output, int value);
+
+		void writeFloat(DataOutput *output, float value);
+
+		void writeVarint(DataOutput *output, int value, bool optimizePositive);
+
+		void writeString(DataOutput *output, const String &string);
+
+		void writeStringRef(DataOutput *output, const String &string);
+
+		void writeColor(DataOutput *output, const Color &color);
+
+		bool writeSkin(DataOutput *output, Skin *skin, bool defaultSkin, SkeletonData *skeletonData, Vector<Skin *> &skins);
+
+		void writeSequence(DataOutput *output, Sequence *sequence);
+
+		bool writeAttachment(DataOutput *output, int slotIndex, const String &attachmentName, Attachment *attachment,
+							 SkeletonData *skeletonData, Vector<Skin *> &skins);
+
+		void writeVertices(DataOutput *output, VertexAttachment *attachment);
+
+		void writeBezier(DataOutput *output, CurveTimeline *timeline, size_t frame, int channels);
+
+		void writeCurveTimeline(DataOutput *output, CurveTimeline *timeline, bool colorBytes);
+
+		bool writeTimelines(DataOutput *output, SkeletonData *skeletonData, Animation *animation, Vector<Skin *> &skins);
 	};
 }
 
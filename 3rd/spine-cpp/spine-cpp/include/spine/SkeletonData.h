@@ -30,8 +30,10 @@
 #ifndef Spine_SkeletonData_h
 #define Spine_SkeletonData_h
 
+#include <spine/Arena.h>
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/NameIndex.h>
 
 namespace spine {
 	class BoneData;
@@ -44,6 +46,8 @@ namespace spine {
 
 	class Animation;
 
+	class AnimationLoader;
+
 	class IkConstraintData;
 
 	class TransformConstraintData;
@@ -52,6 +56,14 @@ namespace spine {
 
     class PhysicsConstraintData;
 
+	/// Keeps the memory alive that a SkeletonData read in place refers to, see SkeletonBinary::readSkeletonData. The
+	/// SkeletonData deletes it last.
+	class SP_API SkeletonDataBuffer : public SpineObject {
+	public:
+		virtual ~SkeletonDataBuffer() {
+		}
+	};
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -65,8 +77,8 @@ namespace spine {
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
-		/// It is more efficient to cache the results of this method than to call it multiple times.
+		/// Finds a bone by name. Bones, slots, skins and animations are looked up in a hashed name index, see
+		/// updateNameIndex().
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
 
@@ -94,6 +106,11 @@ namespace spine {
         /// @return May be NULL.
         PhysicsConstraintData *findPhysicsConstraint(const String &constraintName);
 
+		/// Rebuilds the name index used by findBone, findSlot, findSkin and findAnimation. The loaders call this after
+		/// reading; call it again after replacing items in those lists in place. Lists whose size changed since the
+		/// last call fall back to a linear search.
+		void updateNameIndex();
+
 		const String &getName();
 
 		void setName(const String &inValue);
@@ -117,6 +134,9 @@ namespace spine {
 
 		Vector<Animation *> &getAnimations();
 
+		/// Bakes every animation, see Animation::bake.
+		void bakeAnimations(float fps, bool quantize = false);
+
 		Vector<IkConstraintData *> &getIkConstraints();
 
 		Vector<TransformConstraintData *> &getTransformConstraints();
@@ -167,7 +187,16 @@ namespace spine {
 
 		void setFps(float inValue);
 
+		/// The buffer the names and strings were read from in place, or NULL if they were copied.
+		SkeletonDataBuffer *getBuffer();
+
+		/// Holds everything read into the skeleton data when the loader was set to use an arena, see
+		/// SkeletonBinary::setArena and SkeletonJson::setArena. Empty otherwise. Changes that allocate or free after
+		/// loading, such as adding attachments to a skin, must be made with it current, see ArenaScope.
+		Arena &getArena();
+
 	private:
+		Arena _arena; // First, so it is destroyed after the members that may live in it.
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
 		Vector<SlotData *> _slots; // Setup pose draw order.
@@ -184,11 +213,18 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		SkeletonDataBuffer *_buffer;
+		AnimationLoader *_animationLoader;
 
 		// Nonessential.
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		NameIndex _boneIndex;
+		NameIndex _slotIndex;
+		NameIndex _skinIndex;
+		NameIndex _animationIndex;
 	};
 }
 
@@ -75,6 +75,17 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// Loads bezier curves as their control values, see CurveTimeline::setCompact.
+		void setCompactCurves(bool compactCurves) { _compactCurves = compactCurves; }
+
+		/// Parses and builds the animations one at a time instead of parsing the whole document first, which keeps
+		/// the peak memory of loading close to the size of the largest animation. Enabled by default.
+		void setStreaming(bool streaming) { _streaming = streaming; }
+
+		/// Allocates everything read into the SkeletonData from its arena, see SkeletonData::getArena. The parsed
+		/// JSON is still allocated from the SpineExtension, as it is released while reading.
+		void setArena(bool arena) { _arena = arena; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -82,31 +93,39 @@ namespace spine {
 		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
 		const bool _ownsLoader;
+		bool _compactCurves;
+		bool _streaming;
+		bool _arena;
 		String _error;
+		Vector<int> _internTable;
 
 		static Sequence *readSequence(Json *sequence);
 
-		static void
+		void
 		setBezier(CurveTimeline *timeline, int frame, int value, int bezier, float time1, float value1, float cx1,
 				  float cy1,
 				  float cx2, float cy2, float time2, float value2);
 
-		static int
+		int
 		readCurve(Json *curve, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
 				  float value1, float value2, float scale);
 
-		static Timeline *readTimeline(Json *keyMap, CurveTimeline1 *timeline, float defaultValue, float scale);
+		Timeline *readTimeline(Json *keyMap, CurveTimeline1 *timeline, float defaultValue, float scale);
 
-		static Timeline *
+		Timeline *
 		readTimeline(Json *keyMap, CurveTimeline2 *timeline, const char *name1, const char *name2, float defaultValue,
 					 float scale);
 
 		Animation *readAnimation(Json *root, SkeletonData *skeletonData);
 
+		bool readAnimations(const char *json, SkeletonData *skeletonData);
+
 		void readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength);
 
 		void setError(Json *root, const String &value1, const String &value2);
 
+		String internName(SkeletonData *skeletonData, const char *name);
+
 		int findSlotIndex(SkeletonData *skeletonData, const String &slotName, Vector<Timeline *> timelines);
 	};
 }
@@ -33,6 +33,7 @@
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
+#include <spine/NameIndex.h>
 
 namespace spine {
 	class Attachment;
@@ -58,11 +59,14 @@ namespace spine {
 				size_t _slotIndex;
 				String _name;
 				Attachment *_attachment;
+				/// NameIndex::hashName of the name, compared before the name itself.
+				unsigned int _hash;
 
 				Entry(size_t slotIndex, const String &name, Attachment *attachment) :
 						_slotIndex(slotIndex),
 						_name(name),
-						_attachment(attachment) {
+						_attachment(attachment),
+						_hash(NameIndex::hashName(name)) {
 				}
 			};
 
@@ -102,6 +106,9 @@ namespace spine {
 
 			Attachment *get(size_t slotIndex, const String &attachmentName);
 
+			/// @param hash NameIndex::hashName of the attachment name.
+			Attachment *get(size_t slotIndex, const String &attachmentName, unsigned int hash);
+
 			void remove(size_t slotIndex, const String &attachmentName);
 
 			Entries getEntries();
@@ -111,7 +118,7 @@ namespace spine {
 
 		private:
 
-			int findInBucket(Vector <Entry> &, const String &attachmentName);
+			int findInBucket(Vector <Entry> &, const String &attachmentName, unsigned int hash);
 
 			Vector <Vector<Entry>> _buckets;
 		};
@@ -127,6 +134,10 @@ namespace spine {
 		/// Returns the attachment for the specified slot index and name, or NULL.
 		Attachment *getAttachment(size_t slotIndex, const String &name);
 
+		/// Returns the attachment for the specified slot index and name, or NULL, using a name hash computed in advance
+		/// with NameIndex::hashName.
+		Attachment *getAttachment(size_t slotIndex, const String &name, unsigned int hash);
+
 		// Removes the attachment from the skin.
 		void removeAttachment(size_t slotIndex, const String &name);
 
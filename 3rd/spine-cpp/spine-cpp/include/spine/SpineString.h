@@ -37,6 +37,8 @@
 #include <stdio.h>
 
 namespace spine {
+	/// A String created with tofree = false borrows its characters from memory owned elsewhere, e.g. a skeleton
+	/// binary loaded in place. Copies of a borrowed String share the characters, appending detaches them first.
 	class SP_API String : public SpineObject {
 	public:
 		String() : _length(0), _buffer(NULL), _tempowner(true) {
@@ -63,6 +65,10 @@ namespace spine {
 			if (!other._buffer) {
 				_length = 0;
 				_buffer = NULL;
+			} else if (!other._tempowner) {
+				_length = other._length;
+				_buffer = other._buffer;
+				_tempowner = false;
 			} else {
 				_length = other._length;
 				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
@@ -89,8 +95,10 @@ namespace spine {
 			}
 			_length = other._length;
 			_buffer = other._buffer;
+			_tempowner = other._tempowner;
 			other._length = 0;
 			other._buffer = NULL;
+			other._tempowner = true;
 		}
 
 		void own(const char *chars) {
@@ -99,6 +107,7 @@ namespace spine {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
 
+			_tempowner = true;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -118,9 +127,13 @@ namespace spine {
 			if (_buffer && _tempowner) {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
+			_tempowner = other._tempowner || !other._buffer;
 			if (!other._buffer) {
 				_length = 0;
 				_buffer = NULL;
+			} else if (!other._tempowner) {
+				_length = other._length;
+				_buffer = other._buffer;
 			} else {
 				_length = other._length;
 				_buffer = SpineExtension::calloc<char>(other._length + 1, __FILE__, __LINE__);
@@ -134,6 +147,7 @@ namespace spine {
 			if (_buffer && _tempowner) {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
+			_tempowner = true;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -146,6 +160,7 @@ namespace spine {
 		}
 
 		String &append(const char *chars) {
+			detach();
 			size_t len = strlen(chars);
 			size_t thisLen = _length;
 			_length = _length + len;
@@ -156,6 +171,7 @@ namespace spine {
 		}
 
 		String &append(const String &other) {
+			detach();
 			size_t len = other.length();
 			size_t thisLen = _length;
 			_length = _length + len;
@@ -236,6 +252,14 @@ namespace spine {
 		}
 
 	private:
+		void detach() {
+			if (!_buffer || _tempowner) return;
+			char *chars = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
+			memcpy((void *) chars, _buffer, _length + 1);
+			_buffer = chars;
+			_tempowner = true;
+		}
+
 		mutable size_t _length;
 		mutable char *_buffer;
 		mutable bool _tempowner;
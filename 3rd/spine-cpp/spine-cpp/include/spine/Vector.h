@@ -34,8 +34,12 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <assert.h>
+#include <string.h>
+#include <type_traits>
 
 namespace spine {
+	/// Elements that are trivially copyable (numbers, pointers, plain structs) are copied with memcpy/memmove, filled with
+	/// memset when the value is all zero bytes, and are not destroyed one by one.
 	template<typename T>
 	class SP_API Vector : public SpineObject {
 	public:
@@ -45,9 +49,7 @@ namespace spine {
 		Vector(const Vector &inVector) : _size(inVector._size), _capacity(inVector._capacity), _buffer(NULL) {
 			if (_capacity > 0) {
 				_buffer = allocate(_capacity);
-				for (size_t i = 0; i < _size; ++i) {
-					construct(_buffer + i, inVector._buffer[i]);
-				}
+				constructAll(_buffer, inVector._buffer, _size);
 			}
 		}
 
@@ -57,8 +59,10 @@ namespace spine {
 		}
 
 		inline void clear() {
-			for (size_t i = 0; i < _size; ++i) {
-				destroy(_buffer + (_size - 1 - i));
+			if (!trivial()) {
+				for (size_t i = 0; i < _size; ++i) {
+					destroy(_buffer + (_size - 1 - i));
+				}
 			}
 
 			_size = 0;
@@ -82,12 +86,23 @@ namespace spine {
 				_buffer = spine::SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
 			}
 			if (oldSize < _size) {
-				for (size_t i = oldSize; i < _size; i++) {
-					construct(_buffer + i, defaultValue);
-				}
+				fill(_buffer + oldSize, _size - oldSize, defaultValue);
 			}
 		}
 
+		/// Releases the capacity beyond the current size.
+		inline void shrinkToFit() {
+			if (_capacity == _size) return;
+			if (_size == 0) {
+				deallocate(_buffer);
+				_buffer = NULL;
+				_capacity = 0;
+				return;
+			}
+			_capacity = _size;
+			_buffer = SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
+		}
+
 		inline void ensureCapacity(size_t newCapacity = 0) {
 			if (_capacity >= newCapacity) return;
 			_capacity = newCapacity;
@@ -111,10 +126,11 @@ namespace spine {
 		}
 
 		inline void addAll(Vector<T> &inValue) {
-			ensureCapacity(this->size() + inValue.size());
-			for (size_t i = 0; i < inValue.size(); i++) {
-				add(inValue[i]);
-			}
+			size_t count = inValue.size();
+			if (count == 0) return;
+			ensureCapacity(_size + count);
+			constructAll(_buffer + _size, inValue._buffer, count);
+			_size += count;
 		}
 
 		inline void clearAndAddAll(Vector<T> &inValue) {
@@ -127,6 +143,12 @@ namespace spine {
 
 			--_size;
 
+			if (trivial()) {
+				if (inIndex != _size)
+					memmove((void *) (_buffer + inIndex), (const void *) (_buffer + inIndex + 1), sizeof(T) * (_size - inIndex));
+				return;
+			}
+
 			if (inIndex != _size) {
 				for (size_t i = inIndex; i < _size; ++i) {
 					T tmp(_buffer[i]);
@@ -215,6 +237,33 @@ namespace spine {
 			buffer->~T();
 		}
 
+		static inline bool trivial() {
+			return std::is_trivially_copyable<T>::value;
+		}
+
+		inline void constructAll(T *buffer, const T *values, size_t count) {
+			if (trivial()) {
+				memcpy((void *) buffer, (const void *) values, sizeof(T) * count);
+				return;
+			}
+			for (size_t i = 0; i < count; ++i) {
+				construct(buffer + i, values[i]);
+			}
+		}
+
+		inline void fill(T *buffer, size_t count, const T &value) {
+			if (trivial()) {
+				static const char zero[sizeof(T)] = {0};
+				if (memcmp((const void *) &value, zero, sizeof(T)) == 0) {
+					memset((void *) buffer, 0, sizeof(T) * count);
+					return;
+				}
+			}
+			for (size_t i = 0; i < count; ++i) {
+				construct(buffer + i, value);
+			}
+		}
+
 		// Vector &operator=(const Vector &inVector) {};
 	};
 }
@@ -33,10 +33,13 @@
 #include <spine/Attachment.h>
 
 #include <spine/Vector.h>
+#include <spine/VertexTransform.h>
 
 namespace spine {
 	class Slot;
 
+	class Bone;
+
 	/// An attachment with vertices that are transformed by one or more bones and can be deformed by a slot's vertices.
 	class SP_API VertexAttachment : public Attachment {
 		friend class SkeletonBinary;
@@ -85,16 +88,26 @@ namespace spine {
 
 		void copyTo(VertexAttachment *other);
 
+		/// Rebuilds the bone grouped weights used to transform weighted vertices. Called by the loaders, must be
+		/// called again if the bones or vertices of a weighted attachment are changed.
+		void updateWeightLayout();
+
+		BoneGroupedWeights &getWeightLayout();
+
 	protected:
 		Vector <int> _bones;
 		Vector<float> _vertices;
 		size_t _worldVerticesLength;
 		Attachment *_timelineAttachment;
+		BoneGroupedWeights _weightLayout;
 
 	private:
 		const int _id;
 
 		static int getNextID();
+
+		void computeWeightedWorldVertices(Vector<Bone *> &skeletonBones, float *deform, size_t vertexCount,
+										  float *worldVertices, size_t stride);
 	};
 }
 
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_VertexTransform_h
+#define Spine_VertexTransform_h
+
+#include <spine/Vector.h>
+
+// Compile time SIMD selection. Define SPINE_NO_SIMD to force the scalar kernels.
+#if !defined(SPINE_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPINE_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPINE_SIMD_NEON 1
+#endif
+#endif
+
+namespace spine {
+	/// Bone weighted vertices regrouped by bone. Influences of the same bone are stored contiguously as
+	/// structure-of-arrays so that a bone's world transform is loaded once and applied to all its influences.
+	/// Built from the interleaved VertexAttachment bones/vertices arrays at load time.
+	class SP_API BoneGroupedWeights : public SpineObject {
+	public:
+		BoneGroupedWeights();
+
+		~BoneGroupedWeights();
+
+		/// Rebuilds the layout from the interleaved attachment arrays. Clears the layout if the vertices are not weighted.
+		void build(Vector<int> &bones, Vector<float> &vertices);
+
+		void clear();
+
+		/// Returns true if the layout was built from a weighted vertices array with the given number of values.
+		bool isValid(size_t verticesSize) {
+			return _bones.size() > 0 && _weights.size() * 3 == verticesSize;
+		}
+
+		/// Bone index of each group.
+		Vector<int> _bones;
+		/// Index of the first influence of each group, with a final entry holding the influence count.
+		Vector<int> _offsets;
+		/// Output vertex index of each influence.
+		Vector<int> _vertexIndices;
+		/// Index of each influence in the original influence order, used to address deform offsets.
+		Vector<int> _deformIndices;
+		Vector<float> _x;
+		Vector<float> _y;
+		Vector<float> _weights;
+	};
+
+	/// SIMD (SSE2 or NEON) kernels used by attachments to transform vertices to world coordinates, with scalar
+	/// fallbacks. The kernel set is chosen at compile time and can be switched off at runtime.
+	class SP_API VertexTransform {
+	public:
+		/// Transforms count points (x, y pairs) by the affine matrix [a b x; c d y].
+		/// @param stride The number of output entries between the value pairs written.
+		static void transform(const float *points, size_t count, float a, float b, float c, float d, float x, float y,
+							  float *worldVertices, size_t stride = 2);
+
+		/// Computes (vx * a + vy * b + x) * weight and (vx * c + vy * d + y) * weight for count influences.
+		static void transformWeighted(const float *vx, const float *vy, const float *weights, size_t count, float a,
+									  float b, float c, float d, float x, float y, float *outX, float *outY);
+
+		/// Enables or disables the SIMD kernels at runtime. Has no effect if no SIMD kernels were compiled in.
+		static void setSimdEnabled(bool enabled);
+
+		static bool isSimdEnabled();
+
+		/// Returns "sse2", "neon" or "scalar", depending on the kernels compiled in.
+		static const char *getSimdName();
+	};
+}
+
+#endif /* Spine_VertexTransform_h */
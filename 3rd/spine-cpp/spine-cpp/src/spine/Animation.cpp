@@ -28,6 +28,7 @@
  *****************************************************************************/
 
 #include <spine/Animation.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Event.h>
 #include <spine/Skeleton.h>
 #include <spine/Timeline.h>
@@ -41,16 +42,59 @@ using namespace spine;
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _baked(NULL),
+																						  _loader(NULL),
+																						  _loaded(true) {
 	assert(_name.length() > 0);
-	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
+	setTimelines();
+}
+
+Animation::Animation(const String &name, AnimationLoader *loader) : _timelines(),
+																	_timelineIds(),
+																	_duration(0),
+																	_name(name),
+																	_baked(NULL),
+																	_loader(loader),
+																	_loaded(false) {
+	assert(_name.length() > 0);
+}
+
+void Animation::setTimelines() {
+	for (size_t i = 0; i < _timelines.size(); i++) {
+		Vector<PropertyId> propertyIds = _timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
 			_timelineIds.put(propertyIds[ii], true);
 	}
 }
 
+void Animation::load() {
+	_loaded = true;
+	if (!_loader->load(*this, _timelines)) {
+		ContainerUtil::cleanUpVectorOfPointers(_timelines);
+		return;
+	}
+	_duration = 0;
+	for (size_t i = 0; i < _timelines.size(); i++) {
+		_duration = MathUtil::max(_duration, _timelines[i]->getDuration());
+	}
+	setTimelines();
+}
+
+bool Animation::isLoaded() {
+	return _loaded;
+}
+
+void Animation::unload() {
+	if (!_loader || !_loaded) return;
+	ContainerUtil::cleanUpVectorOfPointers(_timelines);
+	_timelineIds.clear();
+	_duration = 0;
+	_loaded = false;
+}
+
 bool Animation::hasTimeline(Vector<PropertyId> &ids) {
+	if (!_loaded) load();
 	for (size_t i = 0; i < ids.size(); i++) {
 		if (_timelineIds.containsKey(ids[i])) return true;
 	}
@@ -58,11 +102,13 @@ bool Animation::hasTimeline(Vector<PropertyId> &ids) {
 }
 
 Animation::~Animation() {
+	clearBaked();
 	ContainerUtil::cleanUpVectorOfPointers(_timelines);
 }
 
 void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
 					  MixBlend blend, MixDirection direction) {
+	if (!_loaded) load();
 	if (loop && _duration != 0) {
 		time = MathUtil::fmod(time, _duration);
 		if (lastTime > 0) {
@@ -80,28 +126,66 @@ const String &Animation::getName() {
 }
 
 Vector<Timeline *> &Animation::getTimelines() {
+	if (!_loaded) load();
 	return _timelines;
 }
 
 float Animation::getDuration() {
+	if (!_loaded) load();
 	return _duration;
 }
 
 void Animation::setDuration(float inValue) {
+	if (!_loaded) load();
 	_duration = inValue;
 }
 
+BakedAnimation *Animation::bake(SkeletonData &skeletonData, float fps, bool quantize) {
+	clearBaked();
+	_baked = new (__FILE__, __LINE__) BakedAnimation(skeletonData, *this, fps, quantize);
+	return _baked;
+}
+
+BakedAnimation *Animation::getBaked() {
+	return _baked;
+}
+
+void Animation::clearBaked() {
+	if (_baked) delete _baked;
+	_baked = NULL;
+}
+
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
-	}
-	return (int) (n - 1);
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+	// Finds the first frame after the first one whose time is > target, the result is the frame before it.
+	int low = 1, high = (int) frames.size() / step;
+	float *values = frames.buffer();
+	while (low < high) {
+		int middle = (low + high) >> 1;
+		if (values[middle * step] > target)
+			high = middle;
+		else
+			low = middle + 1;
+	}
+	return (low - 1) * step;
+}
+
+static inline bool isFrameFor(float *values, int n, int i, int step, float target) {
+	return (i == 0 || values[i] <= target) && (i + step >= n || values[i + step] > target);
+}
+
+int Animation::search(Vector<float> &frames, float target, int step, int *cursor) {
+	if (!cursor) return search(frames, target, step);
+
+	int n = (int) frames.size(), i = *cursor;
+	float *values = frames.buffer();
+	if (i >= 0 && i < n && i % step == 0) {
+		if (isFrameFor(values, n, i, step, target)) return i;
+		int next = values[i] <= target ? i + step : i - step;
+		if (next >= 0 && next < n && isFrameFor(values, n, next, step, target)) return *cursor = next;
+	}
+	return *cursor = search(frames, target, step);
 }
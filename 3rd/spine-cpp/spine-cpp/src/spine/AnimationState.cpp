@@ -31,6 +31,7 @@
 #include <spine/Animation.h>
 #include <spine/AnimationStateData.h>
 #include <spine/AttachmentTimeline.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
 #include <spine/DrawOrderTimeline.h>
@@ -202,6 +203,7 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
@@ -459,12 +461,19 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			applyTime = current._animation->getDuration() - applyTime;
 			applyEvents = NULL;
 		}
-		size_t timelineCount = current._animation->_timelines.size();
-		Vector<Timeline *> &timelines = current._animation->_timelines;
+		Vector<Timeline *> &timelines = current._animation->getTimelines();
+		size_t timelineCount = timelines.size();
+		if (current._timelineCursors.size() != timelineCount) current._timelineCursors.setSize(timelineCount, 0);
+		int *cursors = current._timelineCursors.buffer();
 		if ((i == 0 && alpha == 1) || blend == MixBlend_Add) {
 			if (i == 0) attachments = true;
+			// The first track fully replaces the bones it keys, so baked samples can stand in for its bone timelines.
+			BakedAnimation *baked = i == 0 && alpha == 1 ? current._animation->_baked : NULL;
+			if (baked) baked->apply(skeleton, applyTime);
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
+				if (baked && baked->isBaked(ii)) continue;
 				Timeline *timeline = timelines[ii];
+				skeleton._timelineCursor = cursors + ii;
 				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
 											attachments);
@@ -484,6 +493,7 @@ bool AnimationState::apply(Skeleton &skeleton) {
 				assert(timeline);
 
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
+				skeleton._timelineCursor = cursors + ii;
 
 				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
 					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, alpha,
@@ -497,6 +507,8 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			}
 		}
 
+		skeleton._timelineCursor = NULL;
+
 		queueEvents(currentP, animationTime);
 		_events.clear();
 		current._nextAnimationLast = animationTime;
@@ -711,8 +723,9 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
 			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
 	} else {
-		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[Animation::search(frames, time)],
-					  attachments);
+		int frame = Animation::search(frames, time, 1, skeleton._timelineCursor);
+		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[frame],
+					  attachmentTimeline->getAttachmentHashes()[frame], attachments);
 	}
 
 	/* If an attachment wasn't set (ie before the first frame or attachments is false), set the setup attachment later.*/
@@ -736,16 +749,16 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 	if (time < frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation;
+				bone->_local.rotation = bone->_data._rotation;
 			default:
 				return;
 			case MixBlend_First:
-				r1 = bone->_rotation;
+				r1 = bone->_local.rotation;
 				r2 = bone->_data._rotation;
 		}
 	} else {
-		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
-		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time);
+		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_local.rotation;
+		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time, skeleton._timelineCursor);
 	}
 
 	// Mix between rotations using the direction of the shortest route on the first frame while detecting crosses.
@@ -780,7 +793,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		timelinesRotation[i] = total;
 	}
 	timelinesRotation[i + 1] = diff;
-	bone->_rotation = r1 + total * alpha;
+	bone->_local.rotation = r1 + total * alpha;
 }
 
 bool AnimationState::updateMixingFrom(TrackEntry *to, float delta) {
@@ -832,21 +845,25 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	}
 
 	bool attachments = mix < from->_mixAttachmentThreshold, drawOrder = mix < from->_mixDrawOrderThreshold;
-	Vector<Timeline *> &timelines = from->_animation->_timelines;
+	Vector<Timeline *> &timelines = from->_animation->getTimelines();
 	size_t timelineCount = timelines.size();
 	float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
 	float animationLast = from->_animationLast, animationTime = from->getAnimationTime();
 	float applyTime = animationTime;
 	Vector<Event *> *events = NULL;
 	if (from->_reverse) {
-		applyTime = from->_animation->_duration - applyTime;
+		applyTime = from->_animation->getDuration() - applyTime;
 	} else {
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
+	if (from->_timelineCursors.size() != timelineCount) from->_timelineCursors.setSize(timelineCount, 0);
+	int *cursors = from->_timelineCursors.buffer();
 	if (blend == MixBlend_Add) {
-		for (size_t i = 0; i < timelineCount; i++)
+		for (size_t i = 0; i < timelineCount; i++) {
+			skeleton._timelineCursor = cursors + i;
 			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		}
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -888,6 +905,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 			}
 			from->_totalAlpha += alpha;
+			skeleton._timelineCursor = cursors + i;
 			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
 									timelinesRotation, i << 1, firstFrame);
@@ -902,6 +920,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 			}
 		}
 	}
+	skeleton._timelineCursor = NULL;
 
 	if (to->_mixDuration > 0) {
 		queueEvents(from, animationTime);
@@ -920,6 +939,13 @@ void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String
 	if (attachments) slot.setAttachmentState(_unkeyedState + Current);
 }
 
+void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, unsigned int hash,
+								   bool attachments) {
+	slot.setAttachment(
+			attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName, hash));
+	if (attachments) slot.setAttachmentState(_unkeyedState + Current);
+}
+
 void AnimationState::queueEvents(TrackEntry *entry, float animationTime) {
 	float animationStart = entry->_animationStart, animationEnd = entry->_animationEnd;
 	float duration = animationEnd - animationStart;
@@ -1055,7 +1081,7 @@ void AnimationState::animationsChanged() {
 
 void AnimationState::computeHold(TrackEntry *entry) {
 	TrackEntry *to = entry->_mixingTo;
-	Vector<Timeline *> &timelines = entry->_animation->_timelines;
+	Vector<Timeline *> &timelines = entry->_animation->getTimelines();
 	size_t timelinesCount = timelines.size();
 	Vector<int> &timelineMode = entry->_timelineMode;
 	timelineMode.setSize(timelinesCount, 0);
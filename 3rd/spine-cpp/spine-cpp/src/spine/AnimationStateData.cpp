@@ -30,6 +30,7 @@
 #include <spine/AnimationStateData.h>
 #include <spine/Animation.h>
 #include <spine/SkeletonData.h>
+#include <spine/NameIndex.h>
 
 using namespace spine;
 
@@ -84,3 +85,7 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hash() const {
+	return NameIndex::hashName(_a1->_name) * 31 + NameIndex::hashName(_a2->_name);
+}
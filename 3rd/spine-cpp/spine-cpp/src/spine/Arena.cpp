@@ -0,0 +1,201 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/Arena.h>
+#include <spine/Extension.h>
+
+#include <string.h>
+
+using namespace spine;
+
+#define ARENA_ALIGNMENT 8
+#define ARENA_ALIGN(size) (((size) + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1))
+#define BLOCK_HEADER_SIZE ARENA_ALIGN(sizeof(Arena::Block))
+#define BLOCK_START(block) ((char *) (block) + BLOCK_HEADER_SIZE)
+
+static thread_local Arena *current = NULL;
+
+Arena::Arena(size_t blockSize) : _blockSize(ARENA_ALIGN(blockSize)), _block(NULL), _blocks(NULL), _sorted(_inline),
+								 _sortedCapacity(4), _last(NULL), _used(0), _capacity(0), _blockCount(0),
+								 _retired(false), _previous(NULL) {
+}
+
+Arena::~Arena() {
+	if (_retired) current = _previous;
+	else if (current == this)
+		current = NULL;
+
+	while (_blocks) {
+		Block *next = _blocks->next;
+		SpineExtension::getInstance()->_free(_blocks, __FILE__, __LINE__);
+		_blocks = next;
+	}
+	if (_sorted != _inline) SpineExtension::getInstance()->_free(_sorted, __FILE__, __LINE__);
+}
+
+Arena::Block *Arena::newBlock(size_t size) {
+	if (_blockCount == _sortedCapacity) {
+		size_t capacity = _sortedCapacity * 2;
+		Block **sorted = (Block **) SpineExtension::getInstance()->_alloc(sizeof(Block *) * capacity, __FILE__,
+																		   __LINE__);
+		if (!sorted) return NULL;
+		memcpy(sorted, _sorted, sizeof(Block *) * _blockCount);
+		if (_sorted != _inline) SpineExtension::getInstance()->_free(_sorted, __FILE__, __LINE__);
+		_sorted = sorted;
+		_sortedCapacity = capacity;
+	}
+
+	Block *block = (Block *) SpineExtension::getInstance()->_alloc(BLOCK_HEADER_SIZE + size, __FILE__, __LINE__);
+	if (!block) return NULL;
+	block->size = size;
+	block->used = 0;
+	block->next = _blocks;
+	_blocks = block;
+	_capacity += BLOCK_HEADER_SIZE + size;
+
+	/* The blocks are also kept sorted by address, for owns(). */
+	size_t index = _blockCount;
+	while (index > 0 && _sorted[index - 1] > block) {
+		_sorted[index] = _sorted[index - 1];
+		index--;
+	}
+	_sorted[index] = block;
+	_blockCount++;
+
+	return block;
+}
+
+Arena::Block *Arena::findBlock(const void *ptr) const {
+	if (!ptr || _blockCount == 0) return NULL;
+
+	/* The last block that starts at or before ptr. */
+	size_t low = 0, high = _blockCount;
+	while (low < high) {
+		size_t mid = (low + high) >> 1;
+		if (BLOCK_START(_sorted[mid]) <= (const char *) ptr) low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low == 0) return NULL;
+
+	Block *block = _sorted[low - 1];
+	return (const char *) ptr < BLOCK_START(block) + block->size ? block : NULL;
+}
+
+void *Arena::alloc(size_t size, bool zero) {
+	if (size == 0) return NULL;
+
+	size_t aligned = ARENA_ALIGN(size);
+	char *ptr;
+	if (aligned > _blockSize / 4) {
+		/* A block of its own, the current block stays the one to cut from. */
+		Block *block = newBlock(aligned);
+		if (!block) return NULL;
+		block->used = aligned;
+		ptr = BLOCK_START(block);
+	} else {
+		if (!_block || _block->used + aligned > _block->size) {
+			Block *block = newBlock(_blockSize);
+			if (!block) return NULL;
+			_block = block;
+		}
+		ptr = BLOCK_START(_block) + _block->used;
+		_block->used += aligned;
+		_last = ptr;
+	}
+	_used += aligned;
+
+	if (zero) memset(ptr, 0, size);
+	return ptr;
+}
+
+bool Arena::resize(void *ptr, size_t size) {
+	if (!ptr || ptr != _last) return false;
+
+	size_t offset = _last - BLOCK_START(_block);
+	size_t aligned = ARENA_ALIGN(size);
+	if (offset + aligned > _block->size) return false;
+
+	_used = _used - _block->used + offset + aligned;
+	_block->used = offset + aligned;
+	return true;
+}
+
+void *Arena::realloc(void *ptr, size_t size) {
+	if (size == 0) {
+		free(ptr);
+		return NULL;
+	}
+	if (resize(ptr, size)) return ptr;
+
+	/* The size of an allocation isn't kept, it is at most what is used of its block after it. */
+	Block *block = findBlock(ptr);
+	size_t length = block ? BLOCK_START(block) + block->used - (char *) ptr : 0;
+	void *mem = alloc(size, false);
+	if (mem && length) memcpy(mem, ptr, length < size ? length : size);
+	free(ptr);
+	return mem;
+}
+
+void Arena::free(void *ptr) {
+	if (!ptr || ptr != _last) return;
+
+	size_t offset = _last - BLOCK_START(_block);
+	_used -= _block->used - offset;
+	_block->used = offset;
+	_last = NULL;
+}
+
+bool Arena::owns(const void *ptr) const {
+	return findBlock(ptr) != NULL;
+}
+
+void Arena::retire() {
+	if (_retired || !_blocks) return;
+
+	/* A skeleton data that fails to load is deleted while the reader still has its arena current, the reader's
+	 * scope restores the previous arena. */
+	if (current == this) return;
+	_retired = true;
+	_previous = current;
+	current = this;
+}
+
+Arena *Arena::getCurrent() {
+	return current;
+}
+
+ArenaScope::ArenaScope(Arena *arena) : _previous(current) {
+	current = arena;
+}
+
+ArenaScope::~ArenaScope() {
+	current = _previous;
+}
@@ -230,8 +230,11 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 											   "MipMapLinearNearest",
 											   "MipMapNearestLinear", "MipMapLinearLinear"};
 
-	int dirLength = (int) strlen(dir);
-	int needsSlash = dirLength > 0 && dir[dirLength - 1] != '/' && dir[dirLength - 1] != '\\';
+	if (isBinary(begin, length)) {
+		loadBinary(begin, length, dir, createTexture);
+		return;
+	}
+
 	AtlasInput reader(begin, length);
 	SimpleString entry[5];
 	AtlasPage *page = NULL;
@@ -252,12 +255,7 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 			page = NULL;
 			line = reader.readLine();
 		} else if (page == NULL) {
-			char *name = line->copy();
-			char *path = SpineExtension::calloc<char>(dirLength + needsSlash + strlen(name) + 1, __FILE__, __LINE__);
-			memcpy(path, dir, dirLength);
-			if (needsSlash) path[dirLength] = '/';
-			strcpy(path + dirLength + needsSlash, name);
-			page = new (__FILE__, __LINE__) AtlasPage(String(name, true));
+			page = new (__FILE__, __LINE__) AtlasPage(String(line->copy(), true));
 
 			while (true) {
 				line = reader.readLine();
@@ -280,10 +278,7 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 				}
 			}
 
-			page->index = (int) _pages.size();
-			if (createTexture && _textureLoader) _textureLoader->load(*page, String(path));
-			page->texturePath = String(path, true);
-			_pages.add(page);
+			loadPage(page, dir, createTexture);
 		} else {
 			AtlasRegion *region = new (__FILE__, __LINE__) AtlasRegion();
 			region->page = page;
@@ -348,3 +343,236 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 		}
 	}
 }
+
+void Atlas::loadPage(AtlasPage *page, const char *dir, bool createTexture) {
+	int dirLength = (int) strlen(dir);
+	int needsSlash = dirLength > 0 && dir[dirLength - 1] != '/' && dir[dirLength - 1] != '\\';
+	char *path = SpineExtension::calloc<char>(dirLength + needsSlash + page->name.length() + 1, __FILE__, __LINE__);
+	memcpy(path, dir, dirLength);
+	if (needsSlash) path[dirLength] = '/';
+	memcpy(path + dirLength + needsSlash, page->name.buffer(), page->name.length());
+
+	page->index = (int) _pages.size();
+	if (createTexture && _textureLoader) _textureLoader->load(*page, String(path));
+	page->texturePath = String(path, true);
+	_pages.add(page);
+}
+
+/* Magic and version of the binary atlas format. Integers and floats use the same encoding as skeleton binaries. */
+static const char binaryHeader[] = {0x7f, 'S', 'A', 'T', 'L', 1};
+
+struct AtlasBinaryInput {
+	const unsigned char *cursor;
+	const unsigned char *end;
+	bool overflow;
+
+	AtlasBinaryInput(const char *data, int length)
+		: cursor((const unsigned char *) data), end((const unsigned char *) data + length), overflow(false) {}
+
+	unsigned char readByte() {
+		if (cursor >= end) {
+			overflow = true;
+			return 0;
+		}
+		return *cursor++;
+	}
+
+	int readInt() {
+		int result = readByte();
+		result = (result << 8) | readByte();
+		result = (result << 8) | readByte();
+		return (result << 8) | readByte();
+	}
+
+	float readFloat() {
+		union {
+			int intValue;
+			float floatValue;
+		} intToFloat;
+		intToFloat.intValue = readInt();
+		return intToFloat.floatValue;
+	}
+
+	int readVarint(bool optimizePositive) {
+		unsigned int value = 0;
+		for (int shift = 0; shift < 35; shift += 7) {
+			unsigned char b = readByte();
+			value |= (unsigned int) (b & 0x7F) << shift;
+			if (!(b & 0x80)) break;
+		}
+		if (!optimizePositive) value = (value >> 1) ^ -(int) (value & 1);
+		return (int) value;
+	}
+
+	/* Returns a count that is checked against the remaining data, so corrupt input can't request huge buffers. */
+	int readCount() {
+		int count = readVarint(true);
+		if (count < 0 || count > end - cursor) {
+			overflow = true;
+			return 0;
+		}
+		return count;
+	}
+
+	char *readString() {
+		int length = readCount();
+		if (length == 0) return NULL;
+		char *string = SpineExtension::alloc<char>(length, __FILE__, __LINE__);
+		memcpy(string, cursor, length - 1);
+		string[length - 1] = '\0';
+		cursor += length - 1;
+		return string;
+	}
+};
+
+struct AtlasBinaryOutput {
+	Vector<unsigned char> &output;
+
+	explicit AtlasBinaryOutput(Vector<unsigned char> &output) : output(output) {}
+
+	void writeByte(unsigned char value) {
+		output.add(value);
+	}
+
+	void writeInt(int value) {
+		writeByte((unsigned char) (value >> 24));
+		writeByte((unsigned char) (value >> 16));
+		writeByte((unsigned char) (value >> 8));
+		writeByte((unsigned char) value);
+	}
+
+	void writeFloat(float value) {
+		union {
+			int intValue;
+			float floatValue;
+		} floatToInt;
+		floatToInt.floatValue = value;
+		writeInt(floatToInt.intValue);
+	}
+
+	void writeVarint(int value, bool optimizePositive) {
+		unsigned int bits = optimizePositive ? (unsigned int) value : ((unsigned int) value << 1) ^ (unsigned int) (value >> 31);
+		while (bits > 0x7F) {
+			writeByte((unsigned char) ((bits & 0x7F) | 0x80));
+			bits >>= 7;
+		}
+		writeByte((unsigned char) bits);
+	}
+
+	void writeString(const String &value) {
+		writeVarint((int) value.length() + 1, true);
+		for (size_t i = 0; i < value.length(); i++)
+			writeByte((unsigned char) value.buffer()[i]);
+	}
+};
+
+bool Atlas::isBinary(const char *data, int length) {
+	return data && length >= (int) sizeof(binaryHeader) && memcmp(data, binaryHeader, sizeof(binaryHeader) - 1) == 0;
+}
+
+void Atlas::loadBinary(const char *begin, int length, const char *dir, bool createTexture) {
+	AtlasBinaryInput input(begin + sizeof(binaryHeader), length - (int) sizeof(binaryHeader));
+	if (begin[sizeof(binaryHeader) - 1] != binaryHeader[sizeof(binaryHeader) - 1]) return;
+
+	for (int i = 0, n = input.readCount(); i < n; i++) {
+		AtlasPage *page = new (__FILE__, __LINE__) AtlasPage(String(input.readString(), true));
+		page->width = input.readVarint(true);
+		page->height = input.readVarint(true);
+		page->format = (Format) input.readByte();
+		page->minFilter = (TEXTURE_FILTER_ENUM) input.readByte();
+		page->magFilter = (TEXTURE_FILTER_ENUM) input.readByte();
+		page->uWrap = (TextureWrap) input.readByte();
+		page->vWrap = (TextureWrap) input.readByte();
+		page->pma = input.readByte() != 0;
+		int regionCount = input.readCount();
+		if (input.overflow) {
+			delete page;
+			return;
+		}
+		loadPage(page, dir, createTexture);
+
+		_regions.ensureCapacity(_regions.size() + regionCount);
+		for (int ii = 0; ii < regionCount; ii++) {
+			AtlasRegion *region = new (__FILE__, __LINE__) AtlasRegion();
+			region->page = page;
+			region->rendererObject = page->texture;
+			region->name = String(input.readString(), true);
+			region->index = input.readVarint(false);
+			region->x = input.readVarint(true);
+			region->y = input.readVarint(true);
+			region->width = input.readVarint(true);
+			region->height = input.readVarint(true);
+			region->originalWidth = input.readVarint(true);
+			region->originalHeight = input.readVarint(true);
+			region->offsetX = input.readFloat();
+			region->offsetY = input.readFloat();
+			region->degrees = input.readVarint(false);
+			region->u = input.readFloat();
+			region->v = input.readFloat();
+			region->u2 = input.readFloat();
+			region->v2 = input.readFloat();
+			for (int iii = 0, nn = input.readCount(); iii < nn; iii++)
+				region->names.add(String(input.readString(), true));
+			for (int iii = 0, nn = input.readCount(); iii < nn; iii++)
+				region->values.add(input.readVarint(false));
+			if (input.overflow) {
+				delete region;
+				return;
+			}
+			_regions.add(region);
+		}
+	}
+}
+
+void Atlas::writeBinary(Vector<unsigned char> &output) {
+	AtlasBinaryOutput out(output);
+
+	for (size_t i = 0; i < sizeof(binaryHeader); i++)
+		out.writeByte((unsigned char) binaryHeader[i]);
+
+	out.writeVarint((int) _pages.size(), true);
+	for (size_t i = 0; i < _pages.size(); i++) {
+		AtlasPage *page = _pages[i];
+		int regionCount = 0;
+		for (size_t ii = 0; ii < _regions.size(); ii++)
+			if (_regions[ii]->page == page) regionCount++;
+
+		out.writeString(page->name);
+		out.writeVarint(page->width, true);
+		out.writeVarint(page->height, true);
+		out.writeByte((unsigned char) page->format);
+		out.writeByte((unsigned char) page->minFilter);
+		out.writeByte((unsigned char) page->magFilter);
+		out.writeByte((unsigned char) page->uWrap);
+		out.writeByte((unsigned char) page->vWrap);
+		out.writeByte(page->pma ? 1 : 0);
+		out.writeVarint(regionCount, true);
+
+		for (size_t ii = 0; ii < _regions.size(); ii++) {
+			AtlasRegion *region = _regions[ii];
+			if (region->page != page) continue;
+			out.writeString(region->name);
+			out.writeVarint(region->index, false);
+			out.writeVarint(region->x, true);
+			out.writeVarint(region->y, true);
+			out.writeVarint(region->width, true);
+			out.writeVarint(region->height, true);
+			out.writeVarint(region->originalWidth, true);
+			out.writeVarint(region->originalHeight, true);
+			out.writeFloat(region->offsetX);
+			out.writeFloat(region->offsetY);
+			out.writeVarint(region->degrees, false);
+			out.writeFloat(region->u);
+			out.writeFloat(region->v);
+			out.writeFloat(region->u2);
+			out.writeFloat(region->v2);
+
+			out.writeVarint((int) region->names.size(), true);
+			for (size_t n = 0; n < region->names.size(); n++)
+				out.writeString(region->names[n]);
+			out.writeVarint((int) region->values.size(), true);
+			for (size_t n = 0; n < region->values.size(); n++)
+				out.writeVarint(region->values[n], false);
+		}
+	}
+}
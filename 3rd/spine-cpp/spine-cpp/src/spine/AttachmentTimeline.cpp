@@ -34,6 +34,7 @@
 
 #include <spine/Animation.h>
 #include <spine/Bone.h>
+#include <spine/NameIndex.h>
 #include <spine/Property.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
@@ -51,6 +52,7 @@ AttachmentTimeline::AttachmentTimeline(size_t frameCount, int slotIndex) : Timel
 	for (size_t i = 0; i < frameCount; ++i) {
 		_attachmentNames.add(String());
 	}
+	_attachmentHashes.setSize(frameCount, NameIndex::hashName(String()));
 }
 
 AttachmentTimeline::~AttachmentTimeline() {}
@@ -59,6 +61,10 @@ void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *a
 	slot.setAttachment(attachmentName == NULL || attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
 }
 
+void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName, unsigned int hash) {
+	slot.setAttachment(attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName, hash));
+}
+
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 							   MixBlend blend, MixDirection direction) {
 	SP_UNUSED(lastTime);
@@ -87,14 +93,20 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		return;
 	}
 
-	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time)]);
+	int frame = Animation::search(_frames, time, 1, skeleton.getTimelineCursor());
+	setAttachment(skeleton, *slot, &_attachmentNames[frame], _attachmentHashes[frame]);
 }
 
 void AttachmentTimeline::setFrame(int frame, float time, const String &attachmentName) {
 	_frames[frame] = time;
 	_attachmentNames[frame] = attachmentName;
+	_attachmentHashes[frame] = NameIndex::hashName(attachmentName);
 }
 
 Vector<String> &AttachmentTimeline::getAttachmentNames() {
 	return _attachmentNames;
 }
+
+Vector<unsigned int> &AttachmentTimeline::getAttachmentHashes() {
+	return _attachmentHashes;
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Property.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+static const int BAKED_PROPERTIES = Property_Rotate | Property_X | Property_Y | Property_ScaleX | Property_ScaleY |
+									Property_ShearX | Property_ShearY;
+
+static float getPoseValue(BoneLocal &pose, int property) {
+	switch (property) {
+		case Property_Rotate:
+			return pose.rotation;
+		case Property_X:
+			return pose.x;
+		case Property_Y:
+			return pose.y;
+		case Property_ScaleX:
+			return pose.scaleX;
+		case Property_ScaleY:
+			return pose.scaleY;
+		case Property_ShearX:
+			return pose.shearX;
+		default:
+			return pose.shearY;
+	}
+}
+
+static void setPoseValue(BoneLocal &pose, int property, float value) {
+	switch (property) {
+		case Property_Rotate:
+			pose.rotation = value;
+			break;
+		case Property_X:
+			pose.x = value;
+			break;
+		case Property_Y:
+			pose.y = value;
+			break;
+		case Property_ScaleX:
+			pose.scaleX = value;
+			break;
+		case Property_ScaleY:
+			pose.scaleY = value;
+			break;
+		case Property_ShearX:
+			pose.shearX = value;
+			break;
+		default:
+			pose.shearY = value;
+	}
+}
+
+BakedAnimation::BakedAnimation(SkeletonData &skeletonData, Animation &animation, float fps, bool quantize) : _fps(fps),
+																											_duration(animation.getDuration()),
+																											_frameCount(1) {
+	assert(fps > 0);
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	_baked.setSize(timelines.size(), false);
+	for (size_t i = 0; i < timelines.size(); i++) {
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		bool baked = ids.size() > 0;
+		for (size_t ii = 0; ii < ids.size() && baked; ii++)
+			baked = ((ids[ii] >> 32) & ~BAKED_PROPERTIES) == 0;
+		if (!baked) continue;
+		_baked[i] = true;
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int property = (int) (ids[ii] >> 32), bone = (int) (ids[ii] & 0xffffffff);
+			bool found = false;
+			for (size_t t = 0; t < _bones.size() && !found; t++)
+				found = _bones[t] == bone && _properties[t] == property;
+			if (found) continue;
+			_bones.add(bone);
+			_properties.add(property);
+		}
+	}
+
+	if (_duration > 0) _frameCount = (size_t) MathUtil::ceil(_duration * fps) + 1;
+	size_t trackCount = _bones.size();
+	Vector<float> samples;
+	samples.ensureCapacity(_frameCount * trackCount);
+	samples.setSize(_frameCount * trackCount, 0);
+
+	Skeleton skeleton(&skeletonData);
+	Vector<BoneLocal> &poses = skeleton.getBonePoses();
+	for (size_t frame = 0; frame < _frameCount; frame++) {
+		float time = frame == _frameCount - 1 ? _duration : frame / fps;
+		skeleton.setBonesToSetupPose();
+		for (size_t i = 0; i < timelines.size(); i++) {
+			if (_baked[i]) timelines[i]->apply(skeleton, time, time, NULL, 1, MixBlend_Setup, MixDirection_In);
+		}
+		float *row = samples.buffer() + frame * trackCount;
+		for (size_t t = 0; t < trackCount; t++)
+			row[t] = getPoseValue(poses[_bones[t]], _properties[t]);
+	}
+
+	if (!quantize) {
+		_samples.addAll(samples);
+		return;
+	}
+	_offsets.ensureCapacity(trackCount);
+	_offsets.setSize(trackCount, 0);
+	_scales.ensureCapacity(trackCount);
+	_scales.setSize(trackCount, 0);
+	_quantized.ensureCapacity(samples.size());
+	_quantized.setSize(samples.size(), 0);
+	for (size_t t = 0; t < trackCount; t++) {
+		float min = samples[t], max = samples[t];
+		for (size_t frame = 1; frame < _frameCount; frame++) {
+			float value = samples[frame * trackCount + t];
+			min = MathUtil::min(min, value);
+			max = MathUtil::max(max, value);
+		}
+		float scale = (max - min) / 65535;
+		_offsets[t] = min;
+		_scales[t] = scale;
+		if (scale == 0) continue;
+		for (size_t frame = 0; frame < _frameCount; frame++) {
+			size_t i = frame * trackCount + t;
+			_quantized[i] = (unsigned short) ((samples[i] - min) / scale + 0.5f);
+		}
+	}
+}
+
+BakedAnimation::~BakedAnimation() {
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float time) {
+	size_t frame = 0, trackCount = _bones.size();
+	float percent = 0;
+	if (_frameCount > 1) {
+		float position = time * _fps;
+		if (position >= _frameCount - 1) {
+			frame = _frameCount - 2;
+			percent = 1;
+		} else if (position > 0) {
+			frame = (size_t) position;
+			float time1 = frame / _fps, time2 = frame + 2 == _frameCount ? _duration : (frame + 1) / _fps;
+			percent = MathUtil::min(1.0f, (time - time1) / (time2 - time1));
+		}
+	}
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<BoneLocal> &poses = skeleton.getBonePoses();
+	size_t next = _frameCount > 1 ? trackCount : 0;
+	if (_quantized.size() > 0) {
+		const unsigned short *samples = _quantized.buffer() + frame * trackCount;
+		for (size_t t = 0; t < trackCount; t++) {
+			if (!bones[_bones[t]]->isActive()) continue;
+			float value1 = samples[t], value2 = samples[t + next];
+			setPoseValue(poses[_bones[t]], _properties[t],
+						 _offsets[t] + (value1 + (value2 - value1) * percent) * _scales[t]);
+		}
+	} else {
+		const float *samples = _samples.buffer() + frame * trackCount;
+		for (size_t t = 0; t < trackCount; t++) {
+			if (!bones[_bones[t]]->isActive()) continue;
+			float value1 = samples[t], value2 = samples[t + next];
+			setPoseValue(poses[_bones[t]], _properties[t], value1 + (value2 - value1) * percent);
+		}
+	}
+}
+
+bool BakedAnimation::isBaked(size_t timelineIndex) {
+	return timelineIndex < _baked.size() && _baked[timelineIndex];
+}
+
+float BakedAnimation::getFps() {
+	return _fps;
+}
+
+bool BakedAnimation::isQuantized() {
+	return _quantized.size() > 0;
+}
+
+size_t BakedAnimation::getFrameCount() {
+	return _frameCount;
+}
+
+size_t BakedAnimation::getTrackCount() {
+	return _bones.size();
+}
+
+size_t BakedAnimation::getSampleSize() {
+	return _quantized.size() * sizeof(unsigned short) + _samples.size() * sizeof(float) +
+		   (_offsets.size() + _scales.size()) * sizeof(float);
+}
@@ -50,96 +50,92 @@ Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
 															   _data(data),
 															   _skeleton(skeleton),
 															   _parent(parent),
-															   _x(0),
-															   _y(0),
-															   _rotation(0),
-															   _scaleX(0),
-															   _scaleY(0),
-															   _shearX(0),
-															   _shearY(0),
-															   _ax(0),
-															   _ay(0),
-															   _arotation(0),
-															   _ascaleX(0),
-															   _ascaleY(0),
-															   _ashearX(0),
-															   _ashearY(0),
-															   _a(1),
-															   _b(0),
-															   _worldX(0),
-															   _c(0),
-															   _d(1),
-															   _worldY(0),
+															   _local(skeleton._bonePoses[data.getIndex()]),
+															   _applied(skeleton._boneAppliedPoses[data.getIndex()]),
+															   _world(skeleton._boneWorlds[data.getIndex()]),
 															   _sorted(false),
-															   _active(false),
-															   _inherit(Inherit_Normal) {
+															   _active(false) {
 	setToSetupPose();
 }
 
 void Bone::update(Physics) {
-	updateWorldTransform(_ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY);
+	computeWorldTransform(_applied, _local.inherit, _parent ? &_parent->_world : NULL, _skeleton, _world);
 }
 
 void Bone::updateWorldTransform() {
-	updateWorldTransform(_x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY);
+	_applied = _local;
+	computeWorldTransform(_applied, _local.inherit, _parent ? &_parent->_world : NULL, _skeleton, _world);
 }
 
 void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX, float scaleY, float shearX, float shearY) {
+	_applied.x = x;
+	_applied.y = y;
+	_applied.rotation = rotation;
+	_applied.scaleX = scaleX;
+	_applied.scaleY = scaleY;
+	_applied.shearX = shearX;
+	_applied.shearY = shearY;
+	computeWorldTransform(_applied, _local.inherit, _parent ? &_parent->_world : NULL, _skeleton, _world);
+}
+
+void Bone::computeWorldTransform(const BoneLocal &applied, Inherit inherit, const BoneWorld *parent,
+								 Skeleton &skeleton, BoneWorld &world) {
 	float pa, pb, pc, pd;
-	Bone *parent = _parent;
-
-	_ax = x;
-	_ay = y;
-	_arotation = rotation;
-	_ascaleX = scaleX;
-	_ascaleY = scaleY;
-	_ashearX = shearX;
-	_ashearY = shearY;
+	float x = applied.x, y = applied.y, rotation = applied.rotation;
+	float scaleX = applied.scaleX, scaleY = applied.scaleY, shearX = applied.shearX, shearY = applied.shearY;
 
 	if (!parent) { /* Root bone. */
-		Skeleton &skeleton = this->_skeleton;
 		float sx = skeleton.getScaleX();
 		float sy = skeleton.getScaleY();
 		float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 		float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-		_a = MathUtil::cos(rx) * scaleX * sx;
-		_b = MathUtil::cos(ry) * scaleY * sx;
-		_c = MathUtil::sin(rx) * scaleX * sy;
-		_d = MathUtil::sin(ry) * scaleY * sy;
-		_worldX = x * sx + _skeleton.getX();
-		_worldY = y * sy + _skeleton.getY();
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCos(rx, sinX, cosX);
+		MathUtil::sinCos(ry, sinY, cosY);
+		world.a = cosX * scaleX * sx;
+		world.b = cosY * scaleY * sx;
+		world.c = sinX * scaleX * sy;
+		world.d = sinY * scaleY * sy;
+		world.worldX = x * sx + skeleton.getX();
+		world.worldY = y * sy + skeleton.getY();
 		return;
 	}
 
-	pa = parent->_a;
-	pb = parent->_b;
-	pc = parent->_c;
-	pd = parent->_d;
+	pa = parent->a;
+	pb = parent->b;
+	pc = parent->c;
+	pd = parent->d;
 
-	_worldX = pa * x + pb * y + parent->_worldX;
-	_worldY = pc * x + pd * y + parent->_worldY;
+	world.worldX = pa * x + pb * y + parent->worldX;
+	world.worldY = pc * x + pd * y + parent->worldY;
 
-	switch (_inherit) {
+	switch (inherit) {
 		case Inherit_Normal: {
 			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
-			_a = pa * la + pb * lc;
-			_b = pa * lb + pb * ld;
-			_c = pc * la + pd * lc;
-			_d = pc * lb + pd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
+			world.a = pa * la + pb * lc;
+			world.b = pa * lb + pb * ld;
+			world.c = pc * la + pd * lc;
+			world.d = pc * lb + pd * ld;
 			return;
 		}
 		case Inherit_OnlyTranslation: {
 			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			_a = MathUtil::cos(rx) * scaleX;
-			_b = MathUtil::cos(ry) * scaleY;
-			_c = MathUtil::sin(rx) * scaleX;
-			_d = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			world.a = cosX * scaleX;
+			world.b = cosY * scaleY;
+			world.c = sinX * scaleX;
+			world.d = sinY * scaleY;
 			break;
 		}
 		case Inherit_NoRotationOrReflection: {
@@ -147,8 +143,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			float prx;
 			if (s > 0.0001f) {
 				s = MathUtil::abs(pa * pd - pb * pc) / s;
-				pa /= _skeleton.getScaleX();
-				pc /= _skeleton.getScaleY();
+				pa /= skeleton.getScaleX();
+				pc /= skeleton.getScaleY();
 				pb = pc * s;
 				pd = pa * s;
 				prx = MathUtil::atan2Deg(pc, pa);
@@ -159,73 +155,80 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			}
 			float rx = (rotation + shearX - prx) * MathUtil::Deg_Rad;
 			float ry = (rotation + shearY - prx + 90) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
-			_a = pa * la - pb * lc;
-			_b = pa * lb - pb * ld;
-			_c = pc * la + pd * lc;
-			_d = pc * lb + pd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
+			world.a = pa * la - pb * lc;
+			world.b = pa * lb - pb * ld;
+			world.c = pc * la + pd * lc;
+			world.d = pc * lb + pd * ld;
 			break;
 		}
 		case Inherit_NoScale:
 		case Inherit_NoScaleOrReflection: {
 			rotation *= MathUtil::Deg_Rad;
-			float cosine = MathUtil::cos(rotation);
-			float sine = MathUtil::sin(rotation);
-			float za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
-			float zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
+			float cosine, sine;
+			MathUtil::sinCos(rotation, sine, cosine);
+			float za = (pa * cosine + pb * sine) / skeleton.getScaleX();
+			float zc = (pc * cosine + pd * sine) / skeleton.getScaleY();
 			float s = MathUtil::sqrt(za * za + zc * zc);
 			if (s > 0.00001f) s = 1 / s;
 			za *= s;
 			zc *= s;
 			s = MathUtil::sqrt(za * za + zc * zc);
-			if (_inherit == Inherit_NoScale &&
-				(pa * pd - pb * pc < 0) != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
+			if (inherit == Inherit_NoScale &&
+				(pa * pd - pb * pc < 0) != (skeleton.getScaleX() < 0 != skeleton.getScaleY() < 0))
 				s = -s;
 			rotation = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
-			float zb = MathUtil::cos(rotation) * s;
-			float zd = MathUtil::sin(rotation) * s;
+			MathUtil::sinCos(rotation, sine, cosine);
+			float zb = cosine * s;
+			float zd = sine * s;
 			shearX *= MathUtil::Deg_Rad;
 			shearY = (90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(shearX) * scaleX;
-			float lb = MathUtil::cos(shearY) * scaleY;
-			float lc = MathUtil::sin(shearX) * scaleX;
-			float ld = MathUtil::sin(shearY) * scaleY;
-			_a = za * la + zb * lc;
-			_b = za * lb + zb * ld;
-			_c = zc * la + zd * lc;
-			_d = zc * lb + zd * ld;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(shearX, sinX, cosX);
+			MathUtil::sinCos(shearY, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
+			world.a = za * la + zb * lc;
+			world.b = za * lb + zb * ld;
+			world.c = zc * la + zd * lc;
+			world.d = zc * lb + zd * ld;
 		}
 	}
-	_a *= _skeleton.getScaleX();
-	_b *= _skeleton.getScaleX();
-	_c *= _skeleton.getScaleY();
-	_d *= _skeleton.getScaleY();
+	world.a *= skeleton.getScaleX();
+	world.b *= skeleton.getScaleX();
+	world.c *= skeleton.getScaleY();
+	world.d *= skeleton.getScaleY();
 }
 
 void Bone::setToSetupPose() {
 	BoneData &data = _data;
-	_x = data.getX();
-	_y = data.getY();
-	_rotation = data.getRotation();
-	_scaleX = data.getScaleX();
-	_scaleY = data.getScaleY();
-	_shearX = data.getShearX();
-	_shearY = data.getShearY();
-	_inherit = data.getInherit();
+	_local.x = data.getX();
+	_local.y = data.getY();
+	_local.rotation = data.getRotation();
+	_local.scaleX = data.getScaleX();
+	_local.scaleY = data.getScaleY();
+	_local.shearX = data.getShearX();
+	_local.shearY = data.getShearY();
+	_local.inherit = data.getInherit();
 }
 
 void Bone::worldToLocal(float worldX, float worldY, float &outLocalX, float &outLocalY) {
-	float a = _a;
-	float b = _b;
-	float c = _c;
-	float d = _d;
+	float a = _world.a;
+	float b = _world.b;
+	float c = _world.c;
+	float d = _world.d;
 
 	float invDet = 1 / (a * d - b * c);
-	float x = worldX - _worldX;
-	float y = worldY - _worldY;
+	float x = worldX - _world.worldX;
+	float y = worldY - _world.worldY;
 
 	outLocalX = (x * d * invDet - y * b * invDet);
 	outLocalY = (y * a * invDet - x * c * invDet);
@@ -241,8 +244,8 @@ void Bone::worldToParent(float worldX, float worldY, float &outParentX, float &o
 }
 
 void Bone::localToWorld(float localX, float localY, float &outWorldX, float &outWorldY) {
-	outWorldX = localX * _a + localY * _b + _worldX;
-	outWorldY = localX * _c + localY * _d + _worldY;
+	outWorldX = localX * _world.a + localY * _world.b + _world.worldX;
+	outWorldY = localX * _world.c + localY * _world.d + _world.worldY;
 }
 
 void Bone::parentToWorld(float worldX, float worldY, float &outX, float &outY) {
@@ -257,37 +260,37 @@ void Bone::parentToWorld(float worldX, float worldY, float &outX, float &outY) {
 float Bone::worldToLocalRotation(float worldRotation) {
 	worldRotation *= MathUtil::Deg_Rad;
 	float sine = MathUtil::sin(worldRotation), cosine = MathUtil::cos(worldRotation);
-	return MathUtil::atan2Deg(_a * sine - _c * cosine, _d * cosine - _b * sine) + _rotation - _shearX;
+	return MathUtil::atan2Deg(_world.a * sine - _world.c * cosine, _world.d * cosine - _world.b * sine) + _local.rotation - _local.shearX;
 }
 
 float Bone::localToWorldRotation(float localRotation) {
-	localRotation = (localRotation - _rotation - _shearX) * MathUtil::Deg_Rad;
+	localRotation = (localRotation - _local.rotation - _local.shearX) * MathUtil::Deg_Rad;
 	float sine = MathUtil::sin(localRotation), cosine = MathUtil::cos(localRotation);
-	return MathUtil::atan2Deg(cosine * _c + sine * _d, cosine * _a + sine * _b);
+	return MathUtil::atan2Deg(cosine * _world.c + sine * _world.d, cosine * _world.a + sine * _world.b);
 }
 
 void Bone::rotateWorld(float degrees) {
 	degrees *= MathUtil::Deg_Rad;
 	float sine = MathUtil::sin(degrees), cosine = MathUtil::cos(degrees);
-	float ra = _a, rb = _b;
-	_a = cosine * ra - sine * _c;
-	_b = cosine * rb - sine * _d;
-	_c = sine * ra + cosine * _c;
-	_d = sine * rb + cosine * _d;
+	float ra = _world.a, rb = _world.b;
+	_world.a = cosine * ra - sine * _world.c;
+	_world.b = cosine * rb - sine * _world.d;
+	_world.c = sine * ra + cosine * _world.c;
+	_world.d = sine * rb + cosine * _world.d;
 }
 
 float Bone::getWorldToLocalRotationX() {
 	Bone *parent = _parent;
 	if (!parent) {
-		return _arotation;
+		return _applied.rotation;
 	}
 
-	float pa = parent->_a;
-	float pb = parent->_b;
-	float pc = parent->_c;
-	float pd = parent->_d;
-	float a = _a;
-	float c = _c;
+	float pa = parent->_world.a;
+	float pb = parent->_world.b;
+	float pc = parent->_world.c;
+	float pd = parent->_world.d;
+	float a = _world.a;
+	float c = _world.c;
 
 	return MathUtil::atan2(pa * c - pc * a, pd * a - pb * c) * MathUtil::Rad_Deg;
 }
@@ -295,15 +298,15 @@ float Bone::getWorldToLocalRotationX() {
 float Bone::getWorldToLocalRotationY() {
 	Bone *parent = _parent;
 	if (!parent) {
-		return _arotation;
+		return _applied.rotation;
 	}
 
-	float pa = parent->_a;
-	float pb = parent->_b;
-	float pc = parent->_c;
-	float pd = parent->_d;
-	float b = _b;
-	float d = _d;
+	float pa = parent->_world.a;
+	float pb = parent->_world.b;
+	float pc = parent->_world.c;
+	float pd = parent->_world.d;
+	float b = _world.b;
+	float d = _world.d;
 
 	return MathUtil::atan2(pa * d - pc * b, pd * b - pb * d) * MathUtil::Rad_Deg;
 }
@@ -325,207 +328,207 @@ Vector<Bone *> &Bone::getChildren() {
 }
 
 float Bone::getX() {
-	return _x;
+	return _local.x;
 }
 
 void Bone::setX(float inValue) {
-	_x = inValue;
+	_local.x = inValue;
 }
 
 float Bone::getY() {
-	return _y;
+	return _local.y;
 }
 
 void Bone::setY(float inValue) {
-	_y = inValue;
+	_local.y = inValue;
 }
 
 float Bone::getRotation() {
-	return _rotation;
+	return _local.rotation;
 }
 
 void Bone::setRotation(float inValue) {
-	_rotation = inValue;
+	_local.rotation = inValue;
 }
 
 float Bone::getScaleX() {
-	return _scaleX;
+	return _local.scaleX;
 }
 
 void Bone::setScaleX(float inValue) {
-	_scaleX = inValue;
+	_local.scaleX = inValue;
 }
 
 float Bone::getScaleY() {
-	return _scaleY;
+	return _local.scaleY;
 }
 
 void Bone::setScaleY(float inValue) {
-	_scaleY = inValue;
+	_local.scaleY = inValue;
 }
 
 float Bone::getShearX() {
-	return _shearX;
+	return _local.shearX;
 }
 
 void Bone::setShearX(float inValue) {
-	_shearX = inValue;
+	_local.shearX = inValue;
 }
 
 float Bone::getShearY() {
-	return _shearY;
+	return _local.shearY;
 }
 
 void Bone::setShearY(float inValue) {
-	_shearY = inValue;
+	_local.shearY = inValue;
 }
 
 float Bone::getAppliedRotation() {
-	return _arotation;
+	return _applied.rotation;
 }
 
 void Bone::setAppliedRotation(float inValue) {
-	_arotation = inValue;
+	_applied.rotation = inValue;
 }
 
 float Bone::getAX() {
-	return _ax;
+	return _applied.x;
 }
 
 void Bone::setAX(float inValue) {
-	_ax = inValue;
+	_applied.x = inValue;
 }
 
 float Bone::getAY() {
-	return _ay;
+	return _applied.y;
 }
 
 void Bone::setAY(float inValue) {
-	_ay = inValue;
+	_applied.y = inValue;
 }
 
 float Bone::getAScaleX() {
-	return _ascaleX;
+	return _applied.scaleX;
 }
 
 void Bone::setAScaleX(float inValue) {
-	_ascaleX = inValue;
+	_applied.scaleX = inValue;
 }
 
 float Bone::getAScaleY() {
-	return _ascaleY;
+	return _applied.scaleY;
 }
 
 void Bone::setAScaleY(float inValue) {
-	_ascaleY = inValue;
+	_applied.scaleY = inValue;
 }
 
 float Bone::getAShearX() {
-	return _ashearX;
+	return _applied.shearX;
 }
 
 void Bone::setAShearX(float inValue) {
-	_ashearX = inValue;
+	_applied.shearX = inValue;
 }
 
 float Bone::getAShearY() {
-	return _ashearY;
+	return _applied.shearY;
 }
 
 void Bone::setAShearY(float inValue) {
-	_ashearY = inValue;
+	_applied.shearY = inValue;
 }
 
 float Bone::getA() {
-	return _a;
+	return _world.a;
 }
 
 void Bone::setA(float inValue) {
-	_a = inValue;
+	_world.a = inValue;
 }
 
 float Bone::getB() {
-	return _b;
+	return _world.b;
 }
 
 void Bone::setB(float inValue) {
-	_b = inValue;
+	_world.b = inValue;
 }
 
 float Bone::getC() {
-	return _c;
+	return _world.c;
 }
 
 void Bone::setC(float inValue) {
-	_c = inValue;
+	_world.c = inValue;
 }
 
 float Bone::getD() {
-	return _d;
+	return _world.d;
 }
 
 void Bone::setD(float inValue) {
-	_d = inValue;
+	_world.d = inValue;
 }
 
 float Bone::getWorldX() {
-	return _worldX;
+	return _world.worldX;
 }
 
 void Bone::setWorldX(float inValue) {
-	_worldX = inValue;
+	_world.worldX = inValue;
 }
 
 float Bone::getWorldY() {
-	return _worldY;
+	return _world.worldY;
 }
 
 void Bone::setWorldY(float inValue) {
-	_worldY = inValue;
+	_world.worldY = inValue;
 }
 
 float Bone::getWorldRotationX() {
-	return MathUtil::atan2Deg(_c, _a);
+	return MathUtil::atan2Deg(_world.c, _world.a);
 }
 
 float Bone::getWorldRotationY() {
-	return MathUtil::atan2Deg(_d, _b);
+	return MathUtil::atan2Deg(_world.d, _world.b);
 }
 
 float Bone::getWorldScaleX() {
-	return MathUtil::sqrt(_a * _a + _c * _c);
+	return MathUtil::sqrt(_world.a * _world.a + _world.c * _world.c);
 }
 
 float Bone::getWorldScaleY() {
-	return MathUtil::sqrt(_b * _b + _d * _d);
+	return MathUtil::sqrt(_world.b * _world.b + _world.d * _world.d);
 }
 
 void Bone::updateAppliedTransform() {
 	Bone *parent = _parent;
 	if (!parent) {
-		_ax = _worldX - _skeleton.getX();
-		_ay = _worldY - _skeleton.getY();
-		_arotation = MathUtil::atan2Deg(_c, _a);
-		_ascaleX = MathUtil::sqrt(_a * _a + _c * _c);
-		_ascaleY = MathUtil::sqrt(_b * _b + _d * _d);
-		_ashearX = 0;
-		_ashearY = MathUtil::atan2Deg(_a * _b + _c * _d, _a * _d - _b * _c);
+		_applied.x = _world.worldX - _skeleton.getX();
+		_applied.y = _world.worldY - _skeleton.getY();
+		_applied.rotation = MathUtil::atan2Deg(_world.c, _world.a);
+		_applied.scaleX = MathUtil::sqrt(_world.a * _world.a + _world.c * _world.c);
+		_applied.scaleY = MathUtil::sqrt(_world.b * _world.b + _world.d * _world.d);
+		_applied.shearX = 0;
+		_applied.shearY = MathUtil::atan2Deg(_world.a * _world.b + _world.c * _world.d, _world.a * _world.d - _world.b * _world.c);
 	}
-	float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
+	float pa = parent->_world.a, pb = parent->_world.b, pc = parent->_world.c, pd = parent->_world.d;
 	float pid = 1 / (pa * pd - pb * pc);
 	float ia = pd * pid, ib = pb * pid, ic = pc * pid, id = pa * pid;
-	float dx = _worldX - parent->_worldX, dy = _worldY - parent->_worldY;
-	_ax = (dx * ia - dy * ib);
-	_ay = (dy * id - dx * ic);
+	float dx = _world.worldX - parent->_world.worldX, dy = _world.worldY - parent->_world.worldY;
+	_applied.x = (dx * ia - dy * ib);
+	_applied.y = (dy * id - dx * ic);
 
 	float ra, rb, rc, rd;
-	if (_inherit == Inherit_OnlyTranslation) {
-		ra = _a;
-		rb = _b;
-		rc = _c;
-		rd = _d;
+	if (_local.inherit == Inherit_OnlyTranslation) {
+		ra = _world.a;
+		rb = _world.b;
+		rc = _world.c;
+		rd = _world.d;
 	} else {
-		switch (_inherit) {
+		switch (_local.inherit) {
 			case Inherit_NoRotationOrReflection: {
 				float s = MathUtil::abs(pa * pd - pb * pc) / (pa * pa + pc * pc);
 				float sa = pa / _skeleton.getScaleX();
@@ -539,7 +542,7 @@ void Bone::updateAppliedTransform() {
 			}
 			case Inherit_NoScale:
 			case Inherit_NoScaleOrReflection: {
-				float r = _rotation * MathUtil::Deg_Rad;
+				float r = _local.rotation * MathUtil::Deg_Rad;
 				float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
 				pa = (pa * cos + pb * sin) / _skeleton.getScaleX();
 				pc = (pc * cos + pd * sin) / _skeleton.getScaleY();
@@ -548,7 +551,7 @@ void Bone::updateAppliedTransform() {
 				pa *= s;
 				pc *= s;
 				s = MathUtil::sqrt(pa * pa + pc * pc);
-				if (_inherit == Inherit_NoScale &&
+				if (_local.inherit == Inherit_NoScale &&
 					pid < 0 != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
 					s = -s;
 				r = MathUtil::Pi / 2 + MathUtil::atan2(pc, pa);
@@ -565,24 +568,24 @@ void Bone::updateAppliedTransform() {
 			case Inherit_OnlyTranslation:
 				break;
 		}
-		ra = ia * _a - ib * _c;
-		rb = ia * _b - ib * _d;
-		rc = id * _c - ic * _a;
-		rd = id * _d - ic * _b;
+		ra = ia * _world.a - ib * _world.c;
+		rb = ia * _world.b - ib * _world.d;
+		rc = id * _world.c - ic * _world.a;
+		rd = id * _world.d - ic * _world.b;
 	}
 
-	_ashearX = 0;
-	_ascaleX = MathUtil::sqrt(ra * ra + rc * rc);
-	if (_ascaleX > 0.0001f) {
+	_applied.shearX = 0;
+	_applied.scaleX = MathUtil::sqrt(ra * ra + rc * rc);
+	if (_applied.scaleX > 0.0001f) {
 		float det = ra * rd - rb * rc;
-		_ascaleY = det / _ascaleX;
-		_ashearY = -MathUtil::atan2Deg(ra * rb + rc * rd, det);
-		_arotation = MathUtil::atan2Deg(rc, ra);
+		_applied.scaleY = det / _applied.scaleX;
+		_applied.shearY = -MathUtil::atan2Deg(ra * rb + rc * rd, det);
+		_applied.rotation = MathUtil::atan2Deg(rc, ra);
 	} else {
-		_ascaleX = 0;
-		_ascaleY = MathUtil::sqrt(rb * rb + rd * rd);
-		_ashearY = 0;
-		_arotation = 90 - MathUtil::atan2Deg(rd, rb);
+		_applied.scaleX = 0;
+		_applied.scaleY = MathUtil::sqrt(rb * rb + rd * rd);
+		_applied.shearY = 0;
+		_applied.rotation = 90 - MathUtil::atan2Deg(rd, rb);
 	}
 }
 
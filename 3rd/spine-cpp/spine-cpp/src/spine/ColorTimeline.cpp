@@ -79,7 +79,7 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, a = 0;
-	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
 	switch (curveType) {
 		case RGBATimeline::LINEAR: {
@@ -105,11 +105,11 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 		default: {
 			r = getBezierValue(time, i, RGBATimeline::R, curveType - RGBATimeline::BEZIER);
 			g = getBezierValue(time, i, RGBATimeline::G,
-							   curveType + RGBATimeline::BEZIER_SIZE - RGBATimeline::BEZIER);
+							   curveType + _bezierSize - RGBATimeline::BEZIER);
 			b = getBezierValue(time, i, RGBATimeline::B,
-							   curveType + RGBATimeline::BEZIER_SIZE * 2 - RGBATimeline::BEZIER);
+							   curveType + _bezierSize * 2 - RGBATimeline::BEZIER);
 			a = getBezierValue(time, i, RGBATimeline::A,
-							   curveType + RGBATimeline::BEZIER_SIZE * 3 - RGBATimeline::BEZIER);
+							   curveType + _bezierSize * 3 - RGBATimeline::BEZIER);
 		}
 	}
 	Color &color = slot->_color;
@@ -168,7 +168,7 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 	}
 
 	float r = 0, g = 0, b = 0;
-	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / RGBTimeline::ENTRIES];
 	switch (curveType) {
 		case RGBTimeline::LINEAR: {
@@ -191,9 +191,9 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 		default: {
 			r = getBezierValue(time, i, RGBTimeline::R, curveType - RGBTimeline::BEZIER);
 			g = getBezierValue(time, i, RGBTimeline::G,
-							   curveType + RGBTimeline::BEZIER_SIZE - RGBTimeline::BEZIER);
+							   curveType + _bezierSize - RGBTimeline::BEZIER);
 			b = getBezierValue(time, i, RGBTimeline::B,
-							   curveType + RGBTimeline::BEZIER_SIZE * 2 - RGBTimeline::BEZIER);
+							   curveType + _bezierSize * 2 - RGBTimeline::BEZIER);
 		}
 	}
 	Color &color = slot->_color;
@@ -249,7 +249,7 @@ void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		return;
 	}
 
-	float a = getCurveValue(time);
+	float a = getCurveValue(time, skeleton.getTimelineCursor());
 	if (alpha == 1)
 		slot->_color.a = a;
 	else {
@@ -303,7 +303,7 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGBA2Timeline::LINEAR: {
@@ -338,17 +338,17 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		default: {
 			r = getBezierValue(time, i, RGBA2Timeline::R, curveType - RGBA2Timeline::BEZIER);
 			g = getBezierValue(time, i, RGBA2Timeline::G,
-							   curveType + RGBA2Timeline::BEZIER_SIZE - RGBA2Timeline::BEZIER);
+							   curveType + _bezierSize - RGBA2Timeline::BEZIER);
 			b = getBezierValue(time, i, RGBA2Timeline::B,
-							   curveType + RGBA2Timeline::BEZIER_SIZE * 2 - RGBA2Timeline::BEZIER);
+							   curveType + _bezierSize * 2 - RGBA2Timeline::BEZIER);
 			a = getBezierValue(time, i, RGBA2Timeline::A,
-							   curveType + RGBA2Timeline::BEZIER_SIZE * 3 - RGBA2Timeline::BEZIER);
+							   curveType + _bezierSize * 3 - RGBA2Timeline::BEZIER);
 			r2 = getBezierValue(time, i, RGBA2Timeline::R2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 4 - RGBA2Timeline::BEZIER);
+								curveType + _bezierSize * 4 - RGBA2Timeline::BEZIER);
 			g2 = getBezierValue(time, i, RGBA2Timeline::G2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 5 - RGBA2Timeline::BEZIER);
+								curveType + _bezierSize * 5 - RGBA2Timeline::BEZIER);
 			b2 = getBezierValue(time, i, RGBA2Timeline::B2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 6 - RGBA2Timeline::BEZIER);
+								curveType + _bezierSize * 6 - RGBA2Timeline::BEZIER);
 		}
 	}
 	Color &light = slot->_color, &dark = slot->_darkColor;
@@ -422,7 +422,7 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / RGB2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGB2Timeline::LINEAR: {
@@ -454,15 +454,15 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 		default: {
 			r = getBezierValue(time, i, RGB2Timeline::R, curveType - RGB2Timeline::BEZIER);
 			g = getBezierValue(time, i, RGB2Timeline::G,
-							   curveType + RGB2Timeline::BEZIER_SIZE - RGB2Timeline::BEZIER);
+							   curveType + _bezierSize - RGB2Timeline::BEZIER);
 			b = getBezierValue(time, i, RGB2Timeline::B,
-							   curveType + RGB2Timeline::BEZIER_SIZE * 2 - RGB2Timeline::BEZIER);
+							   curveType + _bezierSize * 2 - RGB2Timeline::BEZIER);
 			r2 = getBezierValue(time, i, RGB2Timeline::R2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 4 - RGB2Timeline::BEZIER);
+								curveType + _bezierSize * 4 - RGB2Timeline::BEZIER);
 			g2 = getBezierValue(time, i, RGB2Timeline::G2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 5 - RGB2Timeline::BEZIER);
+								curveType + _bezierSize * 5 - RGB2Timeline::BEZIER);
 			b2 = getBezierValue(time, i, RGB2Timeline::B2,
-								curveType + RGB2Timeline::BEZIER_SIZE * 6 - RGB2Timeline::BEZIER);
+								curveType + _bezierSize * 6 - RGB2Timeline::BEZIER);
 		}
 	}
 	Color &light = slot->_color, &dark = slot->_darkColor;
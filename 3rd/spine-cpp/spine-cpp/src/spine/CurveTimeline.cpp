@@ -29,6 +29,7 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
 using namespace spine;
@@ -37,8 +38,14 @@ RTTI_IMPL(CurveTimeline, Timeline)
 
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
 																									frameEntries) {
+	_curves.ensureCapacity(frameCount + bezierCount * BEZIER_SIZE);
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
+	_bezierSize = BEZIER_SIZE;
+	if (BEZIER_LUT_SIZE > 0) {
+		_bezierLut.ensureCapacity(bezierCount * BEZIER_LUT_SIZE);
+		_bezierLut.setSize(bezierCount * BEZIER_LUT_SIZE, 0);
+	}
 }
 
 CurveTimeline::~CurveTimeline() {
@@ -54,8 +61,15 @@ void CurveTimeline::setStepped(size_t frame) {
 
 void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float time1, float value1, float cx1, float cy1,
 							  float cx2, float cy2, float time2, float value2) {
-	size_t i = getFrameCount() + bezier * BEZIER_SIZE;
+	size_t i = getFrameCount() + bezier * _bezierSize;
 	if (value == 0) _curves[frame] = BEZIER + i;
+	if (_bezierSize == COMPACT_BEZIER_SIZE) {
+		_curves[i] = cx1;
+		_curves[i + 1] = cy1;
+		_curves[i + 2] = cx2;
+		_curves[i + 3] = cy2;
+		return;
+	}
 	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
 	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
 	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
@@ -71,25 +85,116 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 		x += dx;
 		y += dy;
 	}
+	setBezierLut(i - BEZIER_SIZE, time1, time2);
+}
+
+void CurveTimeline::setBezierLut(size_t i, float time1, float time2) {
+	if (BEZIER_LUT_SIZE == 0) return;
+	unsigned char *lut = _bezierLut.buffer() + (i - getFrameCount()) / BEZIER_SIZE * BEZIER_LUT_SIZE;
+	const float *curves = _curves.buffer() + i;
+	bool monotonic = time2 > time1;
+	for (int ii = 2; ii < BEZIER_SIZE && monotonic; ii += 2)
+		monotonic = curves[ii] >= curves[ii - 2];
+	if (!monotonic) {
+		// Buckets rely on the segment times being sorted, start every search at the first segment instead.
+		for (int ii = 0; ii < BEZIER_LUT_SIZE; ii++) lut[ii] = 0;
+		return;
+	}
+	int segment = 0;
+	for (int ii = 0; ii < BEZIER_LUT_SIZE; ii++) {
+		float start = time1 + (time2 - time1) * ii / BEZIER_LUT_SIZE;
+		while (segment < BEZIER_SIZE / 2 && curves[segment * 2] < start) segment++;
+		lut[ii] = (unsigned char) segment;
+	}
+}
+
+size_t CurveTimeline::searchBezier(float time, size_t i, float time1, float time2) {
+	size_t k = i, n = i + BEZIER_SIZE;
+	if (BEZIER_LUT_SIZE > 0 && time2 > time1) {
+		float p = (time - time1) / (time2 - time1) * BEZIER_LUT_SIZE;
+		int bucket = p > 0 ? (p < BEZIER_LUT_SIZE - 1 ? (int) p : BEZIER_LUT_SIZE - 1) : 0;
+		k = i + _bezierLut[(i - getFrameCount()) / BEZIER_SIZE * BEZIER_LUT_SIZE + bucket] * 2;
+		// Rounding may pick the next bucket, step back while the previous point is not before time.
+		while (k > i && _curves[k - 2] >= time) k -= 2;
+	}
+	if (k == i) {
+		if (_curves[i] > time) return i;
+		k += 2;
+	}
+	for (; k < n; k += 2)
+		if (_curves[k] >= time) return k;
+	return n;
+}
+
+float CurveTimeline::getCompactBezierValue(float time, size_t i, float time1, float value1, float time2, float value2) {
+	float duration = time2 - time1, x = time - time1;
+	if (x <= 0) return value1;
+	if (x >= duration) return value2;
+	// x(t) = ((ax * t + bx) * t + cx) * t + time1, solved for t with Newton's method, bisecting when a step leaves the
+	// bracket.
+	float cx = (_curves[i] - time1) * 3, bx = (_curves[i + 2] - _curves[i]) * 3 - cx, ax = duration - cx - bx;
+	float t = x / duration, low = 0, high = 1, epsilon = duration * 0.00001f;
+	for (int n = 0; n < 12; n++) {
+		float error = ((ax * t + bx) * t + cx) * t - x;
+		if (MathUtil::abs(error) < epsilon) break;
+		if (error > 0)
+			high = t;
+		else
+			low = t;
+		float slope = (3 * ax * t + 2 * bx) * t + cx;
+		float next = slope != 0 ? t - error / slope : low;
+		t = next > low && next < high ? next : (low + high) * 0.5f;
+	}
+	float cy = (_curves[i + 1] - value1) * 3, by = (_curves[i + 3] - _curves[i + 1]) * 3 - cy;
+	float ay = value2 - value1 - cy - by;
+	return ((ay * t + by) * t + cy) * t + value1;
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
-	if (_curves[i] > time) {
+	size_t n = i + BEZIER_SIZE;
+	size_t next = frameIndex + getFrameEntries();
+	if (_bezierSize == COMPACT_BEZIER_SIZE)
+		return getCompactBezierValue(time, i, _frames[frameIndex], _frames[frameIndex + valueOffset], _frames[next],
+									 _frames[next + valueOffset]);
+	size_t k = searchBezier(time, i, _frames[frameIndex], _frames[next]);
+	if (k == i) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
 		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
 	}
-	size_t n = i + BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-		}
+	if (k < n) {
+		float x = _curves[k - 2], y = _curves[k - 1];
+		return y + (time - x) / (_curves[k] - x) * (_curves[k + 1] - y);
 	}
-	frameIndex += getFrameEntries();
+	frameIndex = next;
 	float x = _curves[n - 2], y = _curves[n - 1];
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
+void CurveTimeline::setCompact(bool inValue) {
+	size_t frameCount = getFrameCount(), bezierCount = (_curves.size() - frameCount) / _bezierSize;
+	_bezierSize = inValue ? COMPACT_BEZIER_SIZE : BEZIER_SIZE;
+	_curves.setSize(frameCount + bezierCount * _bezierSize, 0);
+	_curves.shrinkToFit();
+	_bezierLut.clear();
+	if (!inValue && BEZIER_LUT_SIZE > 0) _bezierLut.setSize(bezierCount * BEZIER_LUT_SIZE, 0);
+	_bezierLut.shrinkToFit();
+}
+
+bool CurveTimeline::isCompact() {
+	return _bezierSize == COMPACT_BEZIER_SIZE;
+}
+
+void CurveTimeline::shrink(size_t bezierCount) {
+	size_t size = getFrameCount() + bezierCount * _bezierSize;
+	if (_curves.size() <= size) return;
+	_curves.setSize(size, 0);
+	_curves.shrinkToFit();
+	if (_bezierLut.size() > bezierCount * BEZIER_LUT_SIZE) {
+		_bezierLut.setSize(bezierCount * BEZIER_LUT_SIZE, 0);
+		_bezierLut.shrinkToFit();
+	}
+}
+
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
@@ -110,14 +215,8 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 	_frames[frame + CurveTimeline1::VALUE] = value;
 }
 
-float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+float CurveTimeline1::getCurveValue(float time, int *cursor) {
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES, cursor);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -132,7 +231,7 @@ float CurveTimeline1::getCurveValue(float time) {
 	return getBezierValue(time, i, CurveTimeline1::VALUE, curveType - CurveTimeline1::BEZIER);
 }
 
-float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup) {
+float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup, int *cursor) {
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
@@ -143,7 +242,7 @@ float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend,
 				return current;
 		}
 	}
-	float value = getCurveValue(time);
+	float value = getCurveValue(time, cursor);
 	switch (blend) {
 		case MixBlend_Setup:
 			return setup + value * alpha;
@@ -157,7 +256,7 @@ float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend,
 	return current + value * alpha;
 }
 
-float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup) {
+float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup, int *cursor) {
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
@@ -168,7 +267,7 @@ float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend,
 				return current;
 		}
 	}
-	float value = getCurveValue(time);
+	float value = getCurveValue(time, cursor);
 	if (blend == MixBlend_Setup) return setup + (value - setup) * alpha;
 	return current + (value - current) * alpha;
 }
@@ -189,7 +288,7 @@ float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend,
 }
 
 float CurveTimeline1::getScaleValue(float time, float alpha, MixBlend blend, MixDirection direction, float current,
-									float setup) {
+									float setup, int *cursor) {
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
@@ -200,7 +299,7 @@ float CurveTimeline1::getScaleValue(float time, float alpha, MixBlend blend, Mix
 				return current;
 		}
 	}
-	float value = getCurveValue(time) * setup;
+	float value = getCurveValue(time, cursor) * setup;
 	if (alpha == 1) {
 		if (blend == MixBlend_Add) return current + value - setup;
 		return value;
@@ -180,7 +180,7 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::search(frames, time);
+	int frame = Animation::search(frames, time, 1, skeleton.getTimelineCursor());
 	float percent = getCurvePercent(time, frame);
 	Vector<float> &prevVertices = vertices[frame];
 	Vector<float> &nextVertices = vertices[frame + 1];
@@ -261,8 +261,15 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 							   float cx2, float cy2, float time2, float value2) {
 	SP_UNUSED(value1);
 	SP_UNUSED(value2);
-	size_t i = getFrameCount() + bezier * DeformTimeline::BEZIER_SIZE;
+	size_t i = getFrameCount() + bezier * _bezierSize;
 	if (value == 0) _curves[frame] = DeformTimeline::BEZIER + i;
+	if (_bezierSize == DeformTimeline::COMPACT_BEZIER_SIZE) {
+		_curves[i] = cx1;
+		_curves[i + 1] = cy1;
+		_curves[i + 2] = cx2;
+		_curves[i + 3] = cy2;
+		return;
+	}
 	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = cy2 * 0.03 - cy1 * 0.06;
 	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = (cy1 - cy2 + 0.33333333) * 0.018;
 	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
@@ -278,6 +285,7 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 		x += dx;
 		y += dy;
 	}
+	setBezierLut(i - DeformTimeline::BEZIER_SIZE, time1, time2);
 }
 
 float DeformTimeline::getCurvePercent(float time, int frame) {
@@ -294,16 +302,17 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 		}
 	}
 	i -= DeformTimeline::BEZIER;
-	if (_curves[i] > time) {
+	if (_bezierSize == DeformTimeline::COMPACT_BEZIER_SIZE)
+		return getCompactBezierValue(time, i, _frames[frame], 0, _frames[frame + getFrameEntries()], 1);
+	int n = i + DeformTimeline::BEZIER_SIZE;
+	int k = (int) searchBezier(time, i, _frames[frame], _frames[frame + getFrameEntries()]);
+	if (k == i) {
 		float x = _frames[frame];
 		return _curves[i + 1] * (time - x) / (_curves[i] - x);
 	}
-	int n = i + DeformTimeline::BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-		}
+	if (k < n) {
+		float x = _curves[k - 2], y = _curves[k - 1];
+		return y + (time - x) / (_curves[k] - x) * (_curves[k + 1] - y);
 	}
 	float x = _curves[n - 2], y = _curves[n - 1];
 	return y + (1 - y) * (time - x) / (_frames[frame + getFrameEntries()] - x);
@@ -27,6 +27,7 @@
  * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
+#include <spine/Arena.h>
 #include <spine/Extension.h>
 #include <spine/SpineString.h>
 
@@ -49,6 +50,33 @@ SpineExtension *SpineExtension::getInstance() {
 	return _instance;
 }
 
+void *SpineExtension::allocate(size_t size, bool zero, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena) return arena->alloc(size, zero);
+
+	SpineExtension *extension = getInstance();
+	return zero ? extension->_calloc(size, file, line) : extension->_alloc(size, file, line);
+}
+
+void *SpineExtension::reallocate(void *ptr, size_t size, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && arena->owns(ptr)) return arena->realloc(ptr, size);
+
+	/* Memory of the instance stays with the instance. */
+	if (!ptr) return allocate(size, false, file, line);
+	return getInstance()->_realloc(ptr, size, file, line);
+}
+
+void SpineExtension::release(void *ptr, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && arena->owns(ptr)) {
+		arena->free(ptr);
+		return;
+	}
+
+	getInstance()->_free(ptr, file, line);
+}
+
 SpineExtension::~SpineExtension() {
 }
 
@@ -41,14 +41,14 @@ RTTI_IMPL(IkConstraint, Updatable)
 
 void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress, bool stretch, bool uniform, float alpha) {
 	Bone *p = bone.getParent();
-	float pa = p->_a, pb = p->_b, pc = p->_c, pd = p->_d;
-	float rotationIK = -bone._ashearX - bone._arotation;
+	float pa = p->_world.a, pb = p->_world.b, pc = p->_world.c, pd = p->_world.d;
+	float rotationIK = -bone._applied.shearX - bone._applied.rotation;
 	float tx = 0, ty = 0;
 
-	switch (bone._inherit) {
+	switch (bone._local.inherit) {
 		case Inherit_OnlyTranslation:
-			tx = (targetX - bone._worldX) * MathUtil::sign(bone.getSkeleton().getScaleX());
-			ty = (targetY - bone._worldY) * MathUtil::sign(bone.getSkeleton().getScaleY());
+			tx = (targetX - bone._world.worldX) * MathUtil::sign(bone.getSkeleton().getScaleX());
+			ty = (targetY - bone._world.worldY) * MathUtil::sign(bone.getSkeleton().getScaleY());
 			break;
 		case Inherit_NoRotationOrReflection: {
 			float s = MathUtil::abs(pa * pd - pb * pc) / MathUtil::max(0.0001f, pa * pa + pc * pc);
@@ -59,29 +59,29 @@ void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress
 			rotationIK += MathUtil::atan2Deg(sc, sa);
 		}
 		default:
-			float x = targetX - p->_worldX, y = targetY - p->_worldY;
+			float x = targetX - p->_world.worldX, y = targetY - p->_world.worldY;
 			float d = pa * pd - pb * pc;
 			if (MathUtil::abs(d) <= 0.0001f) {
 				tx = 0;
 				ty = 0;
 			} else {
-				tx = (x * pd - y * pb) / d - bone._ax;
-				ty = (y * pa - x * pc) / d - bone._ay;
+				tx = (x * pd - y * pb) / d - bone._applied.x;
+				ty = (y * pa - x * pc) / d - bone._applied.y;
 			}
 	}
 	rotationIK += MathUtil::atan2Deg(ty, tx);
-	if (bone._ascaleX < 0) rotationIK += 180;
+	if (bone._applied.scaleX < 0) rotationIK += 180;
 	if (rotationIK > 180) rotationIK -= 360;
 	else if (rotationIK < -180)
 		rotationIK += 360;
-	float sx = bone._ascaleX;
-	float sy = bone._ascaleY;
+	float sx = bone._applied.scaleX;
+	float sy = bone._applied.scaleY;
 	if (compress || stretch) {
-		switch (bone._inherit) {
+		switch (bone._local.inherit) {
 			case Inherit_NoScale:
 			case Inherit_NoScaleOrReflection:
-				tx = targetX - bone._worldX;
-				ty = targetY - bone._worldY;
+				tx = targetX - bone._world.worldX;
+				ty = targetY - bone._world.worldY;
 			default:;
 		}
 
@@ -95,8 +95,8 @@ void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress
 			}
 		}
 	}
-	bone.updateWorldTransform(bone._ax, bone._ay, bone._arotation + rotationIK * alpha, sx, sy, bone._ashearX,
-							  bone._ashearY);
+	bone.updateWorldTransform(bone._applied.x, bone._applied.y, bone._applied.rotation + rotationIK * alpha, sx, sy, bone._applied.shearX,
+							  bone._applied.shearY);
 }
 
 void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY, int bendDir, bool stretch, bool uniform,
@@ -109,14 +109,14 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	Bone *pp = parent.getParent();
 	float tx, ty, dx, dy, dd, l1, l2, a1, a2, r, td, sd, p;
 	float id, x, y;
-	if (parent._inherit != Inherit_Normal || child._inherit != Inherit_Normal) return;
-	px = parent._ax;
-	py = parent._ay;
-	psx = parent._ascaleX;
-	psy = parent._ascaleY;
+	if (parent._local.inherit != Inherit_Normal || child._local.inherit != Inherit_Normal) return;
+	px = parent._applied.x;
+	py = parent._applied.y;
+	psx = parent._applied.scaleX;
+	psy = parent._applied.scaleY;
 	sx = psx;
 	sy = psy;
-	csx = child._ascaleX;
+	csx = child._applied.scaleX;
 	if (psx < 0) {
 		psx = -psx;
 		o1 = 180;
@@ -135,36 +135,36 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	} else
 		o2 = 0;
 	r = psx - psy;
-	cx = child._ax;
+	cx = child._applied.x;
 	u = (r < 0 ? -r : r) <= 0.0001f;
 	if (!u || stretch) {
 		cy = 0;
-		cwx = parent._a * cx + parent._worldX;
-		cwy = parent._c * cx + parent._worldY;
+		cwx = parent._world.a * cx + parent._world.worldX;
+		cwy = parent._world.c * cx + parent._world.worldY;
 	} else {
-		cy = child._ay;
-		cwx = parent._a * cx + parent._b * cy + parent._worldX;
-		cwy = parent._c * cx + parent._d * cy + parent._worldY;
+		cy = child._applied.y;
+		cwx = parent._world.a * cx + parent._world.b * cy + parent._world.worldX;
+		cwy = parent._world.c * cx + parent._world.d * cy + parent._world.worldY;
 	}
-	a = pp->_a;
-	b = pp->_b;
-	c = pp->_c;
-	d = pp->_d;
+	a = pp->_world.a;
+	b = pp->_world.b;
+	c = pp->_world.c;
+	d = pp->_world.d;
 	id = a * d - b * c;
 	id = MathUtil::abs(id) <= 0.0001f ? 0 : 1 / id;
-	x = cwx - pp->_worldX;
-	y = cwy - pp->_worldY;
+	x = cwx - pp->_world.worldX;
+	y = cwy - pp->_world.worldY;
 	dx = (x * d - y * b) * id - px;
 	dy = (y * a - x * c) * id - py;
 	l1 = MathUtil::sqrt(dx * dx + dy * dy);
 	l2 = child._data.getLength() * csx;
 	if (l1 < 0.0001) {
 		apply(parent, targetX, targetY, false, stretch, false, alpha);
-		child.updateWorldTransform(cx, cy, 0, child._ascaleX, child._ascaleY, child._ashearX, child._ashearY);
+		child.updateWorldTransform(cx, cy, 0, child._applied.scaleX, child._applied.scaleY, child._applied.shearX, child._applied.shearY);
 		return;
 	}
-	x = targetX - pp->_worldX;
-	y = targetY - pp->_worldY;
+	x = targetX - pp->_world.worldX;
+	y = targetY - pp->_world.worldY;
 	tx = (x * d - y * b) * id - px;
 	ty = (y * a - x * c) * id - py;
 	dd = tx * tx + ty * ty;
@@ -253,17 +253,17 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	}
 break_outer : {
 	float os = MathUtil::atan2(cy, cx) * s2;
-	a1 = (a1 - os) * MathUtil::Rad_Deg + o1 - parent._arotation;
+	a1 = (a1 - os) * MathUtil::Rad_Deg + o1 - parent._applied.rotation;
 	if (a1 > 180) a1 -= 360;
 	else if (a1 < -180)
 		a1 += 360;
-	parent.updateWorldTransform(px, py, parent._arotation + a1 * alpha, sx, sy, 0, 0);
-	a2 = ((a2 + os) * MathUtil::Rad_Deg - child._ashearX) * s2 + o2 - child._arotation;
+	parent.updateWorldTransform(px, py, parent._applied.rotation + a1 * alpha, sx, sy, 0, 0);
+	a2 = ((a2 + os) * MathUtil::Rad_Deg - child._applied.shearX) * s2 + o2 - child._applied.rotation;
 	if (a2 > 180) a2 -= 360;
 	else if (a2 < -180)
 		a2 += 360;
-	child.updateWorldTransform(cx, cy, child._arotation + a2 * alpha, child._ascaleX, child._ascaleY,
-							   child._ashearX, child._ashearY);
+	child.updateWorldTransform(cx, cy, child._applied.rotation + a2 * alpha, child._applied.scaleX, child._applied.scaleY,
+							   child._applied.shearX, child._applied.shearY);
 }
 }
 
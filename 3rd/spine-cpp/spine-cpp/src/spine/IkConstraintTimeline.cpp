@@ -80,7 +80,7 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
 	}
 
 	float mix = 0, softness = 0;
-	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / IkConstraintTimeline::ENTRIES];
 	switch (curveType) {
 		case IkConstraintTimeline::LINEAR: {
@@ -100,7 +100,7 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
 		default: {
 			mix = getBezierValue(time, i, IkConstraintTimeline::MIX, curveType - IkConstraintTimeline::BEZIER);
 			softness = getBezierValue(time, i, IkConstraintTimeline::SOFTNESS,
-									  curveType + IkConstraintTimeline::BEZIER_SIZE -
+									  curveType + _bezierSize -
 											  IkConstraintTimeline::BEZIER);
 		}
 	}
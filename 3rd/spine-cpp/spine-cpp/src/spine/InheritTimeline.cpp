@@ -73,9 +73,9 @@ void InheritTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vect
 	}
 
 	if (time < _frames[0]) {
-		if (blend == MixBlend_Setup || blend == MixBlend_First) bone->_inherit = bone->_data.getInherit();
+		if (blend == MixBlend_Setup || blend == MixBlend_First) bone->_local.inherit = bone->_data.getInherit();
 		return;
 	}
-	int idx = Animation::search(_frames, time, ENTRIES) + INHERIT;
-	bone->_inherit = static_cast<Inherit>(_frames[idx]);
+	int idx = Animation::search(_frames, time, ENTRIES, skeleton.getTimelineCursor()) + INHERIT;
+	bone->_local.inherit = static_cast<Inherit>(_frames[idx]);
 }
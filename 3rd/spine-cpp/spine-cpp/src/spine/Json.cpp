@@ -125,6 +125,20 @@ Json::Json(const char *value) : _next(NULL),
 	}
 }
 
+Json *Json::parse(const char *value, const char *deferName, const char **deferred) {
+	Json *item = new (__FILE__, __LINE__) Json(NULL);
+
+	*deferred = NULL;
+	value = skip(value);
+	value = *value == '{' ? parseObject(item, value, deferName, deferred) : parseValue(item, value);
+	if (!value) {
+		delete item;
+		return NULL;
+	}
+
+	return item;
+}
+
 Json::~Json() {
 	spine::Json *curr = NULL;
 	spine::Json *next = _child;
@@ -337,10 +351,18 @@ const char *Json::parseString(Json *item, const char *str) {
 	return ptr;
 }
 
+/* Exactly representable powers of ten. */
+static const double powersOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+									1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
 const char *Json::parseNumber(Json *item, const char *num) {
-	double result = 0.0;
+	/* The significant digits are collected in an integer and scaled once, which is exact for the short numbers
+	 * written by the editor and avoids a pow() call per number. */
+	unsigned long long mantissa = 0;
+	int digits = 0, scale = 0;
 	int negative = 0;
-	char *ptr = (char *) num;
+	const char *ptr = num;
+	double result;
 
 	if (*ptr == '-') {
 		negative = -1;
@@ -348,29 +370,30 @@ const char *Json::parseNumber(Json *item, const char *num) {
 	}
 
 	while (*ptr >= '0' && *ptr <= '9') {
-		result = result * 10.0 + (*ptr - '0');
+		if (digits < 19) {
+			mantissa = mantissa * 10 + (*ptr - '0');
+			if (mantissa) digits++;
+		} else {
+			scale++;
+		}
 		++ptr;
 	}
 
 	if (*ptr == '.') {
-		double fraction = 0.0;
-		int n = 0;
 		++ptr;
 
 		while (*ptr >= '0' && *ptr <= '9') {
-			fraction = (fraction * 10.0) + (*ptr - '0');
+			if (digits < 19) {
+				mantissa = mantissa * 10 + (*ptr - '0');
+				if (mantissa) digits++;
+				scale--;
+			}
 			++ptr;
-			++n;
 		}
-		result += fraction / pow(10.0, n);
-	}
-
-	if (negative) {
-		result = -result;
 	}
 
 	if (*ptr == 'e' || *ptr == 'E') {
-		double exponent = 0;
+		int exponent = 0;
 		int expNegative = 0;
 		++ptr;
 
@@ -382,15 +405,22 @@ const char *Json::parseNumber(Json *item, const char *num) {
 		}
 
 		while (*ptr >= '0' && *ptr <= '9') {
-			exponent = (exponent * 10.0) + (*ptr - '0');
+			if (exponent < 10000) exponent = exponent * 10 + (*ptr - '0');
 			++ptr;
 		}
 
-		if (expNegative) {
-			result = result / pow(10, exponent);
-		} else {
-			result = result * pow(10, exponent);
-		}
+		scale += expNegative ? -exponent : exponent;
+	}
+
+	result = (double) mantissa;
+	if (scale < 0) {
+		result = -scale < 23 ? result / powersOf10[-scale] : result / pow(10.0, -scale);
+	} else if (scale > 0) {
+		result = scale < 23 ? result * powersOf10[scale] : result * pow(10.0, scale);
+	}
+
+	if (negative) {
+		result = -result;
 	}
 
 	if (ptr != num) {
@@ -462,8 +492,8 @@ const char *Json::parseArray(Json *item, const char *value) {
 }
 
 /* Build an object from the text. */
-const char *Json::parseObject(Json *item, const char *value) {
-	Json *child;
+const char *Json::parseObject(Json *item, const char *value, const char *deferName, const char **deferred) {
+	Json *child = NULL;
 
 #ifdef SPINE_JSON_DEBUG /* unnecessary, only callsite (parse_value) verifies this */
 	if (*value != '{') {
@@ -478,54 +508,43 @@ const char *Json::parseObject(Json *item, const char *value) {
 		return value + 1; /* empty array. */
 	}
 
-	item->_child = child = new (__FILE__, __LINE__) Json(NULL);
-	if (!item->_child) {
-		return NULL;
-	}
-	value = skip(parseString(child, skip(value)));
-	if (!value) {
-		return NULL;
-	}
-	child->_name = child->_valueString;
-	child->_valueString = 0;
-	if (*value != ':') {
-		_error = value;
-		return NULL;
-	} /* fail! */
-
-	value = skip(parseValue(child, skip(value + 1))); /* skip any spacing, get the value. */
-	if (!value) {
-		return NULL;
-	}
-
-	item->_size = 1;
-
-	while (*value == ',') {
+	while (true) {
 		Json *new_item = new (__FILE__, __LINE__) Json(NULL);
 		if (!new_item) {
 			return NULL; /* memory fail */
 		}
-		child->_next = new_item;
+		value = parseName(new_item, value);
+		if (!value) {
+			delete new_item;
+			return NULL; /* not a name, or no ':' after it. */
+		}
+
+		if (deferName && !*deferred && !json_strcasecmp(new_item->_name, deferName)) {
+			/* Leave the member out of the tree, the caller parses its text later. */
+			*deferred = value;
+			value = skip(skipValue(value));
+			delete new_item;
+		} else {
+			if (child) {
+				child->_next = new_item;
+			} else {
+				item->_child = new_item;
+			}
 #if SPINE_JSON_HAVE_PREV
-		new_item->prev = child;
+			new_item->_prev = child;
 #endif
-		child = new_item;
-		value = skip(parseString(child, skip(value + 1)));
-		if (!value) {
-			return NULL;
+			child = new_item;
+			item->_size++;
+			value = skip(parseValue(child, value)); /* skip any spacing, get the value. */
 		}
-		child->_name = child->_valueString;
-		child->_valueString = 0;
-		if (*value != ':') {
-			_error = value;
-			return NULL;
-		} /* fail! */
 
-		value = skip(parseValue(child, skip(value + 1))); /* skip any spacing, get the value. */
 		if (!value) {
 			return NULL;
 		}
-		item->_size++;
+		if (*value != ',') {
+			break;
+		}
+		value = skip(value + 1);
 	}
 
 	if (*value == '}') {
@@ -537,6 +556,70 @@ const char *Json::parseObject(Json *item, const char *value) {
 	return NULL; /* malformed. */
 }
 
+const char *Json::parseName(Json *item, const char *value) {
+	value = skip(parseString(item, skip(value)));
+	if (!value) {
+		return NULL;
+	}
+	item->_name = item->_valueString;
+	item->_valueString = 0;
+	if (*value != ':') {
+		_error = value;
+		return NULL;
+	} /* fail! */
+
+	return skip(value + 1);
+}
+
+const char *Json::skipValue(const char *value) {
+	int depth = 0;
+
+	do {
+		value = skip(value);
+		switch (*value) {
+			case '\"':
+				for (value++; *value != '\"'; value++) {
+					if (!*value) {
+						_error = value;
+						return NULL;
+					}
+					if (*value == '\\' && value[1]) {
+						value++;
+					}
+				}
+				value++;
+				break;
+			case '[': /* fallthrough */
+			case '{':
+				depth++;
+				value++;
+				break;
+			case ']': /* fallthrough */
+			case '}':
+				if (--depth < 0) {
+					_error = value;
+					return NULL;
+				}
+				value++;
+				break;
+			case ',': /* fallthrough */
+			case ':':
+				value++;
+				break;
+			case '\0':
+				_error = value;
+				return NULL;
+			default:
+				while ((unsigned char) *value > 32 && *value != ',' && *value != ']' && *value != '}') {
+					value++;
+				}
+				break;
+		}
+	} while (depth > 0);
+
+	return value;
+}
+
 int Json::json_strcasecmp(const char *s1, const char *s2) {
 	/* TODO we may be able to elide these NULL checks if we can prove
 	 * the graph and input (only callsite is Json_getItem) should not have NULLs
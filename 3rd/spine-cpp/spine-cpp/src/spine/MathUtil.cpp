@@ -45,6 +45,47 @@ const float MathUtil::InvPi_2 = 1 / MathUtil::Pi_2;
 const float MathUtil::Deg_Rad = (3.1415926535897932385f / 180.0f);
 const float MathUtil::Rad_Deg = (180.0f / 3.1415926535897932385f);
 
+#ifdef SPINE_FAST_TRIG
+static bool _fastTrig = true;
+#else
+static bool _fastTrig = false;
+#endif
+
+/// Beyond this the float quadrant reduction loses too many bits, libm is used instead.
+static const float FAST_TRIG_MAX_RADIANS = 100000.0f;
+
+/// Polynomial sincos: reduces to [-Pi/4, Pi/4] with a three part Cody-Waite split of Pi/2, then evaluates Taylor
+/// polynomials whose truncation error (< 2e-9) is below float rounding.
+static inline void fastSinCos(float radians, float &outSin, float &outCos) {
+	float q = radians * 0.63661977236758134308f;
+	int quadrant = (int) (q < 0 ? q - 0.5f : q + 0.5f);
+	float k = (float) quadrant;
+	float r = radians - k * 1.5703125f;
+	r -= k * 4.837512969970703125e-4f;
+	r -= k * 7.549789954891882e-8f;
+	float r2 = r * r;
+	float s = r + r * r2 * (-1.6666666666666666e-1f + r2 * (8.3333333333333332e-3f + r2 * (-1.9841269841269841e-4f + r2 * 2.7557319223985893e-6f)));
+	float c = 1 + r2 * (-0.5f + r2 * (4.1666666666666664e-2f + r2 * (-1.3888888888888889e-3f + r2 * (2.4801587301587302e-5f + r2 * -2.7557319223985888e-7f))));
+	switch (quadrant & 3) {
+		case 0:
+			outSin = s;
+			outCos = c;
+			break;
+		case 1:
+			outSin = c;
+			outCos = -s;
+			break;
+		case 2:
+			outSin = -s;
+			outCos = -c;
+			break;
+		default:
+			outSin = -c;
+			outCos = s;
+			break;
+	}
+}
+
 float MathUtil::abs(float v) {
 	return ((v) < 0 ? -(v) : (v));
 }
@@ -74,14 +115,41 @@ float MathUtil::atan2Deg(float y, float x) {
 
 /// Returns the cosine in radians from a lookup table.
 float MathUtil::cos(float radians) {
+	if (_fastTrig && radians > -FAST_TRIG_MAX_RADIANS && radians < FAST_TRIG_MAX_RADIANS) {
+		float s, c;
+		fastSinCos(radians, s, c);
+		return c;
+	}
 	return (float) ::cos(radians);
 }
 
 /// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
+	if (_fastTrig && radians > -FAST_TRIG_MAX_RADIANS && radians < FAST_TRIG_MAX_RADIANS) {
+		float s, c;
+		fastSinCos(radians, s, c);
+		return s;
+	}
 	return (float) ::sin(radians);
 }
 
+void MathUtil::sinCos(float radians, float &outSin, float &outCos) {
+	if (_fastTrig && radians > -FAST_TRIG_MAX_RADIANS && radians < FAST_TRIG_MAX_RADIANS) {
+		fastSinCos(radians, outSin, outCos);
+		return;
+	}
+	outSin = (float) ::sin(radians);
+	outCos = (float) ::cos(radians);
+}
+
+void MathUtil::setFastTrig(bool enabled) {
+	_fastTrig = enabled;
+}
+
+bool MathUtil::isFastTrig() {
+	return _fastTrig;
+}
+
 float MathUtil::sqrt(float v) {
 	return (float) ::sqrt(v);
 }
@@ -92,12 +160,12 @@ float MathUtil::acos(float v) {
 
 /// Returns the sine in radians from a lookup table.
 float MathUtil::sinDeg(float degrees) {
-	return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	return MathUtil::sin(degrees * MathUtil::Deg_Rad);
 }
 
 /// Returns the cosine in radians from a lookup table.
 float MathUtil::cosDeg(float degrees) {
-	return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	return MathUtil::cos(degrees * MathUtil::Deg_Rad);
 }
 
 bool MathUtil::isNan(float v) {
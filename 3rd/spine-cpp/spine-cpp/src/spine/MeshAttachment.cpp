@@ -168,6 +168,7 @@ void MeshAttachment::setParentMesh(MeshAttachment *inValue) {
 		_bones.clearAndAddAll(inValue->_bones);
 		_vertices.clearAndAddAll(inValue->_vertices);
 		_worldVerticesLength = inValue->_worldVerticesLength;
+		_weightLayout.build(_bones, _vertices);
 		_regionUVs.clearAndAddAll(inValue->_regionUVs);
 		_triangles.clearAndAddAll(inValue->_triangles);
 		_hullLength = inValue->_hullLength;
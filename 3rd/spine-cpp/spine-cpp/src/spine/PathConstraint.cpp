@@ -91,8 +91,8 @@ void PathConstraint::update(Physics) {
 					Bone *boneP = _bones[i];
 					Bone &bone = *boneP;
 					float setupLength = bone._data.getLength();
-					float x = setupLength * bone._a;
-					float y = setupLength * bone._c;
+					float x = setupLength * bone._world.a;
+					float y = setupLength * bone._world.c;
 					_lengths[i] = MathUtil::sqrt(x * x + y * y);
 				}
 			}
@@ -111,7 +111,7 @@ void PathConstraint::update(Physics) {
 					if (scale) _lengths[i] = 0;
 					_spaces[++i] = spacing;
 				} else {
-					float x = setupLength * bone._a, y = setupLength * bone._c;
+					float x = setupLength * bone._world.a, y = setupLength * bone._world.c;
 					float length = MathUtil::sqrt(x * x + y * y);
 					if (scale) _lengths[i] = length;
 					_spaces[++i] = length;
@@ -136,7 +136,7 @@ void PathConstraint::update(Physics) {
 					if (scale) _lengths[i] = 0;
 					_spaces[++i] = spacing;
 				} else {
-					float x = setupLength * bone._a, y = setupLength * bone._c;
+					float x = setupLength * bone._world.a, y = setupLength * bone._world.c;
 					float length = MathUtil::sqrt(x * x + y * y);
 					if (scale) _lengths[i] = length;
 					_spaces[++i] = (lengthSpacing ? setupLength + spacing : spacing) * length / setupLength;
@@ -161,8 +161,8 @@ void PathConstraint::update(Physics) {
 	for (size_t i = 0, p = 3; i < boneCount; i++, p += 3) {
 		Bone *boneP = _bones[i];
 		Bone &bone = *boneP;
-		bone._worldX += (boneX - bone._worldX) * mixX;
-		bone._worldY += (boneY - bone._worldY) * mixY;
+		bone._world.worldX += (boneX - bone._world.worldX) * mixX;
+		bone._world.worldY += (boneY - bone._world.worldY) * mixY;
 		float x = positions[p];
 		float y = positions[p + 1];
 		float dx = x - boneX;
@@ -171,8 +171,8 @@ void PathConstraint::update(Physics) {
 			float length = _lengths[i];
 			if (length >= PathConstraint::EPSILON) {
 				float s = (MathUtil::sqrt(dx * dx + dy * dy) / length - 1) * mixRotate + 1;
-				bone._a *= s;
-				bone._c *= s;
+				bone._world.a *= s;
+				bone._world.c *= s;
 			}
 		}
 
@@ -180,7 +180,7 @@ void PathConstraint::update(Physics) {
 		boneY = y;
 
 		if (mixRotate > 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d, r, cos, sin;
+			float a = bone._world.a, b = bone._world.b, c = bone._world.c, d = bone._world.d, r, cos, sin;
 			if (tangents)
 				r = positions[p - 1];
 			else if (_spaces[i + 1] < PathConstraint::EPSILON)
@@ -207,10 +207,10 @@ void PathConstraint::update(Physics) {
 			r *= mixRotate;
 			cos = MathUtil::cos(r);
 			sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._world.a = cos * a - sin * c;
+			bone._world.b = cos * b - sin * d;
+			bone._world.c = sin * a + cos * c;
+			bone._world.d = sin * b + cos * d;
 		}
 
 		bone.updateAppliedTransform();
@@ -78,7 +78,7 @@ void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float
 	}
 
 	float rotate, x, y;
-	int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i >> 2];
 	switch (curveType) {
 		case LINEAR: {
@@ -100,8 +100,8 @@ void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float
 		}
 		default: {
 			rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
-			x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
-			y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
+			x = getBezierValue(time, i, X, curveType + _bezierSize - BEZIER);
+			y = getBezierValue(time, i, Y, curveType + _bezierSize * 2 - BEZIER);
 		}
 	}
 
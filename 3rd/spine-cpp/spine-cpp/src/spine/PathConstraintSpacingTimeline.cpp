@@ -60,5 +60,5 @@ void PathConstraintSpacingTimeline::apply(Skeleton &skeleton, float lastTime, fl
 
 	PathConstraint *constraint = skeleton._pathConstraints[_pathConstraintIndex];
 	if (constraint->_active)
-		constraint->_spacing = getAbsoluteValue(time, alpha, blend, constraint->_spacing, constraint->_data._spacing);
+		constraint->_spacing = getAbsoluteValue(time, alpha, blend, constraint->_spacing, constraint->_data._spacing, skeleton.getTimelineCursor());
 }
@@ -328,7 +328,7 @@ void PhysicsConstraint::update(Physics physics) {
 			_remaining += delta;
 			_lastTime = _skeleton.getTime();
 
-			float bx = bone->_worldX, by = bone->_worldY;
+			float bx = bone->_world.worldX, by = bone->_world.worldY;
 			if (_reset) {
 				_reset = false;
 				_ux = bx;
@@ -367,13 +367,13 @@ void PhysicsConstraint::update(Physics physics) {
 							a -= t;
 						} while (a >= t);
 					}
-					if (x) bone->_worldX += _xOffset * mix * _data._x;
-					if (y) bone->_worldY += _yOffset * mix * _data._y;
+					if (x) bone->_world.worldX += _xOffset * mix * _data._x;
+					if (y) bone->_world.worldY += _yOffset * mix * _data._y;
 				}
 
 				if (rotateOrShearX || scaleX) {
-					float ca = MathUtil::atan2(bone->_c, bone->_a), c, s, mr = 0;
-					float dx = _cx - bone->_worldX, dy = _cy - bone->_worldY;
+					float ca = MathUtil::atan2(bone->_world.c, bone->_world.a), c, s, mr = 0;
+					float dx = _cx - bone->_world.worldX, dy = _cy - bone->_world.worldY;
 					if (dx > qx)
 						dx = qx;
 					else if (dx < -qx)//
@@ -426,13 +426,13 @@ void PhysicsConstraint::update(Physics physics) {
 				_remaining = a;
 			}
 
-			_cx = bone->_worldX;
-			_cy = bone->_worldY;
+			_cx = bone->_world.worldX;
+			_cy = bone->_world.worldY;
 			break;
 		}
 		case Physics::Physics_Pose: {
-			if (x) bone->_worldX += _xOffset * mix * _data._x;
-			if (y) bone->_worldY += _yOffset * mix * _data._y;
+			if (x) bone->_world.worldX += _xOffset * mix * _data._x;
+			if (y) bone->_world.worldY += _yOffset * mix * _data._y;
 			break;
 		}
 	}
@@ -445,36 +445,36 @@ void PhysicsConstraint::update(Physics physics) {
 				r = o * _data._rotate;
 				s = MathUtil::sin(r);
 				c = MathUtil::cos(r);
-				a = bone->_b;
-				bone->_b = c * a - s * bone->_d;
-				bone->_d = s * a + c * bone->_d;
+				a = bone->_world.b;
+				bone->_world.b = c * a - s * bone->_world.d;
+				bone->_world.d = s * a + c * bone->_world.d;
 			}
 			r += o * _data._shearX;
 			s = MathUtil::sin(r);
 			c = MathUtil::cos(r);
-			a = bone->_a;
-			bone->_a = c * a - s * bone->_c;
-			bone->_c = s * a + c * bone->_c;
+			a = bone->_world.a;
+			bone->_world.a = c * a - s * bone->_world.c;
+			bone->_world.c = s * a + c * bone->_world.c;
 		} else {
 			o *= _data._rotate;
 			s = MathUtil::sin(o);
 			c = MathUtil::cos(o);
-			a = bone->_a;
-			bone->_a = c * a - s * bone->_c;
-			bone->_c = s * a + c * bone->_c;
-			a = bone->_b;
-			bone->_b = c * a - s * bone->_d;
-			bone->_d = s * a + c * bone->_d;
+			a = bone->_world.a;
+			bone->_world.a = c * a - s * bone->_world.c;
+			bone->_world.c = s * a + c * bone->_world.c;
+			a = bone->_world.b;
+			bone->_world.b = c * a - s * bone->_world.d;
+			bone->_world.d = s * a + c * bone->_world.d;
 		}
 	}
 	if (scaleX) {
 		float s = 1 + _scaleOffset * mix * _data._scaleX;
-		bone->_a *= s;
-		bone->_c *= s;
+		bone->_world.a *= s;
+		bone->_world.c *= s;
 	}
 	if (physics != Physics::Physics_Pose) {
-		_tx = l * bone->_a;
-		_ty = l * bone->_c;
+		_tx = l * bone->_world.a;
+		_ty = l * bone->_world.c;
 	}
 	bone->updateAppliedTransform();
 }
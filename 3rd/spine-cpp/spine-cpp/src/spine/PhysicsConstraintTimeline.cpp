@@ -61,7 +61,7 @@ PhysicsConstraintTimeline::PhysicsConstraintTimeline(size_t frameCount, size_t b
 void PhysicsConstraintTimeline::apply(Skeleton &skeleton, float, float time, Vector<Event *> *,
 									  float alpha, MixBlend blend, MixDirection) {
 	if (_constraintIndex == -1) {
-		float value = time >= _frames[0] ? getCurveValue(time) : 0;
+		float value = time >= _frames[0] ? getCurveValue(time, skeleton.getTimelineCursor()) : 0;
 
 		Vector<PhysicsConstraint *> &physicsConstraints = skeleton.getPhysicsConstraints();
 		for (size_t i = 0; i < physicsConstraints.size(); i++) {
@@ -71,7 +71,7 @@ void PhysicsConstraintTimeline::apply(Skeleton &skeleton, float, float time, Vec
 		}
 	} else {
 		PhysicsConstraint *constraint = skeleton.getPhysicsConstraints()[_constraintIndex];
-		if (constraint->_active) set(constraint, getAbsoluteValue(time, alpha, blend, get(constraint), setup(constraint)));
+		if (constraint->_active) set(constraint, getAbsoluteValue(time, alpha, blend, get(constraint), setup(constraint), skeleton.getTimelineCursor()));
 	}
 }
 
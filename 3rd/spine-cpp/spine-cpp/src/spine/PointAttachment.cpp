@@ -46,8 +46,8 @@ void PointAttachment::computeWorldPosition(Bone &bone, float &ox, float &oy) {
 
 float PointAttachment::computeWorldRotation(Bone &bone) {
 	float r = _rotation * MathUtil::Deg_Rad, cosine = MathUtil::cos(r), sine = MathUtil::sin(r);
-	float x = cosine * bone._a + sine * bone._b;
-	float y = cosine * bone._c + sine * bone._d;
+	float x = cosine * bone._world.a + sine * bone._world.b;
+	float y = cosine * bone._world.c + sine * bone._world.d;
 	return MathUtil::atan2Deg(y, x);
 }
 
@@ -31,6 +31,7 @@
 
 #include <spine/Bone.h>
 #include <spine/Slot.h>
+#include <spine/VertexTransform.h>
 
 #include <assert.h>
 
@@ -138,30 +139,11 @@ void RegionAttachment::computeWorldVertices(Slot &slot, float *worldVertices, si
 	Bone &bone = slot.getBone();
 	float x = bone.getWorldX(), y = bone.getWorldY();
 	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
-	float offsetX, offsetY;
-
-	offsetX = _vertexOffset[BRX];
-	offsetY = _vertexOffset[BRY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// br
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[BLX];
-	offsetY = _vertexOffset[BLY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// bl
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[ULX];
-	offsetY = _vertexOffset[ULY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// ul
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[URX];
-	offsetY = _vertexOffset[URY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// ur
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	float *vertexOffset = _vertexOffset.buffer();
+
+	// br first, followed by bl, ul and ur which are stored in this order.
+	VertexTransform::transform(vertexOffset + BRX, 1, a, b, c, d, x, y, worldVertices + offset, stride);
+	VertexTransform::transform(vertexOffset + BLX, 3, a, b, c, d, x, y, worldVertices + offset + stride, stride);
 }
 
 float RegionAttachment::getX() {
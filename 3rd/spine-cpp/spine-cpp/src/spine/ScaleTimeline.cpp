@@ -62,12 +62,12 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_scaleX = bone->_data._scaleX;
-				bone->_scaleY = bone->_data._scaleY;
+				bone->_local.scaleX = bone->_data._scaleX;
+				bone->_local.scaleY = bone->_data._scaleY;
 				return;
 			case MixBlend_First:
-				bone->_scaleX += (bone->_data._scaleX - bone->_scaleX) * alpha;
-				bone->_scaleY += (bone->_data._scaleY - bone->_scaleY) * alpha;
+				bone->_local.scaleX += (bone->_data._scaleX - bone->_local.scaleX) * alpha;
+				bone->_local.scaleY += (bone->_data._scaleY - bone->_local.scaleY) * alpha;
 			default: {
 			}
 		}
@@ -75,7 +75,7 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -95,7 +95,7 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		default: {
 			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
 			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
+							   curveType + _bezierSize - CurveTimeline2::BEZIER);
 		}
 	}
 	x *= bone->_data._scaleX;
@@ -103,11 +103,11 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 
 	if (alpha == 1) {
 		if (blend == MixBlend_Add) {
-			bone->_scaleX += x - bone->_data._scaleX;
-			bone->_scaleY += y - bone->_data._scaleY;
+			bone->_local.scaleX += x - bone->_data._scaleX;
+			bone->_local.scaleY += y - bone->_data._scaleY;
 		} else {
-			bone->_scaleX = x;
-			bone->_scaleY = y;
+			bone->_local.scaleX = x;
+			bone->_local.scaleY = y;
 		}
 	} else {
 		float bx, by;
@@ -116,38 +116,38 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 				case MixBlend_Setup:
 					bx = bone->_data._scaleX;
 					by = bone->_data._scaleY;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					bone->_local.scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_local.scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = bone->_scaleX;
-					by = bone->_scaleY;
-					bone->_scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
-					bone->_scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
+					bx = bone->_local.scaleX;
+					by = bone->_local.scaleY;
+					bone->_local.scaleX = bx + (MathUtil::abs(x) * MathUtil::sign(bx) - bx) * alpha;
+					bone->_local.scaleY = by + (MathUtil::abs(y) * MathUtil::sign(by) - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_local.scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_local.scaleY += (y - bone->_data._scaleY) * alpha;
 			}
 		} else {
 			switch (blend) {
 				case MixBlend_Setup:
 					bx = MathUtil::abs(bone->_data._scaleX) * MathUtil::sign(x);
 					by = MathUtil::abs(bone->_data._scaleY) * MathUtil::sign(y);
-					bone->_scaleX = bx + (x - bx) * alpha;
-					bone->_scaleY = by + (y - by) * alpha;
+					bone->_local.scaleX = bx + (x - bx) * alpha;
+					bone->_local.scaleY = by + (y - by) * alpha;
 					break;
 				case MixBlend_First:
 				case MixBlend_Replace:
-					bx = MathUtil::abs(bone->_scaleX) * MathUtil::sign(x);
-					by = MathUtil::abs(bone->_scaleY) * MathUtil::sign(y);
-					bone->_scaleX = bx + (x - bx) * alpha;
-					bone->_scaleY = by + (y - by) * alpha;
+					bx = MathUtil::abs(bone->_local.scaleX) * MathUtil::sign(x);
+					by = MathUtil::abs(bone->_local.scaleY) * MathUtil::sign(y);
+					bone->_local.scaleX = bx + (x - bx) * alpha;
+					bone->_local.scaleY = by + (y - by) * alpha;
 					break;
 				case MixBlend_Add:
-					bone->_scaleX += (x - bone->_data._scaleX) * alpha;
-					bone->_scaleY += (y - bone->_data._scaleY) * alpha;
+					bone->_local.scaleX += (x - bone->_data._scaleX) * alpha;
+					bone->_local.scaleY += (y - bone->_data._scaleY) * alpha;
 			}
 		}
 	}
@@ -170,7 +170,7 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(pEvents);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_scaleX = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleX);
+	if (bone->_active) bone->_local.scaleX = getScaleValue(time, alpha, blend, direction, bone->_local.scaleX, bone->_data._scaleX, skeleton.getTimelineCursor());
 }
 
 RTTI_IMPL(ScaleYTimeline, CurveTimeline1)
@@ -190,5 +190,5 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(pEvents);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_scaleY = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleY);
+	if (bone->_active) bone->_local.scaleY = getScaleValue(time, alpha, blend, direction, bone->_local.scaleX, bone->_data._scaleY, skeleton.getTimelineCursor());
 }
\ No newline at end of file
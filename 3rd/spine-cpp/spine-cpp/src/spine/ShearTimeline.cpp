@@ -64,12 +64,12 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearX = bone->_data._shearX;
-				bone->_shearY = bone->_data._shearY;
+				bone->_local.shearX = bone->_data._shearX;
+				bone->_local.shearY = bone->_data._shearY;
 				return;
 			case MixBlend_First:
-				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
-				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+				bone->_local.shearX += (bone->_data._shearX - bone->_local.shearX) * alpha;
+				bone->_local.shearY += (bone->_data._shearY - bone->_local.shearY) * alpha;
 			default: {
 			}
 		}
@@ -77,7 +77,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline2::LINEAR: {
@@ -97,23 +97,23 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		default: {
 			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
 			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
+							   curveType + _bezierSize - CurveTimeline2::BEZIER);
 		}
 	}
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearX = bone->_data._shearX + x * alpha;
-			bone->_shearY = bone->_data._shearY + y * alpha;
+			bone->_local.shearX = bone->_data._shearX + x * alpha;
+			bone->_local.shearY = bone->_data._shearY + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
-			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			bone->_local.shearX += (bone->_data._shearX + x - bone->_local.shearX) * alpha;
+			bone->_local.shearY += (bone->_data._shearY + y - bone->_local.shearY) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearX += x * alpha;
-			bone->_shearY += y * alpha;
+			bone->_local.shearX += x * alpha;
+			bone->_local.shearY += y * alpha;
 	}
 }
 
@@ -136,7 +136,7 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_shearX = getRelativeValue(time, alpha, blend, bone->_shearX, bone->_data._shearX);
+	if (bone->_active) bone->_local.shearX = getRelativeValue(time, alpha, blend, bone->_local.shearX, bone->_data._shearX, skeleton.getTimelineCursor());
 }
 
 RTTI_IMPL(ShearYTimeline, CurveTimeline1)
@@ -158,5 +158,5 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_shearY = getRelativeValue(time, alpha, blend, bone->_shearY, bone->_data._shearY);
+	if (bone->_active) bone->_local.shearY = getRelativeValue(time, alpha, blend, bone->_local.shearY, bone->_data._shearY, skeleton.getTimelineCursor());
 }
@@ -54,14 +54,54 @@
 #include <spine/ContainerUtil.h>
 
 #include <float.h>
+#include <string.h>
 
 using namespace spine;
 
+// Upper estimate of what the constructor allocates, so the arena needs a single block. The per element extras cover
+// the pointer and index vectors of the skeleton, the children of the bones and the bone lists of the constraints.
+static size_t arenaBlockSize(SkeletonData *data) {
+	size_t size = 1024;
+	size += data->getBones().size() * (sizeof(Bone) + sizeof(BoneLocal) * 2 + sizeof(BoneWorld) + 64);
+	size += data->getSlots().size() * (sizeof(Slot) + 32);
+	size += data->getIkConstraints().size() * (sizeof(IkConstraint) + 64);
+	size += data->getTransformConstraints().size() * (sizeof(TransformConstraint) + 64);
+	size += data->getPathConstraints().size() * (sizeof(PathConstraint) + 128);
+	size += data->getPhysicsConstraints().size() * (sizeof(PhysicsConstraint) + 32);
+	return size;
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData)
-	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
-	_bones.ensureCapacity(_data->getBones().size());
-	for (size_t i = 0; i < _data->getBones().size(); ++i) {
+	: _arena(arenaBlockSize(skeletonData)), _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
+	  _scaleY(1), _x(0), _y(0), _time(0), _renderDriven(false),
+	  _timelineCursor(NULL) {
+	ArenaScope scope(&_arena);
+	size_t boneCount = _data->getBones().size();
+	// Exact capacities, setSize would leave room for growth that never comes.
+	_bonePoses.ensureCapacity(boneCount);
+	_boneAppliedPoses.ensureCapacity(boneCount);
+	_boneWorlds.ensureCapacity(boneCount);
+	_boneParents.ensureCapacity(boneCount);
+	_requiredBones.ensureCapacity(boneCount);
+	_neededBones.ensureCapacity(boneCount);
+	_bonePoses.setSize(boneCount, BoneLocal());
+	_boneAppliedPoses.setSize(boneCount, BoneLocal());
+	_boneWorlds.setSize(boneCount, BoneWorld());
+	_boneParents.setSize(boneCount, -1);
+	_requiredBones.setSize(boneCount, false);
+	_neededBones.setSize(boneCount, true);
+
+	// Children vectors get their exact size up front, instead of growing to at least 8 entries.
+	Vector<int> childCounts;
+	childCounts.ensureCapacity(boneCount);
+	childCounts.setSize(boneCount, 0);
+	for (size_t i = 0; i < boneCount; ++i) {
+		BoneData *parent = _data->getBones()[i]->getParent();
+		if (parent) childCounts[parent->getIndex()]++;
+	}
+
+	_bones.ensureCapacity(boneCount);
+	for (size_t i = 0; i < boneCount; ++i) {
 		BoneData *data = _data->getBones()[i];
 
 		Bone *bone;
@@ -71,7 +111,9 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 			Bone *parent = _bones[data->getParent()->getIndex()];
 			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
 			parent->getChildren().add(bone);
+			_boneParents[i] = data->getParent()->getIndex();
 		}
+		if (childCounts[i] > 0) bone->getChildren().ensureCapacity(childCounts[i]);
 
 		_bones.add(bone);
 	}
@@ -128,10 +170,13 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 		_physicsConstraints.add(constraint);
 	}
 
+	_updateCache.ensureCapacity(boneCount + _ikConstraints.size() + _transformConstraints.size() +
+								_pathConstraints.size() + _physicsConstraints.size());
 	updateCache();
 }
 
 Skeleton::~Skeleton() {
+	_arena.retire();
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
@@ -141,6 +186,8 @@ Skeleton::~Skeleton() {
 }
 
 void Skeleton::updateCache() {
+	// A skin change can grow the cache vectors, which live in the arena.
+	ArenaScope scope(&_arena);
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -211,6 +258,15 @@ continue_outer:
 	for (i = 0; i < n; ++i) {
 		sortBone(_bones[i]);
 	}
+
+	_updateCacheBones.ensureCapacity(_updateCache.size());
+	_updateCacheBones.setSize(_updateCache.size(), -1);
+	for (i = 0, n = _updateCache.size(); i < n; ++i) {
+		Updatable *updatable = _updateCache[i];
+		_updateCacheBones[i] = updatable->getRTTI().isExactly(Bone::rtti) ? ((Bone *) updatable)->_data.getIndex() : -1;
+	}
+	_neededCache.ensureCapacity(_updateCache.size());
+	_neededCache.setSize(_updateCache.size(), true);
 }
 
 void Skeleton::printUpdateCache() {
@@ -235,41 +291,175 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform(Physics physics) {
-	for (size_t i = 0, n = _bones.size(); i < n; i++) {
-		Bone *bone = _bones[i];
-		bone->_ax = bone->_x;
-		bone->_ay = bone->_y;
-		bone->_arotation = bone->_rotation;
-		bone->_ascaleX = bone->_scaleX;
-		bone->_ascaleY = bone->_scaleY;
-		bone->_ashearX = bone->_shearX;
-		bone->_ashearY = bone->_shearY;
+	size_t boneCount = _bones.size();
+	if (boneCount > 0) memcpy(_boneAppliedPoses.buffer(), _bonePoses.buffer(), sizeof(BoneLocal) * boneCount);
+
+	// Bones are computed straight from the pose store, only constraints go through Updatable::update.
+	BoneLocal *poses = _bonePoses.buffer();
+	BoneLocal *applied = _boneAppliedPoses.buffer();
+	BoneWorld *worlds = _boneWorlds.buffer();
+	int *parents = _boneParents.buffer();
+	int *cacheBones = _updateCacheBones.buffer();
+	if (_renderDriven) {
+		updateNeededBones();
+		bool *neededBones = _neededBones.buffer();
+		bool *neededCache = _neededCache.buffer();
+		for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
+			int bone = cacheBones[i];
+			if (bone >= 0) {
+				if (!neededBones[bone]) continue;
+				int parent = parents[bone];
+				Bone::computeWorldTransform(applied[bone], poses[bone].inherit, parent >= 0 ? worlds + parent : NULL,
+											*this, worlds[bone]);
+			} else if (neededCache[i]) {
+				_updateCache[i]->update(physics);
+			}
+		}
+		return;
 	}
 
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
-		Updatable *updatable = _updateCache[i];
-		updatable->update(physics);
+		int bone = cacheBones[i];
+		if (bone >= 0) {
+			int parent = parents[bone];
+			Bone::computeWorldTransform(applied[bone], poses[bone].inherit, parent >= 0 ? worlds + parent : NULL,
+										*this, worlds[bone]);
+		} else {
+			_updateCache[i]->update(physics);
+		}
+	}
+}
+
+static bool anyBoneNeeded(Vector<Bone *> &bones, bool *needed) {
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		if (needed[bones[i]->getData().getIndex()]) return true;
+	return false;
+}
+
+static void markBonesNeeded(Vector<Bone *> &bones, bool *needed) {
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		needed[bones[i]->getData().getIndex()] = true;
+}
+
+static void markAttachmentNeeded(Attachment *attachment, Bone &slotBone, bool *needed) {
+	needed[slotBone.getData().getIndex()] = true;
+	if (!attachment || !attachment->getRTTI().instanceOf(VertexAttachment::rtti)) return;
+	Vector<int> &bones = static_cast<VertexAttachment *>(attachment)->getBones();
+	for (size_t i = 0, n = bones.size(); i < n;) {
+		int count = bones[i++];
+		for (int ii = 0; ii < count; ii++, i++)
+			needed[bones[i]] = true;
+	}
+}
+
+void Skeleton::updateNeededBones() {
+	size_t boneCount = _bones.size();
+	bool *needed = _neededBones.buffer();
+	bool *neededCache = _neededCache.buffer();
+	int *parents = _boneParents.buffer();
+	int *cacheBones = _updateCacheBones.buffer();
+	if (boneCount > 0) memcpy(needed, _requiredBones.buffer(), sizeof(bool) * boneCount);
+
+	for (size_t i = 0, n = _drawOrder.size(); i < n; ++i) {
+		Slot *slot = _drawOrder[i];
+		Attachment *attachment = slot->getAttachment();
+		if (!attachment || !slot->getBone().isActive()) continue;
+		const RTTI &rtti = attachment->getRTTI();
+		if (rtti.isExactly(ClippingAttachment::rtti)) {
+			markAttachmentNeeded(attachment, slot->getBone(), needed);
+		} else if (_color.a > 0 && slot->getColor().a > 0 &&
+				   (rtti.isExactly(RegionAttachment::rtti) || rtti.isExactly(MeshAttachment::rtti))) {
+			markAttachmentNeeded(attachment, slot->getBone(), needed);
+		}
+	}
+
+	// Constraints pull in their targets, whose parents may be constrained in turn, so iterate to a fixpoint.
+	size_t cacheCount = _updateCache.size();
+	for (size_t i = 0; i < cacheCount; ++i)
+		neededCache[i] = cacheBones[i] >= 0;
+	bool changed;
+	do {
+		changed = false;
+		for (size_t i = boneCount; i-- > 1;)
+			if (needed[i]) needed[parents[i]] = true;
+
+		for (size_t i = 0; i < cacheCount; ++i) {
+			if (neededCache[i]) continue;
+			Updatable *updatable = _updateCache[i];
+			const RTTI &rtti = updatable->getRTTI();
+			if (rtti.isExactly(IkConstraint::rtti)) {
+				IkConstraint *constraint = static_cast<IkConstraint *>(updatable);
+				if (!anyBoneNeeded(constraint->getBones(), needed)) continue;
+				markBonesNeeded(constraint->getBones(), needed);
+				needed[constraint->getTarget()->getData().getIndex()] = true;
+			} else if (rtti.isExactly(TransformConstraint::rtti)) {
+				TransformConstraint *constraint = static_cast<TransformConstraint *>(updatable);
+				if (!anyBoneNeeded(constraint->getBones(), needed)) continue;
+				markBonesNeeded(constraint->getBones(), needed);
+				needed[constraint->getTarget()->getData().getIndex()] = true;
+			} else if (rtti.isExactly(PathConstraint::rtti)) {
+				PathConstraint *constraint = static_cast<PathConstraint *>(updatable);
+				if (!anyBoneNeeded(constraint->getBones(), needed)) continue;
+				markBonesNeeded(constraint->getBones(), needed);
+				Slot *target = constraint->getTarget();
+				markAttachmentNeeded(target->getAttachment(), target->getBone(), needed);
+			} else if (rtti.isExactly(PhysicsConstraint::rtti)) {
+				// Physics keeps state between frames, it always runs so skipping frames does not change the simulation.
+				needed[static_cast<PhysicsConstraint *>(updatable)->getBone()->getData().getIndex()] = true;
+			}
+			neededCache[i] = true;
+			changed = true;
+		}
+	} while (changed);
+}
+
+void Skeleton::setRenderDriven(bool renderDriven) {
+	_renderDriven = renderDriven;
+	if (!renderDriven) {
+		for (size_t i = 0, n = _neededBones.size(); i < n; ++i)
+			_neededBones[i] = true;
+		for (size_t i = 0, n = _neededCache.size(); i < n; ++i)
+			_neededCache[i] = true;
 	}
 }
 
+bool Skeleton::isRenderDriven() {
+	return _renderDriven;
+}
+
+void Skeleton::setBoneRequired(Bone &bone, bool required) {
+	_requiredBones[bone.getData().getIndex()] = required;
+}
+
+bool Skeleton::isBoneRequired(Bone &bone) {
+	return _requiredBones[bone.getData().getIndex()];
+}
+
+bool Skeleton::isBoneUpdated(Bone &bone) {
+	return _neededBones[bone.getData().getIndex()];
+}
+
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
 	Bone *rootBone = getRootBone();
-	float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
-	rootBone->_worldX = pa * _x + pb * _y + parent->_worldX;
-	rootBone->_worldY = pc * _x + pd * _y + parent->_worldY;
-
-	float rx = (rootBone->_rotation + rootBone->_shearX) * MathUtil::Deg_Rad;
-	float ry = (rootBone->_rotation + 90 + rootBone->_shearY) * MathUtil::Deg_Rad;
-	float la = MathUtil::cos(rx) * rootBone->_scaleX;
-	float lb = MathUtil::cos(ry) * rootBone->_scaleY;
-	float lc = MathUtil::sin(rx) * rootBone->_scaleX;
-	float ld = MathUtil::sin(ry) * rootBone->_scaleY;
-	rootBone->_a = (pa * la + pb * lc) * _scaleX;
-	rootBone->_b = (pa * lb + pb * ld) * _scaleX;
-	rootBone->_c = (pc * la + pd * lc) * _scaleY;
-	rootBone->_d = (pc * lb + pd * ld) * _scaleY;
+	float pa = parent->_world.a, pb = parent->_world.b, pc = parent->_world.c, pd = parent->_world.d;
+	rootBone->_world.worldX = pa * _x + pb * _y + parent->_world.worldX;
+	rootBone->_world.worldY = pc * _x + pd * _y + parent->_world.worldY;
+
+	float rx = (rootBone->_local.rotation + rootBone->_local.shearX) * MathUtil::Deg_Rad;
+	float ry = (rootBone->_local.rotation + 90 + rootBone->_local.shearY) * MathUtil::Deg_Rad;
+	float sinX, cosX, sinY, cosY;
+	MathUtil::sinCos(rx, sinX, cosX);
+	MathUtil::sinCos(ry, sinY, cosY);
+	float la = cosX * rootBone->_local.scaleX;
+	float lb = cosY * rootBone->_local.scaleY;
+	float lc = sinX * rootBone->_local.scaleX;
+	float ld = sinY * rootBone->_local.scaleY;
+	rootBone->_world.a = (pa * la + pb * lc) * _scaleX;
+	rootBone->_world.b = (pa * lb + pb * ld) * _scaleX;
+	rootBone->_world.c = (pc * la + pd * lc) * _scaleY;
+	rootBone->_world.d = (pc * lb + pd * ld) * _scaleY;
 
 	// Update everything except root bone.
 	Bone *rb = getRootBone();
@@ -319,10 +509,19 @@ void Skeleton::setSlotsToSetupPose() {
 }
 
 Bone *Skeleton::findBone(const String &boneName) {
+	// Bones are created in the order of the skeleton data, use its name index.
+	BoneData *data = _data->findBone(boneName);
+	if (data == NULL) return NULL;
+	int index = data->getIndex();
+	if (index < (int) _bones.size() && &_bones[index]->getData() == data) return _bones[index];
 	return ContainerUtil::findWithDataName(_bones, boneName);
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
+	SlotData *data = _data->findSlot(slotName);
+	if (data == NULL) return NULL;
+	int index = data->getIndex();
+	if (index < (int) _slots.size() && &_slots[index]->getData() == data) return _slots[index];
 	return ContainerUtil::findWithDataName(_slots, slotName);
 }
 
@@ -367,15 +566,19 @@ Attachment *Skeleton::getAttachment(int slotIndex,
 	if (attachmentName.isEmpty())
 		return NULL;
 
+	return getAttachment(slotIndex, attachmentName, NameIndex::hashName(attachmentName));
+}
+
+Attachment *Skeleton::getAttachment(int slotIndex, const String &attachmentName, unsigned int hash) {
 	if (_skin != NULL) {
-		Attachment *attachment = _skin->getAttachment(slotIndex, attachmentName);
+		Attachment *attachment = _skin->getAttachment(slotIndex, attachmentName, hash);
 		if (attachment != NULL) {
 			return attachment;
 		}
 	}
 
 	return _data->getDefaultSkin() != NULL
-				   ? _data->getDefaultSkin()->getAttachment(slotIndex, attachmentName)
+				   ? _data->getDefaultSkin()->getAttachment(slotIndex, attachmentName, hash)
 				   : NULL;
 }
 
@@ -542,6 +745,18 @@ SkeletonData *Skeleton::getData() { return _data; }
 
 Vector<Bone *> &Skeleton::getBones() { return _bones; }
 
+Vector<BoneLocal> &Skeleton::getBonePoses() { return _bonePoses; }
+
+Vector<BoneWorld> &Skeleton::getBoneWorlds() { return _boneWorlds; }
+
+int *Skeleton::getTimelineCursor() {
+	return _timelineCursor;
+}
+
+void Skeleton::setTimelineCursor(int *cursor) {
+	_timelineCursor = cursor;
+}
+
 Vector<Updatable *> &Skeleton::getUpdateCacheList() { return _updateCache; }
 
 Vector<Slot *> &Skeleton::getSlots() { return _slots; }
@@ -771,3 +986,7 @@ void Skeleton::physicsRotate(float x, float y, float degrees) {
 		_physicsConstraints[i]->rotate(x, y, degrees);
 	}
 }
+
+Arena &Skeleton::getArena() {
+	return _arena;
+}
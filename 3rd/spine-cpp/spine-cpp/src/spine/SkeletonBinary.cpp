@@ -76,16 +76,54 @@
 
 using namespace spine;
 
+namespace spine {
+	/// Decodes the animations that SkeletonBinary skipped over, from the buffer kept alive by the SkeletonData.
+	class BinaryAnimationLoader : public AnimationLoader {
+	public:
+		// Animations don't read attachments, the atlas is never used.
+		BinaryAnimationLoader(SkeletonData *skeletonData, float scale, bool compactCurves, const unsigned char *end)
+			: _skeletonData(skeletonData), _binary((Atlas *) NULL), _end(end) {
+			_binary.setScale(scale);
+			_binary.setCompactCurves(compactCurves);
+		}
+
+		virtual bool load(Animation &animation, Vector<Timeline *> &timelines) {
+			int index = _skeletonData->getAnimations().indexOf(&animation);
+			if (index < 0 || index >= (int) _offsets.size()) return false;
+
+			SkeletonBinary::DataInput input;
+			input.cursor = _offsets[index];
+			input.end = _end;
+			input.inPlace = false;
+			return _binary.readTimelines(&input, _skeletonData, timelines);
+		}
+
+		void add(const unsigned char *offset) {
+			_offsets.add(offset);
+		}
+
+	private:
+		SkeletonData *_skeletonData;
+		SkeletonBinary _binary;
+		Vector<const unsigned char *> _offsets;
+		const unsigned char *_end;
+	};
+}
+
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _ownsLoader(true), _compactCurves(false),
+													_lazyAnimations(false), _arena(false) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
-																					  _ownsLoader(ownsLoader) {
+																					  _ownsLoader(ownsLoader),
+																					  _compactCurves(false),
+																					  _lazyAnimations(false),
+																					  _arena(false) {
 	assert(_attachmentLoader != NULL);
 }
 
@@ -97,16 +135,23 @@ SkeletonBinary::~SkeletonBinary() {
 }
 
 SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, const int length) {
+	return readSkeletonData((unsigned char *) binary, length, NULL);
+}
+
+SkeletonData *SkeletonBinary::readSkeletonData(unsigned char *binary, const int length, SkeletonDataBuffer *dataBuffer) {
 	bool nonessential;
 	SkeletonData *skeletonData;
 
 	DataInput *input = new (__FILE__, __LINE__) DataInput();
 	input->cursor = binary;
 	input->end = binary + length;
+	input->inPlace = dataBuffer != NULL;
 
 	_linkedMeshes.clear();
 
 	skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	skeletonData->_buffer = dataBuffer;
+	ArenaScope scope(_arena ? &skeletonData->_arena : Arena::getCurrent());
 
 	char buffer[16] = {0};
 	int lowHash = readInt(input);
@@ -118,8 +163,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	hashString.append(buffer);
 	skeletonData->_hash = hashString;
 
-	char *skeletonDataVersion = readString(input);
-	skeletonData->_version.own(skeletonDataVersion);
+	readString(input, skeletonData->_version);
 
 	if (!skeletonData->_version.startsWith(SPINE_VERSION_STRING)) {
 		char errorMsg[255];
@@ -140,8 +184,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 
 	if (nonessential) {
 		skeletonData->_fps = readFloat(input);
-		skeletonData->_imagesPath.own(readString(input));
-		skeletonData->_audioPath.own(readString(input));
+		readString(input, skeletonData->_imagesPath);
+		readString(input, skeletonData->_audioPath);
 	}
 
 	int numStrings = readVarint(input, true);
@@ -152,9 +196,10 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int numBones = readVarint(input, true);
 	skeletonData->_bones.setSize(numBones, 0);
 	for (int i = 0; i < numBones; ++i) {
-		const char *name = readString(input);
+		String name;
+		readString(input, name);
 		BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-		BoneData *data = new (__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+		BoneData *data = new (__FILE__, __LINE__) BoneData(i, name, parent);
 		data->_rotation = readFloat(input);
 		data->_x = readFloat(input) * _scale;
 		data->_y = readFloat(input) * _scale;
@@ -167,7 +212,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		data->_skinRequired = readBoolean(input);
 		if (nonessential) {
 			readColor(input, data->getColor());
-			data->_icon.own(readString(input));
+			readString(input, data->_icon);
 			data->_visible = readBoolean(input);
 		}
 		skeletonData->_bones[i] = data;
@@ -177,7 +222,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int slotsCount = readVarint(input, true);
 	skeletonData->_slots.setSize(slotsCount, 0);
 	for (int i = 0; i < slotsCount; ++i) {
-		String slotName = String(readString(input), true);
+		String slotName;
+		readString(input, slotName);
 		BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
 		SlotData *slotData = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
@@ -190,7 +236,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 			slotData->getDarkColor().set(r / 255.0f, g / 255.0f, b / 255.0f, 1);
 			slotData->setHasDarkColor(true);
 		}
-		slotData->_attachmentName = readStringRef(input, skeletonData);
+		readStringRef(input, skeletonData, slotData->_attachmentName);
 		slotData->_blendMode = static_cast<BlendMode>(readVarint(input, true));
 		if (nonessential) {
 			slotData->_visible = readBoolean(input);
@@ -202,8 +248,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int ikConstraintsCount = readVarint(input, true);
 	skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
 	for (int i = 0; i < ikConstraintsCount; ++i) {
-		const char *name = readString(input);
-		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(String(name, true));
+		String name;
+		readString(input, name);
+		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		int bonesCount = readVarint(input, true);
 		data->_bones.setSize(bonesCount, 0);
@@ -226,8 +273,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int transformConstraintsCount = readVarint(input, true);
 	skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
 	for (int i = 0; i < transformConstraintsCount; ++i) {
-		const char *name = readString(input);
-		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(String(name, true));
+		String name;
+		readString(input, name);
+		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		int bonesCount = readVarint(input, true);
 		data->_bones.setSize(bonesCount, 0);
@@ -259,8 +307,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int pathConstraintsCount = readVarint(input, true);
 	skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
 	for (int i = 0; i < pathConstraintsCount; ++i) {
-		const char *name = readString(input);
-		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(String(name, true));
+		String name;
+		readString(input, name);
+		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		data->setSkinRequired(readBoolean(input));
 		int bonesCount = readVarint(input, true);
@@ -288,8 +337,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int physicsConstraintsCount = readVarint(input, true);
 	skeletonData->_physicsConstraints.setSize(physicsConstraintsCount, 0);
 	for (int i = 0; i < physicsConstraintsCount; i++) {
-		const char *name = readString(input);
-		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(String(name, true));
+		String name;
+		readString(input, name);
+		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(name);
 		data->_order = readVarint(input, true);
 		data->_bone = skeletonData->_bones[readVarint(input, true)];
 		int flags = readByte(input);
@@ -368,12 +418,13 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int eventsCount = readVarint(input, true);
 	skeletonData->_events.setSize(eventsCount, 0);
 	for (int i = 0; i < eventsCount; ++i) {
-		const char *name = readString(input);
-		EventData *eventData = new (__FILE__, __LINE__) EventData(String(name, true));
+		String name;
+		readString(input, name);
+		EventData *eventData = new (__FILE__, __LINE__) EventData(name);
 		eventData->_intValue = readVarint(input, false);
 		eventData->_floatValue = readFloat(input);
-		eventData->_stringValue.own(readString(input));
-		eventData->_audioPath.own(readString(input));
+		readString(input, eventData->_stringValue);
+		readString(input, eventData->_audioPath);
 		if (!eventData->_audioPath.isEmpty()) {
 			eventData->_volume = readFloat(input);
 			eventData->_balance = readFloat(input);
@@ -382,11 +433,25 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	}
 
 	/* Animations. */
+	BinaryAnimationLoader *animationLoader = NULL;
+	if (_lazyAnimations && dataBuffer) {
+		animationLoader = new (__FILE__, __LINE__) BinaryAnimationLoader(skeletonData, _scale, _compactCurves,
+																		  input->end);
+		skeletonData->_animationLoader = animationLoader;
+	}
 	int animationsCount = readVarint(input, true);
 	skeletonData->_animations.setSize(animationsCount, 0);
 	for (int i = 0; i < animationsCount; ++i) {
-		String name(readString(input), true);
-		Animation *animation = readAnimation(name, input, skeletonData);
+		String name;
+		readString(input, name);
+		Animation *animation = NULL;
+		if (animationLoader) {
+			animationLoader->add(input->cursor);
+			if (skipAnimation(input, skeletonData))
+				animation = new (__FILE__, __LINE__) Animation(name, animationLoader);
+		} else {
+			animation = readAnimation(name, input, skeletonData);
+		}
 		if (!animation) {
 			delete input;
 			delete skeletonData;
@@ -394,6 +459,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		}
 		skeletonData->_animations[i] = animation;
 	}
+	skeletonData->updateNameIndex();
 
 	delete input;
 	return skeletonData;
@@ -418,6 +484,8 @@ void SkeletonBinary::setError(const char *value1, const char *value2) {
 	strcpy(message, value1);
 	length = (int) strlen(value1);
 	if (value2) strncat(message + length, value2, 255 - length);
+	/* The error outlives the skeleton data that failed, and its arena. */
+	ArenaScope scope(NULL);
 	_error = String(message);
 }
 
@@ -425,18 +493,35 @@ char *SkeletonBinary::readString(DataInput *input) {
 	int length = readVarint(input, true);
 	char *string;
 	if (length == 0) return NULL;
-	string = SpineExtension::alloc<char>(length, __FILE__, __LINE__);
-	memcpy(string, input->cursor, length - 1);
+	if (input->inPlace) {
+		/* The length prefix is at least one byte, move the characters over its last byte to make room for the
+		 * terminator. */
+		string = (char *) input->cursor - 1;
+		memmove(string, input->cursor, length - 1);
+	} else {
+		string = SpineExtension::alloc<char>(length, __FILE__, __LINE__);
+		memcpy(string, input->cursor, length - 1);
+	}
 	input->cursor += length - 1;
 	string[length - 1] = '\0';
 	return string;
 }
 
+void SkeletonBinary::readString(DataInput *input, String &string) {
+	string.own(String(readString(input), true, !input->inPlace));
+}
+
 char *SkeletonBinary::readStringRef(DataInput *input, SkeletonData *skeletonData) {
 	int index = readVarint(input, true);
 	return index == 0 ? NULL : skeletonData->_strings[index - 1];
 }
 
+void SkeletonBinary::readStringRef(DataInput *input, SkeletonData *skeletonData, String &string) {
+	// The string table lives as long as the skeleton data, so references borrow it in either mode and equal names
+	// share their characters.
+	string.own(String(readStringRef(input, skeletonData), true, false));
+}
+
 float SkeletonBinary::readFloat(DataInput *input) {
 	union {
 		int intValue;
@@ -504,7 +589,9 @@ Skin *SkeletonBinary::readSkin(DataInput *input, bool defaultSkin, SkeletonData
 		if (slotCount == 0) return NULL;
 		skin = new (__FILE__, __LINE__) Skin("default");
 	} else {
-		skin = new (__FILE__, __LINE__) Skin(String(readString(input), true));
+		String name;
+		readString(input, name);
+		skin = new (__FILE__, __LINE__) Skin(name);
 
 		if (nonessential) readColor(input, skin->getColor());
 
@@ -543,7 +630,8 @@ Skin *SkeletonBinary::readSkin(DataInput *input, bool defaultSkin, SkeletonData
 	for (int i = 0; i < slotCount; ++i) {
 		int slotIndex = readVarint(input, true);
 		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
-			String name(readStringRef(input, skeletonData));
+			String name;
+			readStringRef(input, skeletonData, name);
 			Attachment *attachment = readAttachment(input, skin, slotIndex, name, skeletonData, nonessential);
 			if (attachment)
 				skin->setAttachment(slotIndex, String(name), attachment);
@@ -568,11 +656,15 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 										   SkeletonData *skeletonData, bool nonessential) {
 
 	int flags = readByte(input);
-	String name = (flags & 8) != 0 ? readStringRef(input, skeletonData) : attachmentName;
+	String name;
+	if ((flags & 8) != 0) readStringRef(input, skeletonData, name);
+	else name = attachmentName;
 	AttachmentType type = static_cast<AttachmentType>(flags & 0x7);
 	switch (type) {
 		case AttachmentType_Region: {
-			String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+			String path;
+			if ((flags & 16) != 0) readStringRef(input, skeletonData, path);
+			else path = name;
 			Color color(1, 1, 1, 1);
 			if ((flags & 32) != 0) readColor(input, color);
 			Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
@@ -610,6 +702,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			}
 			int verticesLength = readVertices(input, box->getVertices(), box->getBones(), (flags & 16) != 0);
 			box->setWorldVerticesLength(verticesLength);
+			box->updateWeightLayout();
 			if (nonessential) {
 				readColor(input, box->getColor());
 			}
@@ -617,61 +710,50 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			return box;
 		}
 		case AttachmentType_Mesh: {
-			Vector<float> uvs;
-			Vector<unsigned short> triangles;
-			Vector<float> vertices;
-			Vector<int> bones;
-			int hullLength;
-			float width = 0;
-			float height = 0;
-			Vector<unsigned short> edges;
-
-			String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+			String path;
+			if ((flags & 16) != 0) readStringRef(input, skeletonData, path);
+			else path = name;
 			Color color(1, 1, 1, 1);
 			if ((flags & 32) != 0) readColor(input, color);
 			Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
-			hullLength = readVarint(input, true);
-			int verticesLength = readVertices(input, vertices, bones, (flags & 128) != 0);
-			readFloatArray(input, verticesLength, 1, uvs);
-			readShortArray(input, triangles, (verticesLength - hullLength - 2) * 3);
-
-			if (nonessential) {
-				readShortArray(input, edges, readVarint(input, true));
-				width = readFloat(input);
-				height = readFloat(input);
-			}
+			int hullLength = readVarint(input, true);
 
+			/* The arrays are read straight into the attachment instead of being copied over from temporaries. */
 			MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, String(name), String(path), sequence);
 			if (!mesh) {
 				setError("Error reading attachment: ", name.buffer());
 				return NULL;
 			}
+			int verticesLength = readVertices(input, mesh->_vertices, mesh->_bones, (flags & 128) != 0);
+			readFloatArray(input, verticesLength, 1, mesh->_regionUVs);
+			readShortArray(input, mesh->_triangles, (verticesLength - hullLength - 2) * 3);
+			if (nonessential) {
+				readShortArray(input, mesh->_edges, readVarint(input, true));
+				mesh->_width = readFloat(input);
+				mesh->_height = readFloat(input);
+			}
+
 			mesh->_path = path;
 			mesh->_color.set(color);
-			mesh->_bones.addAll(bones);
-			mesh->_vertices.addAll(vertices);
 			mesh->setWorldVerticesLength(verticesLength);
-			mesh->_triangles.addAll(triangles);
-			mesh->_regionUVs.addAll(uvs);
+			mesh->updateWeightLayout();
 			if (sequence == NULL) mesh->updateRegion();
 			mesh->_hullLength = hullLength;
 			mesh->_sequence = sequence;
-			if (nonessential) {
-				mesh->_edges.addAll(edges);
-				mesh->_width = width;
-				mesh->_height = height;
-			}
 			_attachmentLoader->configureAttachment(mesh);
 			return mesh;
 		}
 		case AttachmentType_Linkedmesh: {
-			String path = (flags & 16) != 0 ? readStringRef(input, skeletonData) : name;
+			String path;
+			if ((flags & 16) != 0) readStringRef(input, skeletonData, path);
+			else path = name;
 			Color color(1, 1, 1, 1);
 			if ((flags & 32) != 0) readColor(input, color);
 			Sequence *sequence = (flags & 64) != 0 ? readSequence(input) : nullptr;
 			bool inheritTimelines = (flags & 128) != 0;
 			int skinIndex = readVarint(input, true);
-			String parent(readStringRef(input, skeletonData));
+			String parent;
+			readStringRef(input, skeletonData, parent);
 			float width = 0, height = 0;
 			if (nonessential) {
 				width = readFloat(input) * _scale;
@@ -691,6 +773,8 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				mesh->_height = height;
 			}
 
+			/* The linked meshes are the reader's, they must not be left in the arena of a skeleton that failed. */
+			ArenaScope scope(NULL);
 			LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, skinIndex, slotIndex,
 																		 String(parent), inheritTimelines);
 			_linkedMeshes.add(linkedMesh);
@@ -706,7 +790,9 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			path->_constantSpeed = (flags & 32) != 0;
 			int verticesLength = readVertices(input, path->getVertices(), path->getBones(), (flags & 64) != 0);
 			path->setWorldVerticesLength(verticesLength);
+			path->updateWeightLayout();
 			int lengthsLength = verticesLength / 6;
+			path->_lengths.ensureCapacity(lengthsLength);
 			path->_lengths.setSize(lengthsLength, 0);
 			for (int i = 0; i < lengthsLength; ++i) {
 				path->_lengths[i] = readFloat(input) * _scale;
@@ -742,6 +828,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			}
 			int verticesLength = readVertices(input, clip->getVertices(), clip->getBones(), (flags & 16) != 0);
 			clip->setWorldVerticesLength(verticesLength);
+			clip->updateWeightLayout();
 			clip->_endSlot = skeletonData->_slots[endSlotIndex];
 			if (nonessential) {
 				readColor(input, clip->getColor());
@@ -773,25 +860,38 @@ int SkeletonBinary::readVertices(DataInput *input, Vector<float> &vertices, Vect
 			vertices.add(readFloat(input));
 		}
 	}
+	vertices.shrinkToFit();
+	bones.shrinkToFit();
 	return verticesLength;
 }
 
 void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
+	array.ensureCapacity(n);
 	array.setSize(n, 0);
 
-	int i;
-	if (scale == 1) {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input);
-		}
-	} else {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input) * scale;
+	/* The floats are stored big endian, so they are decoded with one pass over the input rather than referenced. */
+	float *values = array.buffer();
+	const unsigned char *cursor = input->cursor;
+	union {
+		unsigned int intValue;
+		float floatValue;
+	} intToFloat;
+	for (int i = 0; i < n; ++i, cursor += 4) {
+		intToFloat.intValue = ((unsigned int) cursor[0] << 24) | ((unsigned int) cursor[1] << 16) |
+							  ((unsigned int) cursor[2] << 8) | (unsigned int) cursor[3];
+		values[i] = intToFloat.floatValue;
+	}
+	input->cursor = cursor;
+
+	if (scale != 1) {
+		for (int i = 0; i < n; ++i) {
+			values[i] *= scale;
 		}
 	}
 }
 
 void SkeletonBinary::readShortArray(DataInput *input, Vector<unsigned short> &array, int n) {
+	array.ensureCapacity(n);
 	array.setSize(n, 0);
 	for (int i = 0; i < n; ++i) {
 		array[i] = (short) readVarint(input, true);
@@ -805,6 +905,7 @@ void SkeletonBinary::setBezier(DataInput *input, CurveTimeline *timeline, int be
 	float cy1 = readFloat(input);
 	float cx2 = readFloat(input);
 	float cy2 = readFloat(input);
+	if (_compactCurves && bezier == 0) timeline->setCompact(true);
 	timeline->setBezier(bezier, frame, value, time1, value1, cx1, cy1 * scale, cx2, cy2 * scale, time2, value2);
 }
 
@@ -856,6 +957,16 @@ void SkeletonBinary::readTimeline2(DataInput *input, Vector<Timeline *> &timelin
 
 Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) {
 	Vector<Timeline *> timelines;
+	if (!readTimelines(input, skeletonData, timelines)) return NULL;
+
+	float duration = 0;
+	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
+		duration = MathUtil::max(duration, (timelines[i])->getDuration());
+	}
+	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
+}
+
+bool SkeletonBinary::readTimelines(DataInput *input, SkeletonData *skeletonData, Vector<Timeline *> &timelines) {
 	float scale = _scale;
 	int numTimelines = readVarint(input, true);
 	SP_UNUSED(numTimelines);
@@ -871,7 +982,8 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, slotIndex);
 					for (int frame = 0; frame < frameCount; ++frame) {
 						float time = readFloat(input);
-						String attachmentName(readStringRef(input, skeletonData));
+						String attachmentName;
+						readStringRef(input, skeletonData, attachmentName);
 						timeline->setFrame(frame, time, attachmentName);
 					}
 					timelines.add(timeline);
@@ -1073,7 +1185,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 				default: {
 					ContainerUtil::cleanUpVectorOfPointers(timelines);
 					setError("Invalid timeline type for a slot: ", skeletonData->_slots[slotIndex]->_name.buffer());
-					return NULL;
+					return false;
 				}
 			}
 		}
@@ -1144,7 +1256,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 				default: {
 					ContainerUtil::cleanUpVectorOfPointers(timelines);
 					setError("Invalid timeline type for a bone: ", skeletonData->_bones[boneIndex]->_name.buffer());
-					return NULL;
+					return false;
 				}
 			}
 		}
@@ -1329,11 +1441,11 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 			int slotIndex = readVarint(input, true);
 			for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
 				const char *attachmentName = readStringRef(input, skeletonData);
-				Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName));
+				Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName, true, false));
 				if (!baseAttachment) {
 					ContainerUtil::cleanUpVectorOfPointers(timelines);
 					setError("Attachment not found: ", attachmentName);
-					return NULL;
+					return false;
 				}
 				unsigned int timelineType = readByte(input);
 				int frameCount = readVarint(input, true);
@@ -1465,13 +1577,8 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 
 			event->_intValue = readVarint(input, false);
 			event->_floatValue = readFloat(input);
-			const char *event_stringValue = readString(input);
-			if (event_stringValue == nullptr) {
-				event->_stringValue = eventData->_stringValue;
-			} else {
-				event->_stringValue = String(event_stringValue);
-				SpineExtension::free(event_stringValue, __FILE__, __LINE__);
-			}
+			readString(input, event->_stringValue);
+			if (event->_stringValue.buffer() == nullptr) event->_stringValue = eventData->_stringValue;
 
 			if (!eventData->_audioPath.isEmpty()) {
 				event->_volume = readFloat(input);
@@ -1481,10 +1588,1109 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		}
 		timelines.add(timeline);
 	}
+	return true;
+}
 
-	float duration = 0;
-	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
-		duration = MathUtil::max(duration, (timelines[i])->getDuration());
+void SkeletonBinary::skipCurveFrames(DataInput *input, int frameCount, int valueSize, int channels) {
+	input->cursor += 4 + valueSize;
+	for (int frame = 1; frame < frameCount; frame++) {
+		input->cursor += 4 + valueSize;
+		if (readSByte(input) == CURVE_BEZIER) input->cursor += channels * 16;
 	}
-	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
+}
+
+bool SkeletonBinary::skipAnimation(DataInput *input, SkeletonData *skeletonData) {
+	readVarint(input, true);
+
+	// Slot timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		int slotIndex = readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			unsigned char timelineType = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (timelineType == SLOT_ATTACHMENT) {
+				for (int frame = 0; frame < frameCount; ++frame) {
+					input->cursor += 4;
+					readVarint(input, true);
+				}
+				continue;
+			}
+			readVarint(input, true);
+			switch (timelineType) {
+				case SLOT_RGBA:
+					skipCurveFrames(input, frameCount, 4, 4);
+					break;
+				case SLOT_RGB:
+					skipCurveFrames(input, frameCount, 3, 3);
+					break;
+				case SLOT_RGBA2:
+					skipCurveFrames(input, frameCount, 7, 7);
+					break;
+				case SLOT_RGB2:
+					skipCurveFrames(input, frameCount, 6, 6);
+					break;
+				case SLOT_ALPHA:
+					skipCurveFrames(input, frameCount, 1, 1);
+					break;
+				default:
+					setError("Invalid timeline type for a slot: ", skeletonData->_slots[slotIndex]->_name.buffer());
+					return false;
+			}
+		}
+	}
+
+	// Bone timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		int boneIndex = readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			unsigned char timelineType = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (timelineType == BONE_INHERIT) {
+				input->cursor += frameCount * 5;
+				continue;
+			}
+			readVarint(input, true);
+			switch (timelineType) {
+				case BONE_TRANSLATE:
+				case BONE_SCALE:
+				case BONE_SHEAR:
+					skipCurveFrames(input, frameCount, 8, 2);
+					break;
+				case BONE_ROTATE:
+				case BONE_TRANSLATEX:
+				case BONE_TRANSLATEY:
+				case BONE_SCALEX:
+				case BONE_SCALEY:
+				case BONE_SHEARX:
+				case BONE_SHEARY:
+					skipCurveFrames(input, frameCount, 4, 1);
+					break;
+				default:
+					setError("Invalid timeline type for a bone: ", skeletonData->_bones[boneIndex]->_name.buffer());
+					return false;
+			}
+		}
+	}
+
+	// IK timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		int frameCount = readVarint(input, true);
+		readVarint(input, true);
+		for (int frame = 0; frame < frameCount; frame++) {
+			int flags = readByte(input);
+			input->cursor += 4;
+			if ((flags & 3) == 3) input->cursor += 4;
+			if ((flags & 4) != 0) input->cursor += 4;
+			if (frame > 0 && (flags & 64) == 0 && (flags & 128) != 0) input->cursor += 2 * 16;
+		}
+	}
+
+	// Transform constraint timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		int frameCount = readVarint(input, true);
+		readVarint(input, true);
+		skipCurveFrames(input, frameCount, 24, 6);
+	}
+
+	// Path constraint timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+			int type = readByte(input);
+			int frameCount = readVarint(input, true);
+			readVarint(input, true);
+			switch (type) {
+				case PATH_POSITION:
+				case PATH_SPACING:
+					skipCurveFrames(input, frameCount, 4, 1);
+					break;
+				case PATH_MIX:
+					skipCurveFrames(input, frameCount, 12, 3);
+			}
+		}
+	}
+
+	// Physics timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; i++) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+			int type = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (type == PHYSICS_RESET) {
+				input->cursor += frameCount * 4;
+				continue;
+			}
+			readVarint(input, true);
+			switch (type) {
+				case PHYSICS_INERTIA:
+				case PHYSICS_STRENGTH:
+				case PHYSICS_DAMPING:
+				case PHYSICS_MASS:
+				case PHYSICS_WIND:
+				case PHYSICS_GRAVITY:
+				case PHYSICS_MIX:
+					skipCurveFrames(input, frameCount, 4, 1);
+			}
+		}
+	}
+
+	// Attachment timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			readVarint(input, true);
+			for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
+				readVarint(input, true);
+				unsigned int timelineType = readByte(input);
+				int frameCount = readVarint(input, true);
+				switch (timelineType) {
+					case ATTACHMENT_DEFORM: {
+						readVarint(input, true);
+						input->cursor += 4;
+						for (int frame = 0; frame < frameCount; ++frame) {
+							int end = readVarint(input, true);
+							if (end != 0) {
+								readVarint(input, true);
+								input->cursor += end * 4;
+							}
+							if (frame == frameCount - 1) break;
+							input->cursor += 4;
+							if (readSByte(input) == CURVE_BEZIER) input->cursor += 16;
+						}
+						break;
+					}
+					case ATTACHMENT_SEQUENCE:
+						input->cursor += frameCount * 12;
+						break;
+				}
+			}
+		}
+	}
+
+	// Draw order timeline.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		input->cursor += 4;
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			readVarint(input, true);
+			readVarint(input, true);
+		}
+	}
+
+	// Event timeline.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		input->cursor += 4;
+		EventData *eventData = skeletonData->_events[readVarint(input, true)];
+		readVarint(input, false);
+		input->cursor += 4;
+		int length = readVarint(input, true);
+		if (length > 0) input->cursor += length - 1;
+		if (!eventData->_audioPath.isEmpty()) input->cursor += 8;
+	}
+
+	if (input->cursor > input->end) {
+		setError("Animation data is truncated", NULL);
+		return false;
+	}
+	return true;
+}
+
+/* Writing, the inverse of the reading above. */
+
+static const RTTI *slotTimelineTypes[] = {&AttachmentTimeline::rtti, &RGBATimeline::rtti, &RGBTimeline::rtti,
+										  &RGBA2Timeline::rtti, &RGB2Timeline::rtti, &AlphaTimeline::rtti};
+
+static const RTTI *boneTimelineTypes[] = {&RotateTimeline::rtti, &TranslateTimeline::rtti, &TranslateXTimeline::rtti,
+										  &TranslateYTimeline::rtti, &ScaleTimeline::rtti, &ScaleXTimeline::rtti,
+										  &ScaleYTimeline::rtti, &ShearTimeline::rtti, &ShearXTimeline::rtti,
+										  &ShearYTimeline::rtti, &InheritTimeline::rtti};
+
+static const RTTI *pathTimelineTypes[] = {&PathConstraintPositionTimeline::rtti, &PathConstraintSpacingTimeline::rtti,
+										  &PathConstraintMixTimeline::rtti};
+
+static const RTTI *physicsTimelineTypes[] = {&PhysicsConstraintInertiaTimeline::rtti,
+											 &PhysicsConstraintStrengthTimeline::rtti,
+											 &PhysicsConstraintDampingTimeline::rtti, NULL,
+											 &PhysicsConstraintMassTimeline::rtti, &PhysicsConstraintWindTimeline::rtti,
+											 &PhysicsConstraintGravityTimeline::rtti,
+											 &PhysicsConstraintMixTimeline::rtti,
+											 &PhysicsConstraintResetTimeline::rtti};
+
+/* Returns the binary type of the timeline, its index in types, or -1 if it isn't one of them. */
+static int findTimelineType(Timeline *timeline, const RTTI **types, int count) {
+	for (int i = 0; i < count; i++)
+		if (types[i] && timeline->getRTTI().isExactly(*types[i])) return i;
+	return -1;
+}
+
+/* The bone, slot or constraint index is the low half of the first property id, -1 for the global physics timelines. */
+static int getTimelineIndex(Timeline *timeline) {
+	return (int) (timeline->getPropertyIds()[0] & 0xffffffff);
+}
+
+/* Collects the distinct indices of the timelines of the specified types, in ascending order. */
+static void findTimelineIndices(Vector<Timeline *> &timelines, const RTTI **types, int count, Vector<int> &indices) {
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (findTimelineType(timelines[i], types, count) < 0) continue;
+		int index = getTimelineIndex(timelines[i]);
+		if (indices.indexOf(index) >= 0) continue;
+		size_t ii = indices.size();
+		indices.add(index);
+		for (; ii > 0 && indices[ii - 1] > index; ii--) indices[ii] = indices[ii - 1];
+		indices[ii] = index;
+	}
+}
+
+static int colorByte(float value) {
+	return (int) (MathUtil::clamp(value, 0, 1) * 255 + 0.5f);
+}
+
+static bool isWhite(const Color &color) {
+	return color.r == 1 && color.g == 1 && color.b == 1 && color.a == 1;
+}
+
+/* Finds the skin and the name under which an attachment is stored for a slot. */
+static int findSkinEntry(Vector<Skin *> &skins, size_t slotIndex, Attachment *attachment, String &name) {
+	for (size_t i = 0; i < skins.size(); i++) {
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = entries.next();
+			if (entry._slotIndex == slotIndex && entry._attachment == attachment) {
+				name = entry._name;
+				return (int) i;
+			}
+		}
+	}
+	return -1;
+}
+
+bool SkeletonBinary::writeSkeletonData(SkeletonData *skeletonData, Vector<unsigned char> &binary) {
+	DataOutput output;
+
+	/* The skins are written default skin first, as readSkeletonData adds them. */
+	Vector<Skin *> skins;
+	Skin *defaultSkin = skeletonData->_defaultSkin;
+	if (defaultSkin && defaultSkin->getAttachments().hasNext()) skins.add(defaultSkin);
+	for (size_t i = 0; i < skeletonData->_skins.size(); i++)
+		if (skeletonData->_skins[i] != defaultSkin) skins.add(skeletonData->_skins[i]);
+
+	/* Bones. */
+	writeVarint(&output, (int) skeletonData->_bones.size(), true);
+	for (size_t i = 0; i < skeletonData->_bones.size(); i++) {
+		BoneData *data = skeletonData->_bones[i];
+		writeString(&output, data->_name);
+		if (i > 0) writeVarint(&output, data->_parent->getIndex(), true);
+		writeFloat(&output, data->_rotation);
+		writeFloat(&output, data->_x);
+		writeFloat(&output, data->_y);
+		writeFloat(&output, data->_scaleX);
+		writeFloat(&output, data->_scaleY);
+		writeFloat(&output, data->_shearX);
+		writeFloat(&output, data->_shearY);
+		writeFloat(&output, data->_length);
+		writeVarint(&output, data->_inherit, true);
+		writeBoolean(&output, data->_skinRequired);
+	}
+
+	/* Slots. */
+	writeVarint(&output, (int) skeletonData->_slots.size(), true);
+	for (size_t i = 0; i < skeletonData->_slots.size(); i++) {
+		SlotData *data = skeletonData->_slots[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, data->_boneData.getIndex(), true);
+		writeColor(&output, data->_color);
+		if (data->_hasDarkColor) {
+			writeByte(&output, 0);
+			writeByte(&output, colorByte(data->_darkColor.r));
+			writeByte(&output, colorByte(data->_darkColor.g));
+			writeByte(&output, colorByte(data->_darkColor.b));
+		} else {
+			writeInt(&output, -1);
+		}
+		writeStringRef(&output, data->_attachmentName);
+		writeVarint(&output, data->_blendMode, true);
+	}
+
+	/* IK constraints. */
+	writeVarint(&output, (int) skeletonData->_ikConstraints.size(), true);
+	for (size_t i = 0; i < skeletonData->_ikConstraints.size(); i++) {
+		IkConstraintData *data = skeletonData->_ikConstraints[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, (int) data->getOrder(), true);
+		writeVarint(&output, (int) data->_bones.size(), true);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			writeVarint(&output, data->_bones[ii]->getIndex(), true);
+		writeVarint(&output, data->_target->getIndex(), true);
+		int flags = 32 | 64 | 128;
+		if (data->_skinRequired) flags |= 1;
+		if (data->_bendDirection == 1) flags |= 2;
+		if (data->_compress) flags |= 4;
+		if (data->_stretch) flags |= 8;
+		if (data->_uniform) flags |= 16;
+		writeByte(&output, flags);
+		writeFloat(&output, data->_mix);
+		writeFloat(&output, data->_softness);
+	}
+
+	/* Transform constraints. */
+	writeVarint(&output, (int) skeletonData->_transformConstraints.size(), true);
+	for (size_t i = 0; i < skeletonData->_transformConstraints.size(); i++) {
+		TransformConstraintData *data = skeletonData->_transformConstraints[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, (int) data->getOrder(), true);
+		writeVarint(&output, (int) data->_bones.size(), true);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			writeVarint(&output, data->_bones[ii]->getIndex(), true);
+		writeVarint(&output, data->_target->getIndex(), true);
+		int flags = 8 | 16 | 32 | 64 | 128;
+		if (data->_skinRequired) flags |= 1;
+		if (data->_local) flags |= 2;
+		if (data->_relative) flags |= 4;
+		writeByte(&output, flags);
+		writeFloat(&output, data->_offsetRotation);
+		writeFloat(&output, data->_offsetX);
+		writeFloat(&output, data->_offsetY);
+		writeFloat(&output, data->_offsetScaleX);
+		writeFloat(&output, data->_offsetScaleY);
+		writeByte(&output, 127);
+		writeFloat(&output, data->_offsetShearY);
+		writeFloat(&output, data->_mixRotate);
+		writeFloat(&output, data->_mixX);
+		writeFloat(&output, data->_mixY);
+		writeFloat(&output, data->_mixScaleX);
+		writeFloat(&output, data->_mixScaleY);
+		writeFloat(&output, data->_mixShearY);
+	}
+
+	/* Path constraints. */
+	writeVarint(&output, (int) skeletonData->_pathConstraints.size(), true);
+	for (size_t i = 0; i < skeletonData->_pathConstraints.size(); i++) {
+		PathConstraintData *data = skeletonData->_pathConstraints[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, (int) data->getOrder(), true);
+		writeBoolean(&output, data->_skinRequired);
+		writeVarint(&output, (int) data->_bones.size(), true);
+		for (size_t ii = 0; ii < data->_bones.size(); ii++)
+			writeVarint(&output, data->_bones[ii]->getIndex(), true);
+		writeVarint(&output, data->_target->getIndex(), true);
+		writeByte(&output, data->_positionMode | (data->_spacingMode << 1) | (data->_rotateMode << 3) | 128);
+		writeFloat(&output, data->_offsetRotation);
+		writeFloat(&output, data->_position);
+		writeFloat(&output, data->_spacing);
+		writeFloat(&output, data->_mixRotate);
+		writeFloat(&output, data->_mixX);
+		writeFloat(&output, data->_mixY);
+	}
+
+	/* Physics constraints. */
+	writeVarint(&output, (int) skeletonData->_physicsConstraints.size(), true);
+	for (size_t i = 0; i < skeletonData->_physicsConstraints.size(); i++) {
+		PhysicsConstraintData *data = skeletonData->_physicsConstraints[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, (int) data->_order, true);
+		writeVarint(&output, data->_bone->getIndex(), true);
+		writeByte(&output, (data->_skinRequired ? 1 : 0) | 2 | 4 | 8 | 16 | 32 | 64 | 128);
+		writeFloat(&output, data->_x);
+		writeFloat(&output, data->_y);
+		writeFloat(&output, data->_rotate);
+		writeFloat(&output, data->_scaleX);
+		writeFloat(&output, data->_shearX);
+		writeFloat(&output, data->_limit);
+		writeByte(&output, (int) (1 / data->_step + 0.5f));
+		writeFloat(&output, data->_inertia);
+		writeFloat(&output, data->_strength);
+		writeFloat(&output, data->_damping);
+		writeFloat(&output, data->_massInverse);
+		writeFloat(&output, data->_wind);
+		writeFloat(&output, data->_gravity);
+		int flags = 128;
+		if (data->_inertiaGlobal) flags |= 1;
+		if (data->_strengthGlobal) flags |= 2;
+		if (data->_dampingGlobal) flags |= 4;
+		if (data->_massGlobal) flags |= 8;
+		if (data->_windGlobal) flags |= 16;
+		if (data->_gravityGlobal) flags |= 32;
+		if (data->_mixGlobal) flags |= 64;
+		writeByte(&output, flags);
+		writeFloat(&output, data->_mix);
+	}
+
+	/* Skins. */
+	if (skins.size() > 0 && skins[0] == defaultSkin) {
+		if (!writeSkin(&output, defaultSkin, true, skeletonData, skins)) return false;
+	} else {
+		writeVarint(&output, 0, true);
+	}
+	writeVarint(&output, (int) (skins.size() > 0 && skins[0] == defaultSkin ? skins.size() - 1 : skins.size()), true);
+	for (size_t i = 0; i < skins.size(); i++) {
+		if (skins[i] == defaultSkin) continue;
+		if (!writeSkin(&output, skins[i], false, skeletonData, skins)) return false;
+	}
+
+	/* Events. */
+	writeVarint(&output, (int) skeletonData->_events.size(), true);
+	for (size_t i = 0; i < skeletonData->_events.size(); i++) {
+		EventData *data = skeletonData->_events[i];
+		writeString(&output, data->_name);
+		writeVarint(&output, data->_intValue, false);
+		writeFloat(&output, data->_floatValue);
+		writeString(&output, data->_stringValue);
+		writeString(&output, data->_audioPath);
+		if (!data->_audioPath.isEmpty()) {
+			writeFloat(&output, data->_volume);
+			writeFloat(&output, data->_balance);
+		}
+	}
+
+	/* Animations. */
+	writeVarint(&output, (int) skeletonData->_animations.size(), true);
+	for (size_t i = 0; i < skeletonData->_animations.size(); i++) {
+		Animation *animation = skeletonData->_animations[i];
+		writeString(&output, animation->getName());
+		if (!writeTimelines(&output, skeletonData, animation, skins)) return false;
+	}
+
+	/* The header and the string table go before the data, the strings are only known after writing it. The hash can't
+	 * be reproduced from the text readSkeletonData makes of it and is left zero. */
+	DataOutput header;
+	writeInt(&header, 0);
+	writeInt(&header, 0);
+	writeString(&header, skeletonData->_version);
+	writeFloat(&header, skeletonData->_x);
+	writeFloat(&header, skeletonData->_y);
+	writeFloat(&header, skeletonData->_width);
+	writeFloat(&header, skeletonData->_height);
+	writeFloat(&header, skeletonData->_referenceScale);
+	writeBoolean(&header, false);
+	writeVarint(&header, (int) output.strings.size(), true);
+	for (size_t i = 0; i < output.strings.size(); i++)
+		writeString(&header, String(output.strings[i], true, false));
+
+	binary.clear();
+	binary.ensureCapacity(header.bytes.size() + output.bytes.size());
+	binary.addAll(header.bytes);
+	binary.addAll(output.bytes);
+	return true;
+}
+
+void SkeletonBinary::writeByte(DataOutput *output, int value) {
+	output->bytes.add((unsigned char) value);
+}
+
+void SkeletonBinary::writeBoolean(DataOutput *output, bool value) {
+	writeByte(output, value ? 1 : 0);
+}
+
+void SkeletonBinary::writeInt(DataOutput *output, int value) {
+	writeByte(output, (unsigned int) value >> 24);
+	writeByte(output, (unsigned int) value >> 16);
+	writeByte(output, (unsigned int) value >> 8);
+	writeByte(output, value);
+}
+
+void SkeletonBinary::writeFloat(DataOutput *output, float value) {
+	union {
+		int intValue;
+		float floatValue;
+	} floatToInt;
+	floatToInt.floatValue = value;
+	writeInt(output, floatToInt.intValue);
+}
+
+void SkeletonBinary::writeVarint(DataOutput *output, int value, bool optimizePositive) {
+	unsigned int bits = optimizePositive ? (unsigned int) value : ((unsigned int) value << 1) ^ (unsigned int) (value >> 31);
+	while (bits > 0x7F) {
+		writeByte(output, (bits & 0x7F) | 0x80);
+		bits >>= 7;
+	}
+	writeByte(output, bits);
+}
+
+void SkeletonBinary::writeString(DataOutput *output, const String &string) {
+	if (!string.buffer()) {
+		writeVarint(output, 0, true);
+		return;
+	}
+	writeVarint(output, (int) string.length() + 1, true);
+	for (size_t i = 0; i < string.length(); i++)
+		writeByte(output, string.buffer()[i]);
+}
+
+void SkeletonBinary::writeStringRef(DataOutput *output, const String &string) {
+	if (string.isEmpty()) {
+		writeVarint(output, 0, true);
+		return;
+	}
+	size_t i = 0;
+	for (; i < output->strings.size(); i++)
+		if (strcmp(output->strings[i], string.buffer()) == 0) break;
+	if (i == output->strings.size()) output->strings.add(string.buffer());
+	writeVarint(output, (int) i + 1, true);
+}
+
+void SkeletonBinary::writeColor(DataOutput *output, const Color &color) {
+	writeByte(output, colorByte(color.r));
+	writeByte(output, colorByte(color.g));
+	writeByte(output, colorByte(color.b));
+	writeByte(output, colorByte(color.a));
+}
+
+bool SkeletonBinary::writeSkin(DataOutput *output, Skin *skin, bool defaultSkin, SkeletonData *skeletonData,
+							   Vector<Skin *> &skins) {
+	if (!defaultSkin) {
+		writeString(output, skin->getName());
+
+		Vector<ConstraintData *> &constraints = skin->getConstraints();
+		writeVarint(output, (int) skin->getBones().size(), true);
+		for (size_t i = 0; i < skin->getBones().size(); i++)
+			writeVarint(output, skin->getBones()[i]->getIndex(), true);
+
+		Vector<int> indices;
+		for (size_t i = 0; i < skeletonData->_ikConstraints.size(); i++)
+			if (constraints.indexOf(skeletonData->_ikConstraints[i]) >= 0) indices.add((int) i);
+		writeVarint(output, (int) indices.size(), true);
+		for (size_t i = 0; i < indices.size(); i++) writeVarint(output, indices[i], true);
+
+		indices.clear();
+		for (size_t i = 0; i < skeletonData->_transformConstraints.size(); i++)
+			if (constraints.indexOf(skeletonData->_transformConstraints[i]) >= 0) indices.add((int) i);
+		writeVarint(output, (int) indices.size(), true);
+		for (size_t i = 0; i < indices.size(); i++) writeVarint(output, indices[i], true);
+
+		indices.clear();
+		for (size_t i = 0; i < skeletonData->_pathConstraints.size(); i++)
+			if (constraints.indexOf(skeletonData->_pathConstraints[i]) >= 0) indices.add((int) i);
+		writeVarint(output, (int) indices.size(), true);
+		for (size_t i = 0; i < indices.size(); i++) writeVarint(output, indices[i], true);
+
+		indices.clear();
+		for (size_t i = 0; i < skeletonData->_physicsConstraints.size(); i++)
+			if (constraints.indexOf(skeletonData->_physicsConstraints[i]) >= 0) indices.add((int) i);
+		writeVarint(output, (int) indices.size(), true);
+		for (size_t i = 0; i < indices.size(); i++) writeVarint(output, indices[i], true);
+	}
+
+	/* The entries are written grouped by slot. */
+	Vector<int> counts;
+	counts.setSize(skeletonData->_slots.size(), 0);
+	int slotCount = 0;
+	Skin::AttachmentMap::Entries entries = skin->getAttachments();
+	while (entries.hasNext()) {
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		if (counts[entry._slotIndex]++ == 0) slotCount++;
+	}
+
+	writeVarint(output, slotCount, true);
+	for (size_t i = 0; i < counts.size(); i++) {
+		if (counts[i] == 0) continue;
+		writeVarint(output, (int) i, true);
+		writeVarint(output, counts[i], true);
+		Skin::AttachmentMap::Entries slotEntries = skin->getAttachments();
+		while (slotEntries.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = slotEntries.next();
+			if (entry._slotIndex != i) continue;
+			writeStringRef(output, entry._name);
+			if (!writeAttachment(output, (int) i, entry._name, entry._attachment, skeletonData, skins)) return false;
+		}
+	}
+	return true;
+}
+
+void SkeletonBinary::writeSequence(DataOutput *output, Sequence *sequence) {
+	writeVarint(output, (int) sequence->_regions.size(), true);
+	writeVarint(output, sequence->_start, true);
+	writeVarint(output, sequence->_digits, true);
+	writeVarint(output, sequence->_setupIndex, true);
+}
+
+bool SkeletonBinary::writeAttachment(DataOutput *output, int slotIndex, const String &attachmentName,
+									 Attachment *attachment, SkeletonData *skeletonData, Vector<Skin *> &skins) {
+	const RTTI &rtti = attachment->getRTTI();
+	const String &name = attachment->getName();
+	int flags = name != attachmentName ? 8 : 0;
+
+	if (rtti.isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+		if (region->_path != name) flags |= 16;
+		if (!isWhite(region->_color)) flags |= 32;
+		if (region->_sequence) flags |= 64;
+		if (region->_rotation != 0) flags |= 128;
+		writeByte(output, AttachmentType_Region | flags);
+		if (flags & 8) writeStringRef(output, name);
+		if (flags & 16) writeStringRef(output, region->_path);
+		if (flags & 32) writeColor(output, region->_color);
+		if (flags & 64) writeSequence(output, region->_sequence);
+		if (flags & 128) writeFloat(output, region->_rotation);
+		writeFloat(output, region->_x);
+		writeFloat(output, region->_y);
+		writeFloat(output, region->_scaleX);
+		writeFloat(output, region->_scaleY);
+		writeFloat(output, region->_width);
+		writeFloat(output, region->_height);
+	} else if (rtti.isExactly(BoundingBoxAttachment::rtti)) {
+		BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+		if (box->_bones.size() > 0) flags |= 16;
+		writeByte(output, AttachmentType_Boundingbox | flags);
+		if (flags & 8) writeStringRef(output, name);
+		writeVertices(output, box);
+	} else if (rtti.isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+		if (mesh->_path != name) flags |= 16;
+		if (!isWhite(mesh->_color)) flags |= 32;
+		if (mesh->_sequence) flags |= 64;
+		MeshAttachment *parent = mesh->_parentMesh;
+		if (parent) {
+			String parentName;
+			int skinIndex = findSkinEntry(skins, slotIndex, parent, parentName);
+			if (skinIndex < 0) {
+				setError("Parent mesh not found: ", name.buffer());
+				return false;
+			}
+			if (mesh->_timelineAttachment == parent) flags |= 128;
+			writeByte(output, AttachmentType_Linkedmesh | flags);
+			if (flags & 8) writeStringRef(output, name);
+			if (flags & 16) writeStringRef(output, mesh->_path);
+			if (flags & 32) writeColor(output, mesh->_color);
+			if (flags & 64) writeSequence(output, mesh->_sequence);
+			writeVarint(output, skinIndex, true);
+			writeStringRef(output, parentName);
+			return true;
+		}
+		if (mesh->_bones.size() > 0) flags |= 128;
+		int verticesLength = (int) mesh->_worldVerticesLength;
+		if ((int) mesh->_regionUVs.size() != verticesLength ||
+			(int) mesh->_triangles.size() != (verticesLength - mesh->_hullLength - 2) * 3) {
+			setError("Mesh triangles can't be written: ", name.buffer());
+			return false;
+		}
+		writeByte(output, AttachmentType_Mesh | flags);
+		if (flags & 8) writeStringRef(output, name);
+		if (flags & 16) writeStringRef(output, mesh->_path);
+		if (flags & 32) writeColor(output, mesh->_color);
+		if (flags & 64) writeSequence(output, mesh->_sequence);
+		writeVarint(output, mesh->_hullLength, true);
+		writeVertices(output, mesh);
+		for (size_t i = 0; i < mesh->_regionUVs.size(); i++) writeFloat(output, mesh->_regionUVs[i]);
+		for (size_t i = 0; i < mesh->_triangles.size(); i++) writeVarint(output, mesh->_triangles[i], true);
+	} else if (rtti.isExactly(PathAttachment::rtti)) {
+		PathAttachment *path = static_cast<PathAttachment *>(attachment);
+		if (path->_closed) flags |= 16;
+		if (path->_constantSpeed) flags |= 32;
+		if (path->_bones.size() > 0) flags |= 64;
+		writeByte(output, AttachmentType_Path | flags);
+		if (flags & 8) writeStringRef(output, name);
+		writeVertices(output, path);
+		for (size_t i = 0, n = path->_worldVerticesLength / 6; i < n; i++) writeFloat(output, path->_lengths[i]);
+	} else if (rtti.isExactly(PointAttachment::rtti)) {
+		PointAttachment *point = static_cast<PointAttachment *>(attachment);
+		writeByte(output, AttachmentType_Point | flags);
+		if (flags & 8) writeStringRef(output, name);
+		writeFloat(output, point->_rotation);
+		writeFloat(output, point->_x);
+		writeFloat(output, point->_y);
+	} else if (rtti.isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+		if (clip->_bones.size() > 0) flags |= 16;
+		writeByte(output, AttachmentType_Clipping | flags);
+		if (flags & 8) writeStringRef(output, name);
+		/* Without an end slot the clipping ends after the last slot, which is what the binary format can store. */
+		writeVarint(output, clip->_endSlot ? clip->_endSlot->getIndex() : (int) skeletonData->_slots.size() - 1, true);
+		writeVertices(output, clip);
+	} else {
+		setError("Attachment type can't be written: ", name.buffer());
+		return false;
+	}
+	return true;
+}
+
+void SkeletonBinary::writeVertices(DataOutput *output, VertexAttachment *attachment) {
+	int vertexCount = (int) attachment->_worldVerticesLength >> 1;
+	writeVarint(output, vertexCount, true);
+	Vector<float> &vertices = attachment->_vertices;
+	Vector<int> &bones = attachment->_bones;
+	if (bones.size() == 0) {
+		for (size_t i = 0; i < vertices.size(); i++) writeFloat(output, vertices[i]);
+		return;
+	}
+	for (size_t v = 0, b = 0; v < vertices.size();) {
+		int boneCount = bones[b++];
+		writeVarint(output, boneCount, true);
+		for (int i = 0; i < boneCount; i++, v += 3) {
+			writeVarint(output, bones[b++], true);
+			writeFloat(output, vertices[v]);
+			writeFloat(output, vertices[v + 1]);
+			writeFloat(output, vertices[v + 2]);
+		}
+	}
+}
+
+void SkeletonBinary::writeBezier(DataOutput *output, CurveTimeline *timeline, size_t frame, int channels) {
+	Vector<float> &curves = timeline->getCurves();
+	size_t i = (size_t) curves[frame] - CURVE_BEZIER;
+	for (int n = channels * 4; n > 0; n--, i++) writeFloat(output, curves[i]);
+}
+
+void SkeletonBinary::writeCurveTimeline(DataOutput *output, CurveTimeline *timeline, bool colorBytes) {
+	Vector<float> &frames = timeline->getFrames();
+	Vector<float> &curves = timeline->getCurves();
+	int channels = (int) timeline->getFrameEntries() - 1;
+	size_t frameCount = timeline->getFrameCount();
+	int bezierCount = 0;
+	for (size_t frame = 0; frame + 1 < frameCount; frame++)
+		if (curves[frame] >= CURVE_BEZIER) bezierCount += channels;
+	writeVarint(output, bezierCount, true);
+
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		size_t i = frame * timeline->getFrameEntries();
+		writeFloat(output, frames[i]);
+		for (int c = 1; c <= channels; c++) {
+			if (colorBytes)
+				writeByte(output, colorByte(frames[i + c]));
+			else
+				writeFloat(output, frames[i + c]);
+		}
+		/* The curve of a frame goes after the values of the next one. */
+		if (frame > 0) {
+			if (curves[frame - 1] >= CURVE_BEZIER) {
+				writeByte(output, CURVE_BEZIER);
+				writeBezier(output, timeline, frame - 1, channels);
+			} else {
+				writeByte(output, (int) curves[frame - 1]);
+			}
+		}
+	}
+}
+
+bool SkeletonBinary::writeTimelines(DataOutput *output, SkeletonData *skeletonData, Animation *animation,
+									Vector<Skin *> &skins) {
+	Vector<Timeline *> &timelines = animation->getTimelines();
+
+	/* Only the control values of the curves can be written. */
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (!timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+		CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[i]);
+		if (timeline->isCompact()) continue;
+		for (size_t frame = 0; frame + 1 < timeline->getFrameCount(); frame++) {
+			if (timeline->getCurves()[frame] >= CURVE_BEZIER) {
+				setError("Curves must be loaded compact to be written: ", animation->getName().buffer());
+				return false;
+			}
+		}
+	}
+
+	/* Deform and sequence timelines are grouped by the skin and name of their attachment, those of attachments that
+	 * aren't in the written skins are left out. */
+	Vector<Timeline *> attachmentTimelines;
+	Vector<int> attachmentSkins;
+	Vector<int> attachmentSlots;
+	Vector<String> attachmentNames;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		Timeline *timeline = timelines[i];
+		int slotIndex;
+		Attachment *attachment;
+		if (timeline->getRTTI().isExactly(DeformTimeline::rtti)) {
+			slotIndex = static_cast<DeformTimeline *>(timeline)->_slotIndex;
+			attachment = static_cast<DeformTimeline *>(timeline)->_attachment;
+		} else if (timeline->getRTTI().isExactly(SequenceTimeline::rtti)) {
+			slotIndex = static_cast<SequenceTimeline *>(timeline)->_slotIndex;
+			attachment = static_cast<SequenceTimeline *>(timeline)->_attachment;
+		} else {
+			continue;
+		}
+		String name;
+		int skinIndex = findSkinEntry(skins, slotIndex, attachment, name);
+		if (skinIndex < 0) continue;
+		attachmentTimelines.add(timeline);
+		attachmentSkins.add(skinIndex);
+		attachmentSlots.add(slotIndex);
+		attachmentNames.add(name);
+	}
+
+	size_t attachmentTimelineCount = 0;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (timelines[i]->getRTTI().isExactly(DeformTimeline::rtti) ||
+			timelines[i]->getRTTI().isExactly(SequenceTimeline::rtti))
+			attachmentTimelineCount++;
+	}
+	writeVarint(output, (int) (timelines.size() - attachmentTimelineCount + attachmentTimelines.size()), true);
+
+	// Slot timelines.
+	Vector<int> indices;
+	findTimelineIndices(timelines, slotTimelineTypes, 6, indices);
+	writeVarint(output, (int) indices.size(), true);
+	for (size_t i = 0; i < indices.size(); i++) {
+		Vector<Timeline *> group;
+		for (size_t ii = 0; ii < timelines.size(); ii++)
+			if (findTimelineType(timelines[ii], slotTimelineTypes, 6) >= 0 && getTimelineIndex(timelines[ii]) == indices[i])
+				group.add(timelines[ii]);
+		writeVarint(output, indices[i], true);
+		writeVarint(output, (int) group.size(), true);
+		for (size_t ii = 0; ii < group.size(); ii++) {
+			int type = findTimelineType(group[ii], slotTimelineTypes, 6);
+			writeByte(output, type);
+			writeVarint(output, (int) group[ii]->getFrameCount(), true);
+			if (type == SLOT_ATTACHMENT) {
+				AttachmentTimeline *timeline = static_cast<AttachmentTimeline *>(group[ii]);
+				for (size_t frame = 0; frame < timeline->getFrameCount(); frame++) {
+					writeFloat(output, timeline->getFrames()[frame]);
+					writeStringRef(output, timeline->getAttachmentNames()[frame]);
+				}
+			} else {
+				writeCurveTimeline(output, static_cast<CurveTimeline *>(group[ii]), true);
+			}
+		}
+	}
+
+	// Bone timelines.
+	indices.clear();
+	findTimelineIndices(timelines, boneTimelineTypes, 11, indices);
+	writeVarint(output, (int) indices.size(), true);
+	for (size_t i = 0; i < indices.size(); i++) {
+		Vector<Timeline *> group;
+		for (size_t ii = 0; ii < timelines.size(); ii++)
+			if (findTimelineType(timelines[ii], boneTimelineTypes, 11) >= 0 && getTimelineIndex(timelines[ii]) == indices[i])
+				group.add(timelines[ii]);
+		writeVarint(output, indices[i], true);
+		writeVarint(output, (int) group.size(), true);
+		for (size_t ii = 0; ii < group.size(); ii++) {
+			int type = findTimelineType(group[ii], boneTimelineTypes, 11);
+			writeByte(output, type);
+			writeVarint(output, (int) group[ii]->getFrameCount(), true);
+			if (type == BONE_INHERIT) {
+				Vector<float> &frames = group[ii]->getFrames();
+				for (size_t frame = 0; frame < group[ii]->getFrameCount(); frame++) {
+					writeFloat(output, frames[frame * 2]);
+					writeByte(output, (int) frames[frame * 2 + 1]);
+				}
+			} else {
+				writeCurveTimeline(output, static_cast<CurveTimeline *>(group[ii]), false);
+			}
+		}
+	}
+
+	// IK timelines.
+	Vector<IkConstraintTimeline *> ikTimelines;
+	for (size_t i = 0; i < timelines.size(); i++)
+		if (timelines[i]->getRTTI().isExactly(IkConstraintTimeline::rtti))
+			ikTimelines.add(static_cast<IkConstraintTimeline *>(timelines[i]));
+	writeVarint(output, (int) ikTimelines.size(), true);
+	for (size_t i = 0; i < ikTimelines.size(); i++) {
+		IkConstraintTimeline *timeline = ikTimelines[i];
+		Vector<float> &frames = timeline->getFrames();
+		Vector<float> &curves = timeline->getCurves();
+		size_t frameCount = timeline->getFrameCount();
+		int bezierCount = 0;
+		for (size_t frame = 0; frame + 1 < frameCount; frame++)
+			if (curves[frame] >= CURVE_BEZIER) bezierCount += 2;
+		writeVarint(output, timeline->_constraintIndex, true);
+		writeVarint(output, (int) frameCount, true);
+		writeVarint(output, bezierCount, true);
+		for (size_t frame = 0; frame < frameCount; frame++) {
+			size_t f = frame * IkConstraintTimeline::ENTRIES;
+			float mix = frames[f + 1], softness = frames[f + 2];
+			int flags = 0;
+			if (mix != 0) flags |= mix != 1 ? 1 | 2 : 1;
+			if (softness != 0) flags |= 4;
+			if (frames[f + 3] == 1) flags |= 8;
+			if (frames[f + 4] != 0) flags |= 16;
+			if (frames[f + 5] != 0) flags |= 32;
+			if (frame > 0) {
+				if (curves[frame - 1] == CURVE_STEPPED) flags |= 64;
+				else if (curves[frame - 1] >= CURVE_BEZIER) flags |= 128;
+			}
+			writeByte(output, flags);
+			writeFloat(output, frames[f]);
+			if (flags & 2) writeFloat(output, mix);
+			if (flags & 4) writeFloat(output, softness);
+			if (flags & 128) writeBezier(output, timeline, frame - 1, 2);
+		}
+	}
+
+	// Transform constraint timelines.
+	Vector<TransformConstraintTimeline *> transformTimelines;
+	for (size_t i = 0; i < timelines.size(); i++)
+		if (timelines[i]->getRTTI().isExactly(TransformConstraintTimeline::rtti))
+			transformTimelines.add(static_cast<TransformConstraintTimeline *>(timelines[i]));
+	writeVarint(output, (int) transformTimelines.size(), true);
+	for (size_t i = 0; i < transformTimelines.size(); i++) {
+		writeVarint(output, transformTimelines[i]->_constraintIndex, true);
+		writeVarint(output, (int) transformTimelines[i]->getFrameCount(), true);
+		writeCurveTimeline(output, transformTimelines[i], false);
+	}
+
+	// Path constraint timelines.
+	indices.clear();
+	findTimelineIndices(timelines, pathTimelineTypes, 3, indices);
+	writeVarint(output, (int) indices.size(), true);
+	for (size_t i = 0; i < indices.size(); i++) {
+		Vector<Timeline *> group;
+		for (size_t ii = 0; ii < timelines.size(); ii++)
+			if (findTimelineType(timelines[ii], pathTimelineTypes, 3) >= 0 && getTimelineIndex(timelines[ii]) == indices[i])
+				group.add(timelines[ii]);
+		writeVarint(output, indices[i], true);
+		writeVarint(output, (int) group.size(), true);
+		for (size_t ii = 0; ii < group.size(); ii++) {
+			writeByte(output, findTimelineType(group[ii], pathTimelineTypes, 3));
+			writeVarint(output, (int) group[ii]->getFrameCount(), true);
+			writeCurveTimeline(output, static_cast<CurveTimeline *>(group[ii]), false);
+		}
+	}
+
+	// Physics timelines.
+	indices.clear();
+	findTimelineIndices(timelines, physicsTimelineTypes, 9, indices);
+	writeVarint(output, (int) indices.size(), true);
+	for (size_t i = 0; i < indices.size(); i++) {
+		Vector<Timeline *> group;
+		for (size_t ii = 0; ii < timelines.size(); ii++)
+			if (findTimelineType(timelines[ii], physicsTimelineTypes, 9) >= 0 && getTimelineIndex(timelines[ii]) == indices[i])
+				group.add(timelines[ii]);
+		writeVarint(output, indices[i] + 1, true);
+		writeVarint(output, (int) group.size(), true);
+		for (size_t ii = 0; ii < group.size(); ii++) {
+			int type = findTimelineType(group[ii], physicsTimelineTypes, 9);
+			writeByte(output, type);
+			writeVarint(output, (int) group[ii]->getFrameCount(), true);
+			if (type == PHYSICS_RESET) {
+				for (size_t frame = 0; frame < group[ii]->getFrameCount(); frame++)
+					writeFloat(output, group[ii]->getFrames()[frame]);
+			} else {
+				writeCurveTimeline(output, static_cast<CurveTimeline *>(group[ii]), false);
+			}
+		}
+	}
+
+	// Attachment timelines.
+	int skinCount = 0;
+	for (size_t i = 0; i < skins.size(); i++)
+		if (attachmentSkins.indexOf((int) i) >= 0) skinCount++;
+	writeVarint(output, skinCount, true);
+	for (size_t i = 0; i < skins.size(); i++) {
+		if (attachmentSkins.indexOf((int) i) < 0) continue;
+		indices.clear();
+		for (size_t ii = 0; ii < attachmentTimelines.size(); ii++) {
+			if (attachmentSkins[ii] != (int) i) continue;
+			if (indices.indexOf(attachmentSlots[ii]) < 0) indices.add(attachmentSlots[ii]);
+		}
+		writeVarint(output, (int) i, true);
+		writeVarint(output, (int) indices.size(), true);
+		for (size_t ii = 0; ii < indices.size(); ii++) {
+			int count = 0;
+			for (size_t t = 0; t < attachmentTimelines.size(); t++)
+				if (attachmentSkins[t] == (int) i && attachmentSlots[t] == indices[ii]) count++;
+			writeVarint(output, indices[ii], true);
+			writeVarint(output, count, true);
+			for (size_t t = 0; t < attachmentTimelines.size(); t++) {
+				if (attachmentSkins[t] != (int) i || attachmentSlots[t] != indices[ii]) continue;
+				Timeline *timeline = attachmentTimelines[t];
+				size_t frameCount = timeline->getFrameCount();
+				writeStringRef(output, attachmentNames[t]);
+				if (timeline->getRTTI().isExactly(SequenceTimeline::rtti)) {
+					Vector<float> &frames = timeline->getFrames();
+					writeByte(output, ATTACHMENT_SEQUENCE);
+					writeVarint(output, (int) frameCount, true);
+					for (size_t frame = 0; frame < frameCount; frame++) {
+						writeFloat(output, frames[frame * SequenceTimeline::ENTRIES]);
+						writeInt(output, (int) frames[frame * SequenceTimeline::ENTRIES + 1]);
+						writeFloat(output, frames[frame * SequenceTimeline::ENTRIES + 2]);
+					}
+					continue;
+				}
+
+				DeformTimeline *deform = static_cast<DeformTimeline *>(timeline);
+				VertexAttachment *attachment = deform->_attachment;
+				bool weighted = attachment->_bones.size() > 0;
+				Vector<float> &vertices = attachment->_vertices;
+				Vector<float> &curves = deform->getCurves();
+				int bezierCount = 0;
+				for (size_t frame = 0; frame + 1 < frameCount; frame++)
+					if (curves[frame] >= CURVE_BEZIER) bezierCount++;
+				writeByte(output, ATTACHMENT_DEFORM);
+				writeVarint(output, (int) frameCount, true);
+				writeVarint(output, bezierCount, true);
+				for (size_t frame = 0; frame < frameCount; frame++) {
+					writeFloat(output, deform->getFrames()[frame]);
+					if (frame > 0) {
+						if (curves[frame - 1] >= CURVE_BEZIER) {
+							writeByte(output, CURVE_BEZIER);
+							writeBezier(output, deform, frame - 1, 1);
+						} else {
+							writeByte(output, (int) curves[frame - 1]);
+						}
+					}
+
+					/* Only the run of the offsets from the setup vertices that aren't zero is stored. */
+					Vector<float> &values = deform->_vertices[frame];
+					Vector<float> delta;
+					delta.setSize(values.size(), 0);
+					int start = -1, end = -1;
+					for (size_t v = 0; v < values.size(); v++) {
+						delta[v] = weighted ? values[v] : values[v] - vertices[v];
+						if (delta[v] == 0) continue;
+						if (start < 0) start = (int) v;
+						end = (int) v + 1;
+					}
+					if (start < 0) {
+						writeVarint(output, 0, true);
+						continue;
+					}
+					writeVarint(output, end - start, true);
+					writeVarint(output, start, true);
+					for (int v = start; v < end; v++) writeFloat(output, delta[v]);
+				}
+			}
+		}
+	}
+
+	// Draw order timeline.
+	DrawOrderTimeline *drawOrder = NULL;
+	EventTimeline *events = NULL;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (timelines[i]->getRTTI().isExactly(DrawOrderTimeline::rtti))
+			drawOrder = static_cast<DrawOrderTimeline *>(timelines[i]);
+		else if (timelines[i]->getRTTI().isExactly(EventTimeline::rtti))
+			events = static_cast<EventTimeline *>(timelines[i]);
+	}
+	writeVarint(output, drawOrder ? (int) drawOrder->getFrameCount() : 0, true);
+	for (size_t i = 0; drawOrder && i < drawOrder->getFrameCount(); i++) {
+		Vector<int> &order = drawOrder->getDrawOrders()[i];
+		writeFloat(output, drawOrder->getFrames()[i]);
+		/* Each moved slot is stored with its offset, in slot order. An empty draw order is the setup order. */
+		int offsetCount = 0;
+		for (size_t ii = 0; ii < order.size(); ii++)
+			if (order[ii] != (int) ii) offsetCount++;
+		writeVarint(output, offsetCount, true);
+		for (size_t slotIndex = 0; slotIndex < order.size(); slotIndex++) {
+			int position = order.indexOf((int) slotIndex);
+			if (position == (int) slotIndex) continue;
+			writeVarint(output, (int) slotIndex, true);
+			writeVarint(output, position - (int) slotIndex, true);
+		}
+	}
+
+	// Event timeline.
+	writeVarint(output, events ? (int) events->getFrameCount() : 0, true);
+	for (size_t i = 0; events && i < events->getFrameCount(); i++) {
+		Event *event = events->getEvents()[i];
+		EventData *eventData = const_cast<EventData *>(&event->_data);
+		int index = skeletonData->_events.indexOf(eventData);
+		if (index < 0) {
+			setError("Event not found: ", eventData->_name.buffer());
+			return false;
+		}
+		writeFloat(output, event->_time);
+		writeVarint(output, index, true);
+		writeVarint(output, event->_intValue, false);
+		writeFloat(output, event->_floatValue);
+		if (event->_stringValue == eventData->_stringValue)
+			writeVarint(output, 0, true);
+		else
+			writeString(output, event->_stringValue);
+		if (!eventData->_audioPath.isEmpty()) {
+			writeFloat(output, event->_volume);
+			writeFloat(output, event->_balance);
+		}
+	}
+	return true;
 }
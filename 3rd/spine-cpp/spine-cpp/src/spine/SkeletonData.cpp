@@ -52,11 +52,14 @@ SkeletonData::SkeletonData() : _name(),
 							   _referenceScale(100),
 							   _version(),
 							   _hash(),
+							   _buffer(NULL),
+							   _animationLoader(NULL),
 							   _fps(0),
 							   _imagesPath() {
 }
 
 SkeletonData::~SkeletonData() {
+	_arena.retire();
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_skins);
@@ -69,21 +72,26 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
+	if (_animationLoader) delete _animationLoader;
+	if (_buffer) {
+		delete _buffer;
+		return;
+	}
 	for (size_t i = 0; i < _strings.size(); i++) {
 		SpineExtension::free(_strings[i], __FILE__, __LINE__);
 	}
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	return _boneIndex.find(_bones, boneName);
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	return _slotIndex.find(_slots, slotName);
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	return _skinIndex.find(_skins, skinName);
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
@@ -91,7 +99,7 @@ spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	return _animationIndex.find(_animations, animationName);
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
@@ -110,6 +118,13 @@ PhysicsConstraintData *SkeletonData::findPhysicsConstraint(const String &constra
 	return ContainerUtil::findWithName(_physicsConstraints, constraintName);
 }
 
+void SkeletonData::updateNameIndex() {
+	_boneIndex.build(_bones);
+	_slotIndex.build(_slots);
+	_skinIndex.build(_skins);
+	_animationIndex.build(_animations);
+}
+
 const String &SkeletonData::getName() {
 	return _name;
 }
@@ -146,6 +161,11 @@ Vector<Animation *> &SkeletonData::getAnimations() {
 	return _animations;
 }
 
+void SkeletonData::bakeAnimations(float fps, bool quantize) {
+	for (size_t i = 0; i < _animations.size(); i++)
+		_animations[i]->bake(*this, fps, quantize);
+}
+
 Vector<IkConstraintData *> &SkeletonData::getIkConstraints() {
 	return _ikConstraints;
 }
@@ -242,3 +262,11 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+SkeletonDataBuffer *SkeletonData::getBuffer() {
+	return _buffer;
+}
+
+Arena &SkeletonData::getArena() {
+	return _arena;
+}
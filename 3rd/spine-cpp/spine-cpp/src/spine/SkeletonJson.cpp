@@ -53,6 +53,7 @@
 #include <spine/IkConstraintTimeline.h>
 #include <spine/InheritTimeline.h>
 #include <spine/MeshAttachment.h>
+#include <spine/NameIndex.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PathConstraintMixTimeline.h>
@@ -102,11 +103,15 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _ownsLoader(true), _compactCurves(false),
+										   _streaming(true), _arena(false) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
-																				  _ownsLoader(ownsLoader) {
+																				  _ownsLoader(ownsLoader),
+																				  _compactCurves(false),
+																				  _streaming(true),
+																				  _arena(false) {
 	assert(_attachmentLoader != NULL);
 }
 
@@ -136,11 +141,17 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	int i, ii;
 	SkeletonData *skeletonData;
 	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *physics, *slots, *skins, *animations, *events;
+	const char *animationsJson = NULL;
 
 	_error = "";
 	_linkedMeshes.clear();
+	_internTable.clear();
 
-	root = new (__FILE__, __LINE__) Json(json);
+	/* When streaming, the animations are parsed last and one at a time, after everything they reference. */
+	if (_streaming)
+		root = Json::parse(json, "animations", &animationsJson);
+	else
+		root = new (__FILE__, __LINE__) Json(json);
 
 	if (!root) {
 		setError(NULL, "Invalid skeleton JSON: ", Json::getError());
@@ -148,6 +159,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	}
 
 	skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	ArenaScope scope(_arena ? &skeletonData->_arena : Arena::getCurrent());
 
 	skeleton = Json::getItem(root, "skeleton");
 	if (skeleton) {
@@ -157,7 +169,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			char errorMsg[255];
 			snprintf(errorMsg, 255, "Skeleton version %s does not match runtime version %s", skeletonData->_version.buffer(), SPINE_VERSION_STRING);
 			delete skeletonData;
-			setError(NULL, errorMsg, "");
+			setError(root, errorMsg, "");
 			return NULL;
 		}
 		skeletonData->_x = Json::getFloat(skeleton, "x", 0);
@@ -265,7 +277,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			}
 
 			item = Json::getItem(slotMap, "attachment");
-			if (item) data->setAttachmentName(item->_valueString);
+			if (item) data->setAttachmentName(internName(skeletonData, item->_valueString));
 
 			item = Json::getItem(slotMap, "blend");
 			if (item) {
@@ -700,6 +712,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 									_attachmentLoader->configureAttachment(mesh);
 								} else {
 									bool inheritTimelines = Json::getInt(attachmentMap, "timelines", 1) ? true : false;
+									/* The linked meshes are the reader's, not the skeleton data's. */
+									ArenaScope scope(NULL);
 									LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
 																								 String(Json::getString(
 																										 attachmentMap,
@@ -776,7 +790,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 							}
 						}
 
-						skin->setAttachment(slot->getIndex(), skinAttachmentName, attachment);
+						skin->setAttachment(slot->getIndex(), internName(skeletonData, skinAttachmentName), attachment);
 					}
 				}
 		}
@@ -830,9 +844,19 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		}
 	}
 
+	/* Timelines look up bones and slots by name. */
+	skeletonData->updateNameIndex();
+
 	/* Animations. */
-	animations = Json::getItem(root, "animations");
-	if (animations) {
+	if (animationsJson) {
+		/* Nothing else is needed from the document, release it before the largest part is parsed. */
+		delete root;
+		root = NULL;
+		if (!readAnimations(animationsJson, skeletonData)) {
+			delete skeletonData;
+			return NULL;
+		}
+	} else if ((animations = Json::getItem(root, "animations"))) {
 		Json *animationMap;
 		skeletonData->_animations.ensureCapacity(animations->_size);
 		skeletonData->_animations.setSize(animations->_size, 0);
@@ -847,6 +871,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			skeletonData->_animations[animationsIndex++] = animation;
 		}
 	}
+	skeletonData->updateNameIndex();
 
 	delete root;
 
@@ -865,6 +890,7 @@ Sequence *SkeletonJson::readSequence(Json *item) {
 void SkeletonJson::setBezier(CurveTimeline *timeline, int frame, int value, int bezier, float time1, float value1, float cx1,
 							 float cy1,
 							 float cx2, float cy2, float time2, float value2) {
+	if (_compactCurves && bezier == 0) timeline->setCompact(true);
 	timeline->setBezier(bezier, frame, value, time1, value1, cx1, cy1, cx2, cy2, time2, value2);
 }
 
@@ -903,7 +929,7 @@ Timeline *SkeletonJson::readTimeline(Json *keyMap, CurveTimeline1 *timeline, flo
 		value = value2;
 		keyMap = nextMap;
 	}
-	// timeline.shrink(); // BOZO
+	timeline->shrink(bezier);
 	return timeline;
 }
 
@@ -930,7 +956,7 @@ Timeline *SkeletonJson::readTimeline(Json *keyMap, CurveTimeline2 *timeline, con
 		value2 = nvalue2;
 		keyMap = nextMap;
 	}
-	// timeline.shrink(); // BOZO
+	timeline->shrink(bezier);
 	return timeline;
 }
 
@@ -968,8 +994,9 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 			if (strcmp(timelineMap->_name, "attachment") == 0) {
 				AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frames, slotIndex);
 				for (keyMap = timelineMap->_child, frame = 0; keyMap; keyMap = keyMap->_next, ++frame) {
+					Json *name = Json::getItem(keyMap, "name");
 					timeline->setFrame(frame, Json::getFloat(keyMap, "time", 0),
-									   Json::getItem(keyMap, "name") ? Json::getItem(keyMap, "name")->_valueString : NULL);
+									   internName(skeletonData, name ? name->_valueString : NULL));
 				}
 				timelines.add(timeline);
 
@@ -983,7 +1010,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					timeline->setFrame(frame, time, color.r, color.g, color.b, color.a);
 					nextMap = keyMap->_next;
 					if (!nextMap) {
-						// timeline.shrink(); // BOZO
+						timeline->shrink(bezier);
 						break;
 					}
 					float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1010,7 +1037,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					timeline->setFrame(frame, time, color.r, color.g, color.b);
 					nextMap = keyMap->_next;
 					if (!nextMap) {
-						// timeline.shrink(); // BOZO
+						timeline->shrink(bezier);
 						break;
 					}
 					float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1041,7 +1068,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					timeline->setFrame(frame, time, color.r, color.g, color.b, color.a, color2.r, color2.g, color2.b);
 					nextMap = keyMap->_next;
 					if (!nextMap) {
-						// timeline.shrink(); // BOZO
+						timeline->shrink(bezier);
 						break;
 					}
 					float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1074,7 +1101,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					timeline->setFrame(frame, time, color.r, color.g, color.b, color.a, color2.r, color2.g, color2.b);
 					nextMap = keyMap->_next;
 					if (!nextMap) {
-						// timeline.shrink(); // BOZO
+						timeline->shrink(bezier);
 						break;
 					}
 					float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1207,7 +1234,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 							   Json::getBoolean(keyMap, "stretch", false));
 			nextMap = keyMap->_next;
 			if (!nextMap) {
-				// timeline.shrink(); // BOZO
+				timeline->shrink(bezier);
 				break;
 			}
 
@@ -1251,7 +1278,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 			timeline->setFrame(frame, time, mixRotate, mixX, mixY, mixScaleX, mixScaleY, mixShearY);
 			nextMap = keyMap->_next;
 			if (!nextMap) {
-				// timeline.shrink(); // BOZO
+				timeline->shrink(bezier);
 				break;
 			}
 
@@ -1323,7 +1350,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					timeline->setFrame(frame, time, mixRotate, mixX, mixY);
 					nextMap = keyMap->_next;
 					if (!nextMap) {
-						// timeline.shrink(); // BOZO
+						timeline->shrink(bezier);
 						break;
 					}
 					float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1456,7 +1483,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 							timeline->setFrame(frame, time, deformed);
 							nextMap = keyMap->_next;
 							if (!nextMap) {
-								// timeline.shrink(); // BOZO
+								timeline->shrink(bezier);
 								break;
 							}
 							float time2 = Json::getFloat(nextMap, "time", 0);
@@ -1568,6 +1595,40 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 	return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
 }
 
+bool SkeletonJson::readAnimations(const char *json, SkeletonData *skeletonData) {
+	Vector<Animation *> &animations = skeletonData->_animations;
+	const char *value = Json::skip(json);
+
+	if (*value != '{') {
+		setError(NULL, "Invalid skeleton JSON: ", value);
+		return false;
+	}
+	value = Json::skip(value + 1);
+
+	/* Only one animation is held as Json items at a time. */
+	while (*value != '}') {
+		Json animationMap(NULL);
+		{
+			/* The items are released after each animation, they would only take space in the arena. */
+			ArenaScope scope(NULL);
+			value = Json::parseName(&animationMap, value);
+			if (value) value = Json::skip(Json::parseValue(&animationMap, value));
+		}
+		if (!value || (*value != ',' && *value != '}')) {
+			setError(NULL, "Invalid skeleton JSON: ", value ? value : Json::getError());
+			return false;
+		}
+		if (*value == ',') value = Json::skip(value + 1);
+
+		Animation *animation = readAnimation(&animationMap, skeletonData);
+		if (!animation) return false;
+		animations.add(animation);
+	}
+	animations.shrinkToFit();
+
+	return true;
+}
+
 void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength) {
 	Json *entry;
 	size_t i, n, nn, entrySize;
@@ -1609,9 +1670,46 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 
 	attachment->getVertices().clearAndAddAll(bonesAndWeights._vertices);
 	attachment->getBones().clearAndAddAll(bonesAndWeights._bones);
+	attachment->updateWeightLayout();
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
+	/* The error outlives the skeleton data that failed, and its arena. */
+	ArenaScope scope(NULL);
 	_error = String(value1).append(value2);
 	delete root;
 }
+
+/* Attachment names are kept once in the skeleton data's string table, like the binary format's. The skins, setup
+ * slots and attachment timelines borrow them, so matching names share characters and compare by pointer. */
+String SkeletonJson::internName(SkeletonData *skeletonData, const char *name) {
+	if (!name) return String();
+
+	Vector<char *> &strings = skeletonData->_strings;
+	if ((strings.size() + 1) * 2 > _internTable.size()) {
+		/* The table is the reader's, reused for the next skeleton. */
+		ArenaScope scope(NULL);
+		size_t capacity = _internTable.size() < 64 ? 64 : _internTable.size() * 2;
+		_internTable.clear();
+		_internTable.setSize(capacity, -1);
+		for (size_t i = 0; i < strings.size(); i++) {
+			size_t slot = NameIndex::hashName(String(strings[i], true, false)) & (capacity - 1);
+			while (_internTable[slot] != -1) slot = (slot + 1) & (capacity - 1);
+			_internTable[slot] = (int) i;
+		}
+	}
+
+	size_t mask = _internTable.size() - 1;
+	size_t slot = NameIndex::hashName(String(name, true, false)) & mask;
+	for (; _internTable[slot] != -1; slot = (slot + 1) & mask) {
+		char *chars = strings[_internTable[slot]];
+		if (strcmp(chars, name) == 0) return String(chars, true, false);
+	}
+
+	size_t length = strlen(name);
+	char *chars = SpineExtension::calloc<char>(length + 1, __FILE__, __LINE__);
+	memcpy(chars, name, length + 1);
+	_internTable[slot] = (int) strings.size();
+	strings.add(chars);
+	return String(chars, true, false);
+}
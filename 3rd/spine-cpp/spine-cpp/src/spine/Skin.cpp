@@ -53,7 +53,7 @@ void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, At
 	if (slotIndex >= _buckets.size())
 		_buckets.setSize(slotIndex + 1, Vector<Entry>());
 	Vector<Entry> &bucket = _buckets[slotIndex];
-	int existing = findInBucket(bucket, attachmentName);
+	int existing = findInBucket(bucket, attachmentName, NameIndex::hashName(attachmentName));
 	attachment->reference();
 	if (existing >= 0) {
 		disposeAttachment(bucket[existing]._attachment);
@@ -64,23 +64,28 @@ void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, At
 }
 
 Attachment *Skin::AttachmentMap::get(size_t slotIndex, const String &attachmentName) {
+	return get(slotIndex, attachmentName, NameIndex::hashName(attachmentName));
+}
+
+Attachment *Skin::AttachmentMap::get(size_t slotIndex, const String &attachmentName, unsigned int hash) {
 	if (slotIndex >= _buckets.size()) return NULL;
-	int existing = findInBucket(_buckets[slotIndex], attachmentName);
+	int existing = findInBucket(_buckets[slotIndex], attachmentName, hash);
 	return existing >= 0 ? _buckets[slotIndex][existing]._attachment : NULL;
 }
 
 void Skin::AttachmentMap::remove(size_t slotIndex, const String &attachmentName) {
 	if (slotIndex >= _buckets.size()) return;
-	int existing = findInBucket(_buckets[slotIndex], attachmentName);
+	int existing = findInBucket(_buckets[slotIndex], attachmentName, NameIndex::hashName(attachmentName));
 	if (existing >= 0) {
 		disposeAttachment(_buckets[slotIndex][existing]._attachment);
 		_buckets[slotIndex].removeAt(existing);
 	}
 }
 
-int Skin::AttachmentMap::findInBucket(Vector<Entry> &bucket, const String &attachmentName) {
+int Skin::AttachmentMap::findInBucket(Vector<Entry> &bucket, const String &attachmentName, unsigned int hash) {
+	// Buckets are per slot and hold few entries, comparing hashes first leaves one string compare per lookup.
 	for (size_t i = 0; i < bucket.size(); i++)
-		if (bucket[i]._name == attachmentName) return (int) i;
+		if (bucket[i]._hash == hash && bucket[i]._name == attachmentName) return (int) i;
 	return -1;
 }
 
@@ -109,6 +114,10 @@ Attachment *Skin::getAttachment(size_t slotIndex, const String &name) {
 	return _attachments.get(slotIndex, name);
 }
 
+Attachment *Skin::getAttachment(size_t slotIndex, const String &name, unsigned int hash) {
+	return _attachments.get(slotIndex, name, hash);
+}
+
 void Skin::removeAttachment(size_t slotIndex, const String &name) {
 	_attachments.remove(slotIndex, name);
 }
@@ -148,7 +157,7 @@ void Skin::attachAll(Skeleton &skeleton, Skin &oldSkin) {
 		Slot *slot = slots[slotIndex];
 
 		if (slot->getAttachment() == entry._attachment) {
-			Attachment *attachment = getAttachment(slotIndex, entry._name);
+			Attachment *attachment = getAttachment(slotIndex, entry._name, entry._hash);
 			if (attachment) slot->setAttachment(attachment);
 		}
 	}
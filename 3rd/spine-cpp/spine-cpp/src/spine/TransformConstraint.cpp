@@ -149,7 +149,7 @@ void TransformConstraint::applyAbsoluteWorld() {
 	float mixRotate = _mixRotate, mixX = _mixX, mixY = _mixY, mixScaleX = _mixScaleX, mixScaleY = _mixScaleY, mixShearY = _mixShearY;
 	bool translate = mixX != 0 || mixY != 0;
 	Bone &target = *_target;
-	float ta = target._a, tb = target._b, tc = target._c, td = target._d;
+	float ta = target._world.a, tb = target._world.b, tc = target._world.c, td = target._world.d;
 	float degRadReflect = ta * td - tb * tc > 0 ? MathUtil::Deg_Rad : -MathUtil::Deg_Rad;
 	float offsetRotation = _data._offsetRotation * degRadReflect, offsetShearY = _data._offsetShearY * degRadReflect;
 
@@ -158,7 +158,7 @@ void TransformConstraint::applyAbsoluteWorld() {
 		Bone &bone = *item;
 
 		if (mixRotate != 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
+			float a = bone._world.a, b = bone._world.b, c = bone._world.c, d = bone._world.d;
 			float r = MathUtil::atan2(tc, ta) - MathUtil::atan2(c, a) + offsetRotation;
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
@@ -167,37 +167,37 @@ void TransformConstraint::applyAbsoluteWorld() {
 
 			r *= mixRotate;
 			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._world.a = cos * a - sin * c;
+			bone._world.b = cos * b - sin * d;
+			bone._world.c = sin * a + cos * c;
+			bone._world.d = sin * b + cos * d;
 		}
 
 		if (translate) {
 			float tx, ty;
 			target.localToWorld(_data._offsetX, _data._offsetY, tx, ty);
-			bone._worldX += (tx - bone._worldX) * mixX;
-			bone._worldY += (ty - bone._worldY) * mixY;
+			bone._world.worldX += (tx - bone._world.worldX) * mixX;
+			bone._world.worldY += (ty - bone._world.worldY) * mixY;
 		}
 
 		if (mixScaleX > 0) {
-			float s = MathUtil::sqrt(bone._a * bone._a + bone._c * bone._c);
+			float s = MathUtil::sqrt(bone._world.a * bone._world.a + bone._world.c * bone._world.c);
 			if (s != 0) s = (s + (MathUtil::sqrt(ta * ta + tc * tc) - s + _data._offsetScaleX) * mixScaleX) / s;
-			bone._a *= s;
-			bone._c *= s;
+			bone._world.a *= s;
+			bone._world.c *= s;
 		}
 
 		if (mixScaleY > 0) {
-			float s = MathUtil::sqrt(bone._b * bone._b + bone._d * bone._d);
+			float s = MathUtil::sqrt(bone._world.b * bone._world.b + bone._world.d * bone._world.d);
 			if (s != 0) s = (s + (MathUtil::sqrt(tb * tb + td * td) - s + _data._offsetScaleY) * mixScaleY) / s;
-			bone._b *= s;
-			bone._d *= s;
+			bone._world.b *= s;
+			bone._world.d *= s;
 		}
 
 		if (mixShearY > 0) {
-			float b = bone._b, d = bone._d;
+			float b = bone._world.b, d = bone._world.d;
 			float by = MathUtil::atan2(d, b);
-			float r = MathUtil::atan2(td, tb) - MathUtil::atan2(tc, ta) - (by - MathUtil::atan2(bone._c, bone._a));
+			float r = MathUtil::atan2(td, tb) - MathUtil::atan2(tc, ta) - (by - MathUtil::atan2(bone._world.c, bone._world.a));
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
 			else if (r < -MathUtil::Pi)
@@ -205,8 +205,8 @@ void TransformConstraint::applyAbsoluteWorld() {
 
 			r = by + (r + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			bone._world.b = MathUtil::cos(r) * s;
+			bone._world.d = MathUtil::sin(r) * s;
 		}
 
 		bone.updateAppliedTransform();
@@ -217,7 +217,7 @@ void TransformConstraint::applyRelativeWorld() {
 	float mixRotate = _mixRotate, mixX = _mixX, mixY = _mixY, mixScaleX = _mixScaleX, mixScaleY = _mixScaleY, mixShearY = _mixShearY;
 	bool translate = mixX != 0 || mixY != 0;
 	Bone &target = *_target;
-	float ta = target._a, tb = target._b, tc = target._c, td = target._d;
+	float ta = target._world.a, tb = target._world.b, tc = target._world.c, td = target._world.d;
 	float degRadReflect = ta * td - tb * tc > 0 ? MathUtil::Deg_Rad : -MathUtil::Deg_Rad;
 	float offsetRotation = _data._offsetRotation * degRadReflect, offsetShearY = _data._offsetShearY * degRadReflect;
 	for (size_t i = 0; i < _bones.size(); ++i) {
@@ -225,7 +225,7 @@ void TransformConstraint::applyRelativeWorld() {
 		Bone &bone = *item;
 
 		if (mixRotate != 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
+			float a = bone._world.a, b = bone._world.b, c = bone._world.c, d = bone._world.d;
 			float r = MathUtil::atan2(tc, ta) + offsetRotation;
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
@@ -234,28 +234,28 @@ void TransformConstraint::applyRelativeWorld() {
 
 			r *= mixRotate;
 			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._world.a = cos * a - sin * c;
+			bone._world.b = cos * b - sin * d;
+			bone._world.c = sin * a + cos * c;
+			bone._world.d = sin * b + cos * d;
 		}
 
 		if (translate) {
 			float tx, ty;
 			target.localToWorld(_data._offsetX, _data._offsetY, tx, ty);
-			bone._worldX += tx * mixX;
-			bone._worldY += ty * mixY;
+			bone._world.worldX += tx * mixX;
+			bone._world.worldY += ty * mixY;
 		}
 
 		if (mixScaleX != 0) {
 			float s = (MathUtil::sqrt(ta * ta + tc * tc) - 1 + _data._offsetScaleX) * mixScaleX + 1;
-			bone._a *= s;
-			bone._c *= s;
+			bone._world.a *= s;
+			bone._world.c *= s;
 		}
 		if (mixScaleY != 0) {
 			float s = (MathUtil::sqrt(tb * tb + td * td) - 1 + _data._offsetScaleY) * mixScaleY + 1;
-			bone._b *= s;
-			bone._d *= s;
+			bone._world.b *= s;
+			bone._world.d *= s;
 		}
 
 		if (mixShearY > 0) {
@@ -265,11 +265,11 @@ void TransformConstraint::applyRelativeWorld() {
 			else if (r < -MathUtil::Pi)
 				r += MathUtil::Pi_2;
 
-			float b = bone._b, d = bone._d;
+			float b = bone._world.b, d = bone._world.d;
 			r = MathUtil::atan2(d, b) + (r - MathUtil::Pi / 2 + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			bone._world.b = MathUtil::cos(r) * s;
+			bone._world.d = MathUtil::sin(r) * s;
 		}
 
 		bone.updateAppliedTransform();
@@ -284,31 +284,31 @@ void TransformConstraint::applyAbsoluteLocal() {
 		Bone *item = _bones[i];
 		Bone &bone = *item;
 
-		float rotation = bone._arotation;
+		float rotation = bone._applied.rotation;
 		if (mixRotate != 0) {
-			float r = target._arotation - rotation + _data._offsetRotation;
+			float r = target._applied.rotation - rotation + _data._offsetRotation;
 			r -= MathUtil::ceil(r / 360 - 0.5) * 360;
 			rotation += r * mixRotate;
 		}
 
-		float x = bone._ax, y = bone._ay;
-		x += (target._ax - x + _data._offsetX) * mixX;
-		y += (target._ay - y + _data._offsetY) * mixY;
+		float x = bone._applied.x, y = bone._applied.y;
+		x += (target._applied.x - x + _data._offsetX) * mixX;
+		y += (target._applied.y - y + _data._offsetY) * mixY;
 
-		float scaleX = bone._ascaleX, scaleY = bone._ascaleY;
+		float scaleX = bone._applied.scaleX, scaleY = bone._applied.scaleY;
 		if (mixScaleX != 0 && scaleX != 0)
-			scaleX = (scaleX + (target._ascaleX - scaleX + _data._offsetScaleX) * mixScaleX) / scaleX;
+			scaleX = (scaleX + (target._applied.scaleX - scaleX + _data._offsetScaleX) * mixScaleX) / scaleX;
 		if (mixScaleY != 0 && scaleY != 0)
-			scaleY = (scaleY + (target._ascaleY - scaleY + _data._offsetScaleY) * mixScaleY) / scaleY;
+			scaleY = (scaleY + (target._applied.scaleY - scaleY + _data._offsetScaleY) * mixScaleY) / scaleY;
 
-		float shearY = bone._ashearY;
+		float shearY = bone._applied.shearY;
 		if (mixShearY != 0) {
-			float r = target._ashearY - shearY + _data._offsetShearY;
+			float r = target._applied.shearY - shearY + _data._offsetShearY;
 			r -= MathUtil::ceil(r / 360 - 0.5) * 360;
-			bone._shearY += r * mixShearY;
+			bone._local.shearY += r * mixShearY;
 		}
 
-		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX, shearY);
+		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._applied.shearX, shearY);
 	}
 }
 
@@ -320,14 +320,14 @@ void TransformConstraint::applyRelativeLocal() {
 		Bone *item = _bones[i];
 		Bone &bone = *item;
 
-		float rotation = bone._arotation + (target._arotation + _data._offsetRotation) * mixRotate;
-		float x = bone._ax + (target._ax + _data._offsetX) * mixX;
-		float y = bone._ay + (target._ay + _data._offsetY) * mixY;
-		float scaleX = bone._ascaleX * (((target._ascaleX - 1 + _data._offsetScaleX) * mixScaleX) + 1);
-		float scaleY = bone._ascaleY * (((target._ascaleY - 1 + _data._offsetScaleY) * mixScaleY) + 1);
-		float shearY = bone._ashearY + (target._ashearY + _data._offsetShearY) * mixShearY;
+		float rotation = bone._applied.rotation + (target._applied.rotation + _data._offsetRotation) * mixRotate;
+		float x = bone._applied.x + (target._applied.x + _data._offsetX) * mixX;
+		float y = bone._applied.y + (target._applied.y + _data._offsetY) * mixY;
+		float scaleX = bone._applied.scaleX * (((target._applied.scaleX - 1 + _data._offsetScaleX) * mixScaleX) + 1);
+		float scaleY = bone._applied.scaleY * (((target._applied.scaleY - 1 + _data._offsetScaleY) * mixScaleY) + 1);
+		float shearY = bone._applied.shearY + (target._applied.shearY + _data._offsetShearY) * mixShearY;
 
-		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX, shearY);
+		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._applied.shearX, shearY);
 	}
 }
 
@@ -88,7 +88,7 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 	}
 
 	float rotate, x, y, scaleX, scaleY, shearY;
-	int i = Animation::search(_frames, time, TransformConstraintTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, TransformConstraintTimeline::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / TransformConstraintTimeline::ENTRIES];
 	switch (curveType) {
 		case TransformConstraintTimeline::LINEAR: {
@@ -119,11 +119,11 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 		}
 		default: {
 			rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
-			x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
-			y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
-			scaleX = getBezierValue(time, i, SCALEX, curveType + BEZIER_SIZE * 3 - BEZIER);
-			scaleY = getBezierValue(time, i, SCALEY, curveType + BEZIER_SIZE * 4 - BEZIER);
-			shearY = getBezierValue(time, i, SHEARY, curveType + BEZIER_SIZE * 5 - BEZIER);
+			x = getBezierValue(time, i, X, curveType + _bezierSize - BEZIER);
+			y = getBezierValue(time, i, Y, curveType + _bezierSize * 2 - BEZIER);
+			scaleX = getBezierValue(time, i, SCALEX, curveType + _bezierSize * 3 - BEZIER);
+			scaleY = getBezierValue(time, i, SCALEY, curveType + _bezierSize * 4 - BEZIER);
+			shearY = getBezierValue(time, i, SHEARY, curveType + _bezierSize * 5 - BEZIER);
 		}
 	}
 
@@ -64,12 +64,12 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_x = bone->_data._x;
-				bone->_y = bone->_data._y;
+				bone->_local.x = bone->_data._x;
+				bone->_local.y = bone->_data._y;
 				return;
 			case MixBlend_First:
-				bone->_x += (bone->_data._x - bone->_x) * alpha;
-				bone->_y += (bone->_data._y - bone->_y) * alpha;
+				bone->_local.x += (bone->_data._x - bone->_local.x) * alpha;
+				bone->_local.y += (bone->_data._y - bone->_local.y) * alpha;
 			default: {
 			}
 		}
@@ -77,7 +77,7 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	}
 
 	float x = 0, y = 0;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES, skeleton.getTimelineCursor());
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -97,23 +97,23 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 		default: {
 			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
 			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+							   curveType + _bezierSize - CurveTimeline::BEZIER);
 		}
 	}
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_x = bone->_data._x + x * alpha;
-			bone->_y = bone->_data._y + y * alpha;
+			bone->_local.x = bone->_data._x + x * alpha;
+			bone->_local.y = bone->_data._y + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
-			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			bone->_local.x += (bone->_data._x + x - bone->_local.x) * alpha;
+			bone->_local.y += (bone->_data._y + y - bone->_local.y) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_x += x * alpha;
-			bone->_y += y * alpha;
+			bone->_local.x += x * alpha;
+			bone->_local.y += y * alpha;
 	}
 }
 
@@ -136,7 +136,7 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_x = getRelativeValue(time, alpha, blend, bone->_x, bone->_data._x);
+	if (bone->_active) bone->_local.x = getRelativeValue(time, alpha, blend, bone->_local.x, bone->_data._x, skeleton.getTimelineCursor());
 }
 
 RTTI_IMPL(TranslateYTimeline, CurveTimeline1)
@@ -158,5 +158,5 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_y = getRelativeValue(time, alpha, blend, bone->_y, bone->_data._y);
+	if (bone->_active) bone->_local.y = getRelativeValue(time, alpha, blend, bone->_local.y, bone->_data._y, skeleton.getTimelineCursor());
 }
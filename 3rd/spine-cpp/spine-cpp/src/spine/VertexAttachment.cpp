@@ -60,7 +60,6 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 
 void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset,
 											size_t stride) {
-	count = offset + (count >> 1) * stride;
 	Skeleton &skeleton = slot._bone._skeleton;
 	Vector<float> *deformArray = &slot.getDeform();
 	Vector<float> *vertices = &_vertices;
@@ -69,18 +68,19 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		if (deformArray->size() > 0) vertices = deformArray;
 
 		Bone &bone = slot._bone;
-		float x = bone._worldX;
-		float y = bone._worldY;
-		float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
-		for (size_t vv = start, w = offset; w < count; vv += 2, w += stride) {
-			float vx = (*vertices)[vv];
-			float vy = (*vertices)[vv + 1];
-			worldVertices[w] = vx * a + vy * b + x;
-			worldVertices[w + 1] = vx * c + vy * d + y;
-		}
+		VertexTransform::transform(vertices->buffer() + start, count >> 1, bone._world.a, bone._world.b, bone._world.c, bone._world.d,
+								   bone._world.worldX, bone._world.worldY, worldVertices + offset, stride);
+		return;
+	}
+
+	Vector<Bone *> &skeletonBones = skeleton.getBones();
+	if (start == 0 && count == _worldVerticesLength && _weightLayout.isValid(vertices->size())) {
+		computeWeightedWorldVertices(skeletonBones, deformArray->size() > 0 ? deformArray->buffer() : NULL,
+									 count >> 1, worldVertices + offset, stride);
 		return;
 	}
 
+	count = offset + (count >> 1) * stride;
 	int v = 0, skip = 0;
 	for (size_t i = 0; i < start; i += 2) {
 		int n = (int) bones[v];
@@ -88,7 +88,6 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		skip += n;
 	}
 
-	Vector<Bone *> &skeletonBones = skeleton.getBones();
 	if (deformArray->size() == 0) {
 		for (size_t w = offset, b = skip * 3; w < count; w += stride) {
 			float wx = 0, wy = 0;
@@ -100,8 +99,8 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 				float vx = (*vertices)[b];
 				float vy = (*vertices)[b + 1];
 				float weight = (*vertices)[b + 2];
-				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
-				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
+				wx += (vx * bone._world.a + vy * bone._world.b + bone._world.worldX) * weight;
+				wy += (vx * bone._world.c + vy * bone._world.d + bone._world.worldY) * weight;
 			}
 			worldVertices[w] = wx;
 			worldVertices[w + 1] = wy;
@@ -117,8 +116,8 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 				float vx = (*vertices)[b] + (*deformArray)[f];
 				float vy = (*vertices)[b + 1] + (*deformArray)[f + 1];
 				float weight = (*vertices)[b + 2];
-				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
-				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
+				wx += (vx * bone._world.a + vy * bone._world.b + bone._world.worldX) * weight;
+				wy += (vx * bone._world.c + vy * bone._world.d + bone._world.worldY) * weight;
 			}
 			worldVertices[w] = wx;
 			worldVertices[w + 1] = wy;
@@ -126,6 +125,45 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 	}
 }
 
+void VertexAttachment::computeWeightedWorldVertices(Vector<Bone *> &skeletonBones, float *deform, size_t vertexCount,
+													float *worldVertices, size_t stride) {
+	static const size_t CHUNK = 32;
+	float outX[CHUNK], outY[CHUNK], deformX[CHUNK], deformY[CHUNK];
+
+	for (size_t i = 0, w = 0; i < vertexCount; i++, w += stride) {
+		worldVertices[w] = 0;
+		worldVertices[w + 1] = 0;
+	}
+
+	BoneGroupedWeights &layout = _weightLayout;
+	int *vertexIndices = layout._vertexIndices.buffer();
+	int *deformIndices = layout._deformIndices.buffer();
+	float *x = layout._x.buffer(), *y = layout._y.buffer(), *weights = layout._weights.buffer();
+	for (size_t group = 0, groups = layout._bones.size(); group < groups; group++) {
+		Bone &bone = *skeletonBones[layout._bones[group]];
+		for (size_t i = layout._offsets[group], end = layout._offsets[group + 1]; i < end; i += CHUNK) {
+			size_t n = end - i < CHUNK ? end - i : CHUNK;
+			const float *vx = x + i, *vy = y + i;
+			if (deform) {
+				for (size_t ii = 0; ii < n; ii++) {
+					int f = deformIndices[i + ii] << 1;
+					deformX[ii] = vx[ii] + deform[f];
+					deformY[ii] = vy[ii] + deform[f + 1];
+				}
+				vx = deformX;
+				vy = deformY;
+			}
+			VertexTransform::transformWeighted(vx, vy, weights + i, n, bone._world.a, bone._world.b, bone._world.c, bone._world.d,
+											   bone._world.worldX, bone._world.worldY, outX, outY);
+			for (size_t ii = 0; ii < n; ii++) {
+				size_t w = vertexIndices[i + ii] * stride;
+				worldVertices[w] += outX[ii];
+				worldVertices[w + 1] += outY[ii];
+			}
+		}
+	}
+}
+
 int VertexAttachment::getId() {
 	return _id;
 }
@@ -164,4 +202,13 @@ void VertexAttachment::copyTo(VertexAttachment *other) {
 	other->_vertices.clearAndAddAll(this->_vertices);
 	other->_worldVerticesLength = this->_worldVerticesLength;
 	other->_timelineAttachment = this->_timelineAttachment;
+	other->updateWeightLayout();
+}
+
+void VertexAttachment::updateWeightLayout() {
+	_weightLayout.build(_bones, _vertices);
+}
+
+BoneGroupedWeights &VertexAttachment::getWeightLayout() {
+	return _weightLayout;
 }
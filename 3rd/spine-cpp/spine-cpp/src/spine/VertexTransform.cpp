@@ -0,0 +1,205 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/VertexTransform.h>
+
+#if defined(SPINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(SPINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+using namespace spine;
+
+#if defined(SPINE_SIMD_SSE2) || defined(SPINE_SIMD_NEON)
+static bool _simdEnabled = true;
+#else
+static bool _simdEnabled = false;
+#endif
+
+BoneGroupedWeights::BoneGroupedWeights() {
+}
+
+BoneGroupedWeights::~BoneGroupedWeights() {
+}
+
+void BoneGroupedWeights::clear() {
+	_bones.clear();
+	_offsets.clear();
+	_vertexIndices.clear();
+	_deformIndices.clear();
+	_x.clear();
+	_y.clear();
+	_weights.clear();
+}
+
+void BoneGroupedWeights::build(Vector<int> &bones, Vector<float> &vertices) {
+	clear();
+	if (bones.size() == 0) return;
+
+	// Count the influences of each bone.
+	size_t influences = vertices.size() / 3;
+	int maxBone = -1;
+	for (size_t i = 0, n = bones.size(); i < n;) {
+		int boneCount = bones[i++];
+		for (int ii = 0; ii < boneCount; ii++, i++)
+			if (bones[i] > maxBone) maxBone = bones[i];
+	}
+	Vector<int> counts;
+	counts.setSize(maxBone + 1, 0);
+	for (size_t i = 0, n = bones.size(); i < n;) {
+		int boneCount = bones[i++];
+		for (int ii = 0; ii < boneCount; ii++, i++)
+			counts[bones[i]]++;
+	}
+
+	// One group per influencing bone, in bone order.
+	Vector<int> starts;
+	starts.setSize(maxBone + 1, 0);
+	for (int bone = 0, offset = 0; bone <= maxBone; bone++) {
+		if (counts[bone] == 0) continue;
+		starts[bone] = offset;
+		_bones.add(bone);
+		_offsets.add(offset);
+		offset += counts[bone];
+	}
+	_offsets.add((int) influences);
+
+	_vertexIndices.setSize(influences, 0);
+	_deformIndices.setSize(influences, 0);
+	_x.setSize(influences, 0);
+	_y.setSize(influences, 0);
+	_weights.setSize(influences, 0);
+	int influence = 0, vertex = 0;
+	for (size_t i = 0, n = bones.size(); i < n; vertex++) {
+		int boneCount = bones[i++];
+		for (int ii = 0; ii < boneCount; ii++, i++, influence++) {
+			int index = starts[bones[i]]++;
+			_vertexIndices[index] = vertex;
+			_deformIndices[index] = influence;
+			_x[index] = vertices[influence * 3];
+			_y[index] = vertices[influence * 3 + 1];
+			_weights[index] = vertices[influence * 3 + 2];
+		}
+	}
+}
+
+void VertexTransform::transform(const float *points, size_t count, float a, float b, float c, float d, float x,
+								float y, float *worldVertices, size_t stride) {
+	size_t i = 0;
+	if (_simdEnabled && stride == 2) {
+#if defined(SPINE_SIMD_SSE2)
+		__m128 ac = _mm_setr_ps(a, c, a, c);
+		__m128 bd = _mm_setr_ps(b, d, b, d);
+		__m128 xy = _mm_setr_ps(x, y, x, y);
+		for (; i + 2 <= count; i += 2) {
+			__m128 v = _mm_loadu_ps(points + (i << 1));
+			__m128 vx = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 vy = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+			__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, ac), _mm_mul_ps(vy, bd)), xy);
+			_mm_storeu_ps(worldVertices + (i << 1), r);
+		}
+#elif defined(SPINE_SIMD_NEON)
+		float32x4_t va = vdupq_n_f32(a), vb = vdupq_n_f32(b), vc = vdupq_n_f32(c), vd = vdupq_n_f32(d);
+		float32x4_t vx = vdupq_n_f32(x), vy = vdupq_n_f32(y);
+		for (; i + 4 <= count; i += 4) {
+			float32x4x2_t v = vld2q_f32(points + (i << 1));
+			float32x4x2_t r;
+			r.val[0] = vaddq_f32(vaddq_f32(vmulq_f32(v.val[0], va), vmulq_f32(v.val[1], vb)), vx);
+			r.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(v.val[0], vc), vmulq_f32(v.val[1], vd)), vy);
+			vst2q_f32(worldVertices + (i << 1), r);
+		}
+#endif
+	}
+	for (size_t w = i * stride; i < count; i++, w += stride) {
+		float vx = points[i << 1];
+		float vy = points[(i << 1) + 1];
+		worldVertices[w] = vx * a + vy * b + x;
+		worldVertices[w + 1] = vx * c + vy * d + y;
+	}
+}
+
+void VertexTransform::transformWeighted(const float *vx, const float *vy, const float *weights, size_t count, float a,
+										float b, float c, float d, float x, float y, float *outX, float *outY) {
+	size_t i = 0;
+	if (_simdEnabled) {
+#if defined(SPINE_SIMD_SSE2)
+		__m128 ma = _mm_set1_ps(a), mb = _mm_set1_ps(b), mc = _mm_set1_ps(c), md = _mm_set1_ps(d);
+		__m128 mx = _mm_set1_ps(x), my = _mm_set1_ps(y);
+		for (; i + 4 <= count; i += 4) {
+			__m128 px = _mm_loadu_ps(vx + i);
+			__m128 py = _mm_loadu_ps(vy + i);
+			__m128 w = _mm_loadu_ps(weights + i);
+			__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, ma), _mm_mul_ps(py, mb)), mx);
+			__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, mc), _mm_mul_ps(py, md)), my);
+			_mm_storeu_ps(outX + i, _mm_mul_ps(rx, w));
+			_mm_storeu_ps(outY + i, _mm_mul_ps(ry, w));
+		}
+#elif defined(SPINE_SIMD_NEON)
+		float32x4_t ma = vdupq_n_f32(a), mb = vdupq_n_f32(b), mc = vdupq_n_f32(c), md = vdupq_n_f32(d);
+		float32x4_t mx = vdupq_n_f32(x), my = vdupq_n_f32(y);
+		for (; i + 4 <= count; i += 4) {
+			float32x4_t px = vld1q_f32(vx + i);
+			float32x4_t py = vld1q_f32(vy + i);
+			float32x4_t w = vld1q_f32(weights + i);
+			float32x4_t rx = vaddq_f32(vaddq_f32(vmulq_f32(px, ma), vmulq_f32(py, mb)), mx);
+			float32x4_t ry = vaddq_f32(vaddq_f32(vmulq_f32(px, mc), vmulq_f32(py, md)), my);
+			vst1q_f32(outX + i, vmulq_f32(rx, w));
+			vst1q_f32(outY + i, vmulq_f32(ry, w));
+		}
+#endif
+	}
+	for (; i < count; i++) {
+		float px = vx[i], py = vy[i], w = weights[i];
+		outX[i] = (px * a + py * b + x) * w;
+		outY[i] = (px * c + py * d + y) * w;
+	}
+}
+
+void VertexTransform::setSimdEnabled(bool enabled) {
+#if defined(SPINE_SIMD_SSE2) || defined(SPINE_SIMD_NEON)
+	_simdEnabled = enabled;
+#else
+	SP_UNUSED(enabled);
+#endif
+}
+
+bool VertexTransform::isSimdEnabled() {
+	return _simdEnabled;
+}
+
+const char *VertexTransform::getSimdName() {
+#if defined(SPINE_SIMD_SSE2)
+	return "sse2";
+#elif defined(SPINE_SIMD_NEON)
+	return "neon";
+#else
+	return "scalar";
+#endif
+}
@@ -0,0 +1,82 @@
+#!/usr/bin/python
+
+# 生成 data 资源后，用 spine2d_compile 把 spine 的骨骼、图集和纹理转换成运行时直接加载的格式。
+# 转换结果覆盖 res/assets/<theme>/raw/data 中的同名文件，JSON 骨骼另外生成同名的 .skel 文件。
+#
+# 可以通过环境变量调整：
+#   SPINE2D_ANIMATIONS 只保留指定的动画(逗号分隔)，默认保留全部。
+#   SPINE2D_TEXTURE    raw 表示把纹理解码成像素保存(文件较大，加载时不用解码)，默认 copy 表示原样保存。
+
+import os
+import sys
+import subprocess
+
+APP_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def get_compiler():
+    name = 'spine2d_compile.exe' if sys.platform == 'win32' else 'spine2d_compile'
+    return os.path.join(APP_ROOT, 'bin', name)
+
+
+def find_skeletons(data_dir):
+    skeletons = []
+    names = os.listdir(data_dir)
+    for name in names:
+        base, ext = os.path.splitext(name)
+        if ext == '.json' or (ext == '.skel' and base + '.json' not in names):
+            skeletons.append(name)
+
+    return skeletons
+
+
+def find_atlas(data_dir, skeleton):
+    # 优先使用和骨骼同名的图集，如 spineboy-pro.json 对应 spineboy-pro.atlas 或 spineboy.atlas
+    base = os.path.splitext(skeleton)[0]
+    atlases = [name for name in os.listdir(data_dir) if name.endswith('.atlas')]
+    for name in atlases:
+        if os.path.splitext(name)[0] == base:
+            return name
+
+    prefix = base.split('-')[0]
+    for name in atlases:
+        if name.startswith(prefix):
+            return name
+
+    return atlases[0] if len(atlases) == 1 else None
+
+
+def compile_spine_data(ctx):
+    compiler = get_compiler()
+    input_dir = os.path.join(ctx['input'], 'data')
+    output_dir = os.path.join(ctx['output'], 'raw/data')
+    if not os.path.exists(input_dir) or not os.path.exists(output_dir):
+        return
+
+    if not os.path.exists(compiler):
+        print('spine2d_compile not found, skip compiling spine data: ' + compiler)
+        return
+
+    options = ['--texture=' + os.environ.get('SPINE2D_TEXTURE', 'copy')]
+    if os.environ.get('SPINE2D_ANIMATIONS'):
+        options.append('--animations=' + os.environ['SPINE2D_ANIMATIONS'])
+
+    for skeleton in find_skeletons(input_dir):
+        atlas = find_atlas(input_dir, skeleton)
+        if atlas is None:
+            print('no atlas for ' + skeleton + ', skip it')
+            continue
+
+        cmd = [compiler] + options + [os.path.join(input_dir, skeleton),
+                                      os.path.join(input_dir, atlas), output_dir]
+        if subprocess.call(cmd) != 0:
+            print('compile ' + skeleton + ' failed')
+
+
+def on_generate_res_before(ctx):
+    pass
+
+
+def on_generate_res_after(ctx):
+    if ctx['type'] == 'data':
+        compile_spine_data(ctx)
@@ -23,81 +23,465 @@
 #include "tkc/utils.h"
 #include "tkc/tokenizer.h"
 #include "tkc/time_now.h"
+#include "tkc/darray.h"
+#include "tkc/mutex.h"
 
 #include "spine2d.h"
 #include "spine_gl.h"
+#include "spine_task_pool.h"
+#include "spine_clock.h"
+#include "spine_mem.h"
 
 using namespace spine;
 
+class MyAnimationStateListenerObject;
+
 typedef struct _skeleton_info_t {
   Atlas* atlas;
   SkeletonData* skeletonData;
   Skeleton* skeleton;
   AnimationStateData* animationStateData;
   AnimationState* animationState;
+  MyAnimationStateListenerObject* listener;
   renderer_t* renderer;
-  double last_time;
+  darray_t* actions;
+  spine_clock_t clock;
+  /*插值绘制：上一步的骨骼世界变换、最近一步的备份和插值比例*/
+  bool_t posed;
+  BoneWorld* prev_worlds;
+  BoneWorld* last_worlds;
+  float alpha;
+  /*最近几次更新的平均耗时(微秒)，用于 CPU 预算*/
+  float update_cost_us;
+  /*动作缓存有淘汰，待事件派发完后再释放不用的动画*/
+  bool_t unload_pending;
 } skeleton_info_t;
 
-static ret_t spine2d_disptach_event(widget_t* widget, uint32_t type, TrackEntry* entry) {
+/*动作字符串解析结果的缓存个数*/
+#define SPINE2D_ACTION_CACHE_SIZE 8
+
+/*动作字符串及其解析出的动画，脚本反复设置动作时无需再分割字符串和查找动画*/
+typedef struct _spine2d_action_t {
+  char* action;
+  darray_t animations;
+} spine2d_action_t;
+
+/*
+ * 轨道设置。创建骨骼前的设置也保存在这里，创建骨骼后再应用。
+ * 轨道 0 的动画名和循环标志保存在 action 和 loop 属性中。
+ */
+typedef struct _spine2d_track_t {
+  char* action;
+  bool_t loop;
+  float alpha;
+  float mix;
+  spine2d_blend_t blend;
+} spine2d_track_t;
+
+static const spine2d_track_t s_spine2d_default_track = {NULL, TRUE, 1, -1, SPINE2D_BLEND_REPLACE};
+
+/*已创建骨骼的 spine2d 控件*/
+static darray_t* s_spine2d_widgets = NULL;
+/*并行更新时使用的线程池，为 NULL 表示每个控件在自己的定时器中串行更新*/
+static spine_task_pool_t* s_spine2d_pool = NULL;
+static darray_t* s_spine2d_tasks = NULL;
+static uint32_t s_spine2d_timer_id = TK_INVALID_ID;
+
+/*更新定时器的间隔(毫秒)，update_fps 为 0 时每次定时器触发都更新*/
+#define SPINE2D_TIMER_INTERVAL 16
+/*检查 CPU 预算的间隔(微秒)*/
+#define SPINE2D_BUDGET_CHECK_INTERVAL 500000
+
+/*CPU 预算(占一个核的百分比)，0 表示不限制*/
+static uint32_t s_spine2d_cpu_budget = 0;
+static uint64_t s_spine2d_budget_check_us = 0;
+
+/*动画名指向骨骼数据中的字符串，直接借用，不复制也不释放*/
+static ret_t spine2d_disptach_event(widget_t* widget, uint32_t type, const char* name) {
   widget_animator_event_t e;
   widget_animator_t animator;
-  const char* name = entry->getAnimation()->getName().buffer();
 
   memset(&animator, 0x00, sizeof(animator));
   animator.widget = widget;
-  widget_animator_set_name(&animator, name);
+  animator.name = (char*)name;
   widget_animator_event_init(&e, type, widget, &animator);
   widget_dispatch(widget, (event_t*)&e);
-  TKMEM_FREE(animator.name);
 
   return RET_OK;
 }
 
+/*
+ * 骨骼更新可能在工作线程中进行，回调中只记录事件，
+ * 更新完成后由 UI 线程调用 flush 分发。
+ *
+ * 事件记录在两个轮换使用的缓冲区中，事件处理函数中切换动画产生的新事件写入另一个缓冲区，
+ * 不会破坏正在分发的事件，缓冲区的内存在多次更新间复用。
+ */
 class MyAnimationStateListenerObject : public AnimationStateListenerObject {
  public:
   MyAnimationStateListenerObject(widget_t* widget) {
     this->widget = widget;
+    this->current = 0;
   }
   void callback(AnimationState* state, EventType type, TrackEntry* entry, Event* event) {
+    spine2d_event_item_t item;
+
+    memset(&item, 0x00, sizeof(item));
+    item.type = (uint32_t)type;
+    item.track = (int32_t)entry->getTrackIndex();
+    item.animation = entry->getAnimation()->getName().buffer();
+    if (type == EventType_Event && event != NULL) {
+      const EventData& data = event->getData();
+      item.name = data.getName().buffer();
+      item.int_value = event->getIntValue();
+      item.float_value = event->getFloatValue();
+      item.string_value = event->getStringValue().buffer();
+      item.audio_path = data.getAudioPath().isEmpty() ? NULL : data.getAudioPath().buffer();
+      item.volume = event->getVolume();
+      item.balance = event->getBalance();
+      item.time = event->getTime();
+    }
+    pending[current].add(item);
+  }
+
+  void flush() {
+    spine2d_event_t batch;
     spine2d_t* spine2d = SPINE2D(widget);
+    Vector<spine2d_event_item_t>& items = pending[current];
+
+    if (items.size() == 0) {
+      return;
+    }
 
-    if (type == EventType_Complete) {
-      if (spine2d->loop) {
-        spine2d_disptach_event(widget, EVT_ANIM_ONCE, entry);
-      } else {
-        spine2d_disptach_event(widget, EVT_ANIM_END, entry);
+    current = 1 - current;
+    spine2d_event_init(&batch, widget, items.buffer(), (uint32_t)items.size());
+    widget_dispatch(widget, (event_t*)&batch);
+
+    /*EVT_ANIM_* 只针对轨道 0(action 属性)，其它轨道的事件通过 EVT_SPINE2D_EVENTS 获取*/
+    for (size_t i = 0; i < items.size(); i++) {
+      spine2d_event_item_t& e = items[i];
+      if (e.track != 0) {
+        continue;
+      } else if (e.type == SPINE2D_EVENT_COMPLETE) {
+        if (spine2d->loop) {
+          spine2d_disptach_event(widget, EVT_ANIM_ONCE, e.animation);
+        } else {
+          spine2d_disptach_event(widget, EVT_ANIM_END, e.animation);
+        }
+      } else if (e.type == SPINE2D_EVENT_START) {
+        spine2d_disptach_event(widget, EVT_ANIM_START, e.animation);
       }
-    } else if (type == EventType_Start) {
-      spine2d_disptach_event(widget, EVT_ANIM_START, entry);
-    } else {
-      log_debug("type=%d\n", type);
     }
+    items.clear();
   }
 
   widget_t* widget;
+  uint32_t current;
+  Vector<spine2d_event_item_t> pending[2];
 };
 
-static ret_t animation_state_set_names(AnimationState* animationState, const char* names,
-                                       bool_t loop) {
-  tokenizer_t t;
-  return_value_if_fail(animationState != NULL && names != NULL, RET_BAD_PARAMS);
+/*
+ * 骨骼数据直接引用 .skel 资源中的名字和字符串，资源随骨骼数据一起释放。
+ */
+class AssetSkeletonDataBuffer : public SkeletonDataBuffer {
+ public:
+  AssetSkeletonDataBuffer(asset_info_t* asset) : asset(asset) {
+  }
+  virtual ~AssetSkeletonDataBuffer() {
+    asset_info_unref(asset);
+  }
 
-  if (strchr(names, ',') != NULL) {
-    uint32_t i = 0;
-    tokenizer_init(&t, names, tk_strlen(names), ",");
-    while (tokenizer_has_more(&t)) {
-      const char* name = tokenizer_next(&t);
-      if (i == 0) {
-        animationState->setAnimation(0, name, loop);
-      } else {
-        animationState->addAnimation(0, name, loop, 0);
+ private:
+  asset_info_t* asset;
+};
+
+/*
+ * 从共享的 .skel 资源复制出来的私有数据，随骨骼数据一起释放。
+ */
+class CopiedSkeletonDataBuffer : public SkeletonDataBuffer {
+ public:
+  CopiedSkeletonDataBuffer(uint8_t* data) : data(data) {
+  }
+  virtual ~CopiedSkeletonDataBuffer() {
+    TKMEM_FREE(data);
+  }
+
+ private:
+  uint8_t* data;
+};
+
+/*
+ * 原地读取会把字符串就地改写成以 0 结尾，只能用于独占的资源。
+ * 资源管理器缓存中的资源(引用计数大于 1)会被下一个加载同一文件的控件读到，复制一份私有的数据再原地读取；
+ * ROM 中的资源只读，名字和字符串需要复制出来。资源总是由这里接管。
+ */
+static SkeletonData* spine2d_read_skeleton_data(SkeletonBinary& binary, asset_info_t* asset) {
+  SkeletonData* skeletonData = NULL;
+
+  if (asset_info_is_in_rom(asset)) {
+    skeletonData = binary.readSkeletonData(asset->data, asset->size);
+    asset_info_unref(asset);
+  } else if (asset->refcount == 1) {
+    skeletonData =
+        binary.readSkeletonData(asset->data, asset->size, new AssetSkeletonDataBuffer(asset));
+  } else {
+    uint8_t* data = (uint8_t*)TKMEM_ALLOC(asset->size);
+    if (data != NULL) {
+      memcpy(data, asset->data, asset->size);
+      skeletonData =
+          binary.readSkeletonData(data, asset->size, new CopiedSkeletonDataBuffer(data));
+    }
+    asset_info_unref(asset);
+  }
+
+  return skeletonData;
+}
+
+/*
+ * 并行更新时各线程会同时分配内存，用锁保护原来的 SpineExtension。
+ */
+class LockedSpineExtension : public SpineExtension {
+ public:
+  LockedSpineExtension(SpineExtension* inner) : inner(inner) {
+    mutex = tk_mutex_create();
+  }
+  virtual ~LockedSpineExtension() {
+    tk_mutex_destroy(mutex);
+  }
+
+  virtual void* _alloc(size_t size, const char* file, int line) override {
+    tk_mutex_lock(mutex);
+    void* ptr = inner->_alloc(size, file, line);
+    tk_mutex_unlock(mutex);
+    return ptr;
+  }
+
+  virtual void* _calloc(size_t size, const char* file, int line) override {
+    tk_mutex_lock(mutex);
+    void* ptr = inner->_calloc(size, file, line);
+    tk_mutex_unlock(mutex);
+    return ptr;
+  }
+
+  virtual void* _realloc(void* ptr, size_t size, const char* file, int line) override {
+    tk_mutex_lock(mutex);
+    void* mem = inner->_realloc(ptr, size, file, line);
+    tk_mutex_unlock(mutex);
+    return mem;
+  }
+
+  virtual void _free(void* mem, const char* file, int line) override {
+    tk_mutex_lock(mutex);
+    inner->_free(mem, file, line);
+    tk_mutex_unlock(mutex);
+  }
+
+  virtual char* _readFile(const String& path, int* length) override {
+    return inner->_readFile(path, length);
+  }
+
+  virtual void _beforeFree(void* ptr) override {
+    tk_mutex_lock(mutex);
+    inner->_beforeFree(ptr);
+    tk_mutex_unlock(mutex);
+  }
+
+  SpineExtension* inner;
+  tk_mutex_t* mutex;
+};
+
+static LockedSpineExtension* s_spine2d_extension = NULL;
+
+static ret_t spine2d_action_destroy(void* data) {
+  spine2d_action_t* action = (spine2d_action_t*)data;
+
+  darray_deinit(&(action->animations));
+  TKMEM_FREE(action->action);
+  TKMEM_FREE(action);
+
+  return RET_OK;
+}
+
+static bool_t skeleton_info_is_animation_used(skeleton_info_t* info, Animation* animation) {
+  uint32_t i = 0;
+  uint32_t j = 0;
+  Vector<TrackEntry*>& tracks = info->animationState->getTracks();
+
+  for (i = 0; i < info->actions->size; i++) {
+    spine2d_action_t* action = (spine2d_action_t*)(info->actions->elms[i]);
+    for (j = 0; j < action->animations.size; j++) {
+      if (action->animations.elms[j] == animation) {
+        return TRUE;
       }
-      i++;
     }
-    tokenizer_deinit(&t);
+  }
+
+  for (i = 0; i < tracks.size(); i++) {
+    for (TrackEntry* entry = tracks[i]; entry != NULL; entry = entry->getNext()) {
+      for (TrackEntry* from = entry; from != NULL; from = from->getMixingFrom()) {
+        if (from->getAnimation() == animation) {
+          return TRUE;
+        }
+      }
+    }
+  }
+
+  return FALSE;
+}
+
+/*
+ * 按需解码时，释放最近用过的动作以外、也不在轨道上的动画。
+ * 事件的字符串值指向动画数据，只能在事件派发完后调用。
+ */
+static ret_t skeleton_info_unload_animations(skeleton_info_t* info) {
+  Vector<Animation*>& animations = info->skeletonData->getAnimations();
+
+  for (size_t i = 0; i < animations.size(); i++) {
+    Animation* animation = animations[i];
+    if (animation->isLoaded() && !skeleton_info_is_animation_used(info, animation)) {
+      animation->unload();
+    }
+  }
+
+  return RET_OK;
+}
+
+static spine2d_action_t* skeleton_info_get_action(skeleton_info_t* info, const char* names) {
+  tokenizer_t t;
+  uint32_t i = 0;
+  spine2d_action_t* action = NULL;
+
+  for (i = 0; i < info->actions->size; i++) {
+    action = (spine2d_action_t*)(info->actions->elms[i]);
+    if (tk_str_eq(action->action, names)) {
+      return action;
+    }
+  }
+
+  action = TKMEM_ZALLOC(spine2d_action_t);
+  return_value_if_fail(action != NULL, NULL);
+  action->action = tk_strdup(names);
+  darray_init(&(action->animations), 1, NULL, NULL);
+
+  tokenizer_init(&t, names, tk_strlen(names), ",");
+  while (tokenizer_has_more(&t)) {
+    const char* name = tokenizer_next(&t);
+    /*借用 tokenizer 的缓冲区，不复制名称*/
+    Animation* animation = info->skeletonData->findAnimation(String(name, true, false));
+    if (animation != NULL) {
+      darray_push(&(action->animations), animation);
+    } else {
+      log_warn("animation %s not found\n", name);
+    }
+  }
+  tokenizer_deinit(&t);
+
+  if (info->actions->size >= SPINE2D_ACTION_CACHE_SIZE) {
+    darray_remove_index(info->actions, 0);
+    darray_push(info->actions, action);
+    info->unload_pending = TRUE;
   } else {
-    animationState->setAnimation(0, names, loop);
+    darray_push(info->actions, action);
+  }
+
+  return action;
+}
+
+static ret_t track_entry_apply(TrackEntry* entry, const spine2d_track_t* track, bool_t queued) {
+  entry->setAlpha(track->alpha);
+  entry->setMixBlend((MixBlend)(track->blend));
+  if (track->mix >= 0) {
+    if (queued) {
+      /*重新计算排队动画的开始时间*/
+      entry->setMixDuration(track->mix, 0);
+    } else {
+      entry->setMixDuration(track->mix);
+    }
+  }
+
+  return RET_OK;
+}
+
+static ret_t skeleton_info_set_track_action(skeleton_info_t* info, uint32_t index,
+                                            const char* names, bool_t loop,
+                                            const spine2d_track_t* track) {
+  uint32_t i = 0;
+  spine2d_action_t* action = NULL;
+  return_value_if_fail(info != NULL && names != NULL && track != NULL, RET_BAD_PARAMS);
+
+  action = skeleton_info_get_action(info, names);
+  return_value_if_fail(action != NULL, RET_OOM);
+
+  for (i = 0; i < action->animations.size; i++) {
+    Animation* animation = (Animation*)(action->animations.elms[i]);
+    if (i == 0) {
+      track_entry_apply(info->animationState->setAnimation(index, animation, loop), track, FALSE);
+    } else {
+      track_entry_apply(info->animationState->addAnimation(index, animation, loop, 0), track, TRUE);
+    }
+  }
+
+  return RET_OK;
+}
+
+/*设置轨道上当前动画和排队动画的混合参数*/
+static ret_t skeleton_info_update_track(skeleton_info_t* info, uint32_t index,
+                                        const spine2d_track_t* track) {
+  TrackEntry* entry = info->animationState->getCurrent(index);
+
+  for (; entry != NULL; entry = entry->getNext()) {
+    entry->setAlpha(track->alpha);
+    entry->setMixBlend((MixBlend)(track->blend));
+  }
+
+  return RET_OK;
+}
+
+static ret_t skeleton_info_clear_track(skeleton_info_t* info, uint32_t index,
+                                       const spine2d_track_t* track) {
+  float mix = track->mix >= 0 ? track->mix : info->animationStateData->getDefaultMix();
+
+  if (info->animationState->getCurrent(index) != NULL) {
+    info->animationState->setEmptyAnimation(index, mix);
+  }
+
+  return RET_OK;
+}
+
+static const spine2d_track_t* spine2d_peek_track(spine2d_t* spine2d, uint32_t index) {
+  if (spine2d->tracks == NULL) {
+    return &s_spine2d_default_track;
+  }
+
+  return (spine2d_track_t*)(spine2d->tracks) + index;
+}
+
+static spine2d_track_t* spine2d_get_track(spine2d_t* spine2d, uint32_t index) {
+  uint32_t i = 0;
+  return_value_if_fail(spine2d != NULL && index < SPINE2D_MAX_TRACKS, NULL);
+
+  if (spine2d->tracks == NULL) {
+    spine2d_track_t* tracks = TKMEM_ZALLOCN(spine2d_track_t, SPINE2D_MAX_TRACKS);
+    return_value_if_fail(tracks != NULL, NULL);
+
+    for (i = 0; i < SPINE2D_MAX_TRACKS; i++) {
+      tracks[i] = s_spine2d_default_track;
+    }
+    spine2d->tracks = tracks;
+  }
+
+  return (spine2d_track_t*)(spine2d->tracks) + index;
+}
+
+static ret_t spine2d_destroy_tracks(spine2d_t* spine2d) {
+  uint32_t i = 0;
+  spine2d_track_t* tracks = (spine2d_track_t*)(spine2d->tracks);
+
+  if (tracks != NULL) {
+    for (i = 0; i < SPINE2D_MAX_TRACKS; i++) {
+      TKMEM_FREE(tracks[i].action);
+    }
+    TKMEM_FREE(spine2d->tracks);
   }
 
   return RET_OK;
@@ -122,6 +506,29 @@ static ret_t skeleton_update_position_size(widget_t* widget, Skeleton* skeleton)
   return RET_OK;
 }
 
+static ret_t skeleton_info_set_fixed_fps(skeleton_info_t* info, uint32_t fixed_fps,
+                                         bool_t interpolate) {
+  size_t n = info->skeleton->getBoneWorlds().size();
+  float step = fixed_fps > 0 ? 1.0f / fixed_fps : 0;
+
+  spine_clock_set_step(&(info->clock), step, SPINE2D_MAX_CATCH_UP_STEPS);
+
+  TKMEM_FREE(info->prev_worlds);
+  TKMEM_FREE(info->last_worlds);
+  if (fixed_fps > 0 && interpolate && n > 0) {
+    info->prev_worlds = TKMEM_ZALLOCN(BoneWorld, n);
+    info->last_worlds = TKMEM_ZALLOCN(BoneWorld, n);
+    if (info->prev_worlds == NULL || info->last_worlds == NULL) {
+      TKMEM_FREE(info->prev_worlds);
+      TKMEM_FREE(info->last_worlds);
+    } else if (info->posed) {
+      memcpy(info->prev_worlds, info->skeleton->getBoneWorlds().buffer(), n * sizeof(BoneWorld));
+    }
+  }
+
+  return RET_OK;
+}
+
 static skeleton_info_t* skeleton_info_create(widget_t* widget) {
   spine2d_t* spine2d = SPINE2D(widget);
   asset_info_t* asset_atlas = NULL;
@@ -138,45 +545,70 @@ static skeleton_info_t* skeleton_info_create(widget_t* widget) {
   return_value_if_fail(info != NULL, NULL);
 
   GlTextureLoader textureLoader;
+  /*文本图集和 spine2d_compile 生成的二进制图集由 Atlas 根据文件头识别。*/
   asset_atlas = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, atlas_file);
   Atlas* atlas = new Atlas((const char*)asset_atlas->data, asset_atlas->size, "", &textureLoader);
   asset_info_unref(asset_atlas);
 
   SkeletonBinary binary(atlas);
+  binary.setLazyAnimations(spine2d->lazy_load);
+  /*骨骼数据一起加载一起释放，从它自己的内存池中分配，避免上千次小块分配造成的碎片。*/
+  binary.setArena(true);
   asset_skel = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, skel_file);
-  SkeletonData* skeletonData = binary.readSkeletonData(asset_skel->data, asset_skel->size);
-  asset_info_unref(asset_skel);
+  SkeletonData* skeletonData = NULL;
+  if (asset_skel != NULL) {
+    skeletonData = spine2d_read_skeleton_data(binary, asset_skel);
+  }
+  if (skeletonData == NULL) {
+    String& error = binary.getError();
+    log_error("load %s failed: %s\n", skel_file, error.isEmpty() ? "" : error.buffer());
+    delete atlas;
+    TKMEM_FREE(info);
+    return NULL;
+  }
 
   Skeleton* skeleton = new Skeleton(skeletonData);
+  /*控件只负责绘制，不可见的骨骼无需计算。*/
+  skeleton->setRenderDriven(true);
 
   skeleton_update_position_size(widget, skeleton);
   AnimationStateData* animationStateData = new AnimationStateData(skeletonData);
   animationStateData->setDefaultMix(0.2f);
   AnimationState* animationState = new AnimationState(animationStateData);
-  animationState->setListener(new MyAnimationStateListenerObject(widget));
-
-  if (TK_STR_IS_NOT_EMPTY(spine2d->action)) {
-    spine2d->skeleton_info = info;
-    animation_state_set_names(animationState, spine2d->action, spine2d->loop);
-  }
-  animationState->setTimeScale(spine2d->scale_time);
+  MyAnimationStateListenerObject* listener = new MyAnimationStateListenerObject(widget);
+  animationState->setListener(listener);
 
   info->atlas = atlas;
   info->skeleton = skeleton;
   info->skeletonData = skeletonData;
   info->animationState = animationState;
   info->animationStateData = animationStateData;
+  info->listener = listener;
   info->renderer = renderer_create();
+  info->actions = darray_create(SPINE2D_ACTION_CACHE_SIZE, spine2d_action_destroy, NULL);
   renderer_set_viewport_size(info->renderer, wm->w, wm->h);
-  info->last_time = time_now_ms() / 1000.0f;
+  spine_clock_init(&(info->clock), time_now_us());
+  skeleton_info_set_fixed_fps(info, spine2d->fixed_fps, spine2d->interpolate);
+
+  spine2d->skeleton_info = info;
+  if (TK_STR_IS_NOT_EMPTY(spine2d->action)) {
+    skeleton_info_set_track_action(info, 0, spine2d->action, spine2d->loop,
+                                   spine2d_peek_track(spine2d, 0));
+  }
+  if (spine2d->tracks != NULL) {
+    uint32_t i = 0;
+    for (i = 1; i < SPINE2D_MAX_TRACKS; i++) {
+      const spine2d_track_t* track = spine2d_peek_track(spine2d, i);
+      if (TK_STR_IS_NOT_EMPTY(track->action)) {
+        skeleton_info_set_track_action(info, i, track->action, track->loop, track);
+      }
+    }
+  }
+  animationState->setTimeScale(spine2d->scale_time);
 
   return info;
 }
-static ret_t skeleton_info_update(skeleton_info_t* info) {
-  double now = time_now_ms() / 1000.0f;
-  return_value_if_fail(info != NULL, RET_BAD_PARAMS);
-  float delta = now - info->last_time;
-  info->last_time = now;
+static ret_t skeleton_info_step(skeleton_info_t* info, float delta) {
   // Update and apply the animation state to the skeleton
   info->animationState->update(delta);
   info->animationState->apply(*(info->skeleton));
@@ -190,8 +622,94 @@ static ret_t skeleton_info_update(skeleton_info_t* info) {
   return RET_OK;
 }
 
+static ret_t skeleton_info_update(skeleton_info_t* info) {
+  float delta = 0;
+  uint32_t i = 0;
+  uint32_t steps = 0;
+  return_value_if_fail(info != NULL, RET_BAD_PARAMS);
+
+  Vector<BoneWorld>& worlds = info->skeleton->getBoneWorlds();
+  size_t size = worlds.size() * sizeof(BoneWorld);
+  uint64_t start = time_now_us();
+
+  steps = spine_clock_advance(&(info->clock), start, &delta);
+  if (steps == 0 && !info->posed) {
+    /*创建后的第一次更新总要计算出姿势*/
+    steps = 1;
+    delta = 0;
+  }
+
+  for (i = 0; i < steps; i++) {
+    if (info->prev_worlds != NULL && i + 1 == steps) {
+      memcpy(info->prev_worlds, worlds.buffer(), size);
+    }
+    skeleton_info_step(info, delta);
+  }
+
+  if (steps > 0 && !info->posed) {
+    info->posed = TRUE;
+    if (info->prev_worlds != NULL) {
+      memcpy(info->prev_worlds, worlds.buffer(), size);
+    }
+  }
+  info->alpha = spine_clock_get_alpha(&(info->clock));
+
+  float cost = (float)(time_now_us() - start);
+  if (info->update_cost_us > 0) {
+    info->update_cost_us = info->update_cost_us * 0.875f + cost * 0.125f;
+  } else {
+    info->update_cost_us = cost;
+  }
+
+  return RET_OK;
+}
+
+static ret_t skeleton_info_update_task(void* ctx) {
+  return skeleton_info_update((skeleton_info_t*)ctx);
+}
+
+static ret_t skeleton_info_flush(skeleton_info_t* info) {
+  return_value_if_fail(info != NULL, RET_BAD_PARAMS);
+
+  info->listener->flush();
+
+  if (info->unload_pending) {
+    info->unload_pending = FALSE;
+    skeleton_info_unload_animations(info);
+  }
+
+  return RET_OK;
+}
+
+/*
+ * 插值绘制：骨骼的世界变换换成上一步和最近一步之间的插值，绘制后再恢复。
+ * 顶点是骨骼变换的线性函数，插值骨骼变换等同于插值顶点。
+ */
 static ret_t skeleton_info_draw(skeleton_info_t* info) {
-  renderer_draw(info->renderer, info->skeleton, true);
+  if (info->prev_worlds != NULL && info->alpha < 1) {
+    size_t i = 0;
+    float alpha = info->alpha;
+    Vector<BoneWorld>& worlds = info->skeleton->getBoneWorlds();
+    BoneWorld* current = worlds.buffer();
+    size_t n = worlds.size();
+
+    memcpy(info->last_worlds, current, n * sizeof(BoneWorld));
+    for (i = 0; i < n; i++) {
+      const BoneWorld& prev = info->prev_worlds[i];
+      const BoneWorld& last = info->last_worlds[i];
+      current[i].a = prev.a + (last.a - prev.a) * alpha;
+      current[i].b = prev.b + (last.b - prev.b) * alpha;
+      current[i].c = prev.c + (last.c - prev.c) * alpha;
+      current[i].d = prev.d + (last.d - prev.d) * alpha;
+      current[i].worldX = prev.worldX + (last.worldX - prev.worldX) * alpha;
+      current[i].worldY = prev.worldY + (last.worldY - prev.worldY) * alpha;
+    }
+    renderer_draw(info->renderer, info->skeleton, true);
+    memcpy(current, info->last_worlds, n * sizeof(BoneWorld));
+  } else {
+    renderer_draw(info->renderer, info->skeleton, true);
+  }
+
   return RET_OK;
 }
 
@@ -200,32 +718,167 @@ static ret_t skeleton_info_destroy(skeleton_info_t* info) {
 
   delete info->animationState;
   delete info->animationStateData;
+  delete info->listener;
   delete info->skeleton;
   delete info->skeletonData;
   renderer_dispose(info->renderer);
+  darray_destroy(info->actions);
+  TKMEM_FREE(info->prev_worlds);
+  TKMEM_FREE(info->last_worlds);
 
   TKMEM_FREE(info);
 
   return RET_OK;
 }
 
+static uint32_t spine2d_get_effective_fps_impl(spine2d_t* spine2d) {
+  uint32_t display_fps = 1000 / SPINE2D_TIMER_INTERVAL;
+  uint32_t fps = spine2d->update_fps > 0 ? tk_min(spine2d->update_fps, display_fps) : display_fps;
+
+  if (spine2d->throttled && fps > SPINE2D_THROTTLED_FPS) {
+    fps = SPINE2D_THROTTLED_FPS;
+  }
+
+  return fps;
+}
+
+/*定时器按固定间隔触发，根据实际更新频率决定本次是否更新*/
+static bool_t spine2d_is_update_due(spine2d_t* spine2d, uint64_t now) {
+  uint32_t fps = spine2d_get_effective_fps_impl(spine2d);
+  uint64_t interval = 1000000 / fps;
+
+  if (fps >= 1000 / SPINE2D_TIMER_INTERVAL) {
+    return TRUE;
+  }
+
+  /*提前不到半个定时器间隔也算到期，避免错过一次要多等一个间隔*/
+  if (now + SPINE2D_TIMER_INTERVAL * 500 < spine2d->next_update_us) {
+    return FALSE;
+  }
+  if (spine2d->next_update_us + interval <= now) {
+    spine2d->next_update_us = now;
+  }
+  spine2d->next_update_us += interval;
+
+  return TRUE;
+}
+
+/*
+ * 按各控件最近的更新耗时和更新频率估算 CPU 占用，超出预算时从优先级低的控件开始限制更新频率。
+ */
+static ret_t spine2d_apply_cpu_budget(uint64_t now) {
+  uint32_t i = 0;
+  double load = 0;
+  double budget = s_spine2d_cpu_budget * 10000.0;
+  return_value_if_fail(s_spine2d_widgets != NULL, RET_BAD_PARAMS);
+
+  if (now < s_spine2d_budget_check_us + SPINE2D_BUDGET_CHECK_INTERVAL) {
+    return RET_OK;
+  }
+  s_spine2d_budget_check_us = now;
+
+  for (i = 0; i < s_spine2d_widgets->size; i++) {
+    spine2d_t* spine2d = SPINE2D(s_spine2d_widgets->elms[i]);
+    skeleton_info_t* info = (skeleton_info_t*)spine2d->skeleton_info;
+    spine2d->throttled = FALSE;
+    load += info->update_cost_us * spine2d_get_effective_fps_impl(spine2d);
+  }
+
+  while (s_spine2d_cpu_budget > 0 && load > budget) {
+    spine2d_t* lowest = NULL;
+    for (i = 0; i < s_spine2d_widgets->size; i++) {
+      spine2d_t* spine2d = SPINE2D(s_spine2d_widgets->elms[i]);
+      if (spine2d->throttled || spine2d_get_effective_fps_impl(spine2d) <= SPINE2D_THROTTLED_FPS) {
+        continue;
+      }
+      if (lowest == NULL || spine2d->priority < lowest->priority) {
+        lowest = spine2d;
+      }
+    }
+    if (lowest == NULL) {
+      break;
+    }
+
+    skeleton_info_t* info = (skeleton_info_t*)lowest->skeleton_info;
+    load -= info->update_cost_us * spine2d_get_effective_fps_impl(lowest);
+    lowest->throttled = TRUE;
+    load += info->update_cost_us * spine2d_get_effective_fps_impl(lowest);
+  }
+
+  return RET_OK;
+}
+
 static ret_t spine2d_on_update_timer(const timer_info_t* timer) {
   widget_t* widget = WIDGET(timer->ctx);
   spine2d_t* spine2d = SPINE2D(widget);
+  uint64_t now = time_now_us();
   return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
 
+  spine2d_apply_cpu_budget(now);
+  /*以第一个控件的定时器作为一帧的分界，统计每帧的分配次数*/
+  if (s_spine2d_widgets != NULL && s_spine2d_widgets->size > 0 &&
+      s_spine2d_widgets->elms[0] == widget) {
+    spine_mem_end_frame();
+  }
+  if (!spine2d_is_update_due(spine2d, now)) {
+    return RET_REPEAT;
+  }
+
   skeleton_info_update((skeleton_info_t*)spine2d->skeleton_info);
+  skeleton_info_flush((skeleton_info_t*)spine2d->skeleton_info);
 
   widget_invalidate(widget, NULL);
 
   return RET_REPEAT;
 }
 
+static ret_t spine2d_on_parallel_update_timer(const timer_info_t* timer) {
+  uint32_t i = 0;
+  uint64_t now = time_now_us();
+  return_value_if_fail(s_spine2d_pool != NULL && s_spine2d_widgets != NULL, RET_REMOVE);
+
+  spine2d_apply_cpu_budget(now);
+  spine_mem_end_frame();
+  darray_clear(s_spine2d_tasks);
+  for (i = 0; i < s_spine2d_widgets->size; i++) {
+    spine2d_t* spine2d = SPINE2D(s_spine2d_widgets->elms[i]);
+    spine2d->update_due = spine2d_is_update_due(spine2d, now);
+    if (spine2d->update_due) {
+      darray_push(s_spine2d_tasks, spine2d->skeleton_info);
+    }
+  }
+  if (spine_task_pool_run(s_spine2d_pool, skeleton_info_update_task, s_spine2d_tasks->elms,
+                          s_spine2d_tasks->size) != RET_OK) {
+    /*没有执行的任务在这里补上，否则下面刷新的是上一帧的状态*/
+    for (i = 0; i < s_spine2d_tasks->size; i++) {
+      skeleton_info_update_task(s_spine2d_tasks->elms[i]);
+    }
+  }
+
+  /*事件处理函数可能销毁控件，倒序遍历*/
+  for (i = s_spine2d_widgets->size; i > 0; i--) {
+    if (i <= s_spine2d_widgets->size) {
+      widget_t* widget = WIDGET(s_spine2d_widgets->elms[i - 1]);
+      spine2d_t* spine2d = SPINE2D(widget);
+      if (spine2d->update_due) {
+        spine2d->update_due = FALSE;
+        skeleton_info_flush((skeleton_info_t*)spine2d->skeleton_info);
+        widget_invalidate(widget, NULL);
+      }
+    }
+  }
+
+  return RET_REPEAT;
+}
+
 static ret_t spine2d_create_skeleton(widget_t* widget) {
   spine2d_t* spine2d = SPINE2D(widget);
   return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
 
-  Bone::setYDown(true);
+  /*工作线程只在 spine_task_pool_run 期间运行，而它在 UI 线程中同步等待，所以这里修改全局状态是安全的*/
+  if (!Bone::isYDown()) {
+    Bone::setYDown(true);
+  }
   try {
     spine2d->skeleton_info = skeleton_info_create(widget);
   } catch (const std::exception& e) {
@@ -233,7 +886,70 @@ static ret_t spine2d_create_skeleton(widget_t* widget) {
   }
 
   skeleton_info_update((skeleton_info_t*)spine2d->skeleton_info);
-  spine2d->timer_id = timer_add(spine2d_on_update_timer, widget, 16);
+  skeleton_info_flush((skeleton_info_t*)spine2d->skeleton_info);
+  return_value_if_fail(spine2d->skeleton_info != NULL, RET_FAIL);
+
+  if (s_spine2d_widgets == NULL) {
+    s_spine2d_widgets = darray_create(10, NULL, NULL);
+  }
+  darray_push(s_spine2d_widgets, widget);
+  if (s_spine2d_pool == NULL) {
+    spine2d->timer_id = timer_add(spine2d_on_update_timer, widget, SPINE2D_TIMER_INTERVAL);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_parallel_update(uint32_t threads) {
+  uint32_t i = 0;
+
+  if (s_spine2d_pool != NULL) {
+    if (spine_task_pool_get_threads(s_spine2d_pool) == threads) {
+      return RET_OK;
+    }
+
+    timer_remove(s_spine2d_timer_id);
+    s_spine2d_timer_id = TK_INVALID_ID;
+    spine_task_pool_destroy(s_spine2d_pool);
+    s_spine2d_pool = NULL;
+    darray_destroy(s_spine2d_tasks);
+    s_spine2d_tasks = NULL;
+
+    if (SpineExtension::getInstance() == s_spine2d_extension) {
+      SpineExtension::setInstance(s_spine2d_extension->inner);
+      delete s_spine2d_extension;
+    }
+    s_spine2d_extension = NULL;
+
+    if (s_spine2d_widgets != NULL) {
+      for (i = 0; i < s_spine2d_widgets->size; i++) {
+        widget_t* widget = WIDGET(s_spine2d_widgets->elms[i]);
+        SPINE2D(widget)->timer_id = timer_add(spine2d_on_update_timer, widget, SPINE2D_TIMER_INTERVAL);
+      }
+    }
+  }
+
+  if (threads < 2) {
+    return RET_OK;
+  }
+
+  s_spine2d_pool = spine_task_pool_create(threads);
+  return_value_if_fail(s_spine2d_pool != NULL, RET_FAIL);
+  s_spine2d_tasks = darray_create(10, NULL, NULL);
+  /*spine_mem_init 安装的 SpineExtension 本身是线程安全的，不用再加锁*/
+  if (!spine_mem_is_installed()) {
+    s_spine2d_extension = new LockedSpineExtension(SpineExtension::getInstance());
+    SpineExtension::setInstance(s_spine2d_extension);
+  }
+
+  if (s_spine2d_widgets != NULL) {
+    for (i = 0; i < s_spine2d_widgets->size; i++) {
+      spine2d_t* spine2d = SPINE2D(s_spine2d_widgets->elms[i]);
+      timer_remove(spine2d->timer_id);
+      spine2d->timer_id = TK_INVALID_ID;
+    }
+  }
+  s_spine2d_timer_id = timer_add(spine2d_on_parallel_update_timer, NULL, SPINE2D_TIMER_INTERVAL);
 
   return RET_OK;
 }
@@ -265,9 +981,101 @@ ret_t spine2d_set_action(widget_t* widget, const char* action) {
   return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
 
   spine2d->action = tk_str_copy(spine2d->action, action);
+  if (spine2d->skeleton_info != NULL && spine2d->action != NULL) {
+    skeleton_info_t* info = (skeleton_info_t*)spine2d->skeleton_info;
+    skeleton_info_set_track_action(info, 0, spine2d->action, spine2d->loop,
+                                   spine2d_peek_track(spine2d, 0));
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_track_action(widget_t* widget, uint32_t track, const char* action, bool_t loop) {
+  spine2d_track_t* t = NULL;
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL && track < SPINE2D_MAX_TRACKS, RET_BAD_PARAMS);
+
+  if (track == 0) {
+    spine2d->loop = loop;
+    return spine2d_set_action(widget, action);
+  }
+
+  t = spine2d_get_track(spine2d, track);
+  return_value_if_fail(t != NULL, RET_OOM);
+
+  t->action = tk_str_copy(t->action, action);
+  t->loop = loop;
   if (spine2d->skeleton_info != NULL) {
     skeleton_info_t* info = (skeleton_info_t*)spine2d->skeleton_info;
-    animation_state_set_names(info->animationState, spine2d->action, spine2d->loop);
+    if (TK_STR_IS_NOT_EMPTY(t->action)) {
+      skeleton_info_set_track_action(info, track, t->action, t->loop, t);
+    } else {
+      skeleton_info_clear_track(info, track, t);
+    }
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_track_alpha(widget_t* widget, uint32_t track, float alpha) {
+  spine2d_track_t* t = NULL;
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL && track < SPINE2D_MAX_TRACKS, RET_BAD_PARAMS);
+
+  t = spine2d_get_track(spine2d, track);
+  return_value_if_fail(t != NULL, RET_OOM);
+
+  t->alpha = alpha;
+  if (spine2d->skeleton_info != NULL) {
+    skeleton_info_update_track((skeleton_info_t*)spine2d->skeleton_info, track, t);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_track_mix(widget_t* widget, uint32_t track, float duration) {
+  spine2d_track_t* t = NULL;
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL && track < SPINE2D_MAX_TRACKS, RET_BAD_PARAMS);
+
+  t = spine2d_get_track(spine2d, track);
+  return_value_if_fail(t != NULL, RET_OOM);
+
+  t->mix = duration;
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_track_blend(widget_t* widget, uint32_t track, spine2d_blend_t blend) {
+  spine2d_track_t* t = NULL;
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL && track < SPINE2D_MAX_TRACKS, RET_BAD_PARAMS);
+  return_value_if_fail(blend <= SPINE2D_BLEND_ADD, RET_BAD_PARAMS);
+
+  t = spine2d_get_track(spine2d, track);
+  return_value_if_fail(t != NULL, RET_OOM);
+
+  t->blend = blend;
+  if (spine2d->skeleton_info != NULL) {
+    skeleton_info_update_track((skeleton_info_t*)spine2d->skeleton_info, track, t);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_clear_track(widget_t* widget, uint32_t track) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL && track < SPINE2D_MAX_TRACKS, RET_BAD_PARAMS);
+
+  if (track == 0) {
+    TKMEM_FREE(spine2d->action);
+  } else if (spine2d->tracks != NULL) {
+    TKMEM_FREE(spine2d_get_track(spine2d, track)->action);
+  }
+
+  if (spine2d->skeleton_info != NULL) {
+    skeleton_info_clear_track((skeleton_info_t*)spine2d->skeleton_info, track,
+                              spine2d_peek_track(spine2d, track));
   }
 
   return RET_OK;
@@ -321,6 +1129,155 @@ ret_t spine2d_set_loop(widget_t* widget, bool_t loop) {
   return RET_OK;
 }
 
+ret_t spine2d_set_update_fps(widget_t* widget, uint32_t update_fps) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
+
+  spine2d->update_fps = update_fps;
+  spine2d->next_update_us = 0;
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_priority(widget_t* widget, int32_t priority) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
+
+  spine2d->priority = priority;
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_lazy_load(widget_t* widget, bool_t lazy_load) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
+
+  spine2d->lazy_load = lazy_load;
+
+  return RET_OK;
+}
+
+uint32_t spine2d_get_effective_fps(widget_t* widget) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, 0);
+
+  return spine2d_get_effective_fps_impl(spine2d);
+}
+
+ret_t spine2d_set_cpu_budget(uint32_t percent) {
+  s_spine2d_cpu_budget = percent;
+  /*下次更新时重新检查*/
+  s_spine2d_budget_check_us = 0;
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_fixed_fps(widget_t* widget, uint32_t fixed_fps) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
+
+  spine2d->fixed_fps = fixed_fps;
+  if (spine2d->skeleton_info != NULL) {
+    skeleton_info_t* info = (skeleton_info_t*)spine2d->skeleton_info;
+    skeleton_info_set_fixed_fps(info, spine2d->fixed_fps, spine2d->interpolate);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine2d_set_interpolate(widget_t* widget, bool_t interpolate) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  return_value_if_fail(spine2d != NULL, RET_BAD_PARAMS);
+
+  spine2d->interpolate = interpolate;
+  if (spine2d->skeleton_info != NULL) {
+    skeleton_info_t* info = (skeleton_info_t*)spine2d->skeleton_info;
+    skeleton_info_set_fixed_fps(info, spine2d->fixed_fps, spine2d->interpolate);
+  }
+
+  return RET_OK;
+}
+
+static const char* s_spine2d_blend_names[] = {"setup", "first", "replace", "add"};
+
+/*解析 "track1.alpha" 形式的属性名，返回轨道属性名*/
+static const char* spine2d_parse_track_prop(const char* name, uint32_t* track) {
+  uint32_t index = 0;
+  const char* p = name + sizeof(SPINE2D_PROP_TRACK) - 1;
+
+  if (!tk_str_start_with(name, SPINE2D_PROP_TRACK) || !isdigit(*p)) {
+    return NULL;
+  }
+  for (; isdigit(*p); p++) {
+    index = index * 10 + (*p - '0');
+  }
+  return_value_if_fail(*p == '.' && index < SPINE2D_MAX_TRACKS, NULL);
+  *track = index;
+
+  return p + 1;
+}
+
+static ret_t spine2d_get_track_prop(spine2d_t* spine2d, uint32_t index, const char* name,
+                                    value_t* v) {
+  const spine2d_track_t* track = spine2d_peek_track(spine2d, index);
+
+  if (tk_str_eq(SPINE2D_TRACK_PROP_ACTION, name)) {
+    value_set_str(v, index == 0 ? spine2d->action : track->action);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_LOOP, name)) {
+    value_set_bool(v, index == 0 ? spine2d->loop : track->loop);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_ALPHA, name)) {
+    value_set_float(v, track->alpha);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_MIX, name)) {
+    value_set_float(v, track->mix);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_BLEND, name)) {
+    value_set_str(v, s_spine2d_blend_names[track->blend]);
+    return RET_OK;
+  }
+
+  return RET_NOT_FOUND;
+}
+
+static ret_t spine2d_set_track_prop(widget_t* widget, uint32_t index, const char* name,
+                                    const value_t* v) {
+  spine2d_t* spine2d = SPINE2D(widget);
+  const spine2d_track_t* track = spine2d_peek_track(spine2d, index);
+
+  if (tk_str_eq(SPINE2D_TRACK_PROP_ACTION, name)) {
+    bool_t loop = index == 0 ? spine2d->loop : track->loop;
+    return spine2d_set_track_action(widget, index, value_str(v), loop);
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_LOOP, name)) {
+    spine2d_track_t* t = NULL;
+    if (index == 0) {
+      return spine2d_set_loop(widget, value_bool(v));
+    }
+    t = spine2d_get_track(spine2d, index);
+    return_value_if_fail(t != NULL, RET_OOM);
+    t->loop = value_bool(v);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_ALPHA, name)) {
+    return spine2d_set_track_alpha(widget, index, value_float(v));
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_MIX, name)) {
+    return spine2d_set_track_mix(widget, index, value_float(v));
+  } else if (tk_str_eq(SPINE2D_TRACK_PROP_BLEND, name)) {
+    uint32_t i = 0;
+    if (v->type != VALUE_TYPE_STRING) {
+      return spine2d_set_track_blend(widget, index, (spine2d_blend_t)value_int(v));
+    }
+    for (i = 0; i < ARRAY_SIZE(s_spine2d_blend_names); i++) {
+      if (tk_str_ieq(s_spine2d_blend_names[i], value_str(v))) {
+        return spine2d_set_track_blend(widget, index, (spine2d_blend_t)i);
+      }
+    }
+    return RET_BAD_PARAMS;
+  }
+
+  return RET_NOT_FOUND;
+}
+
 static ret_t spine2d_get_prop(widget_t* widget, const char* name, value_t* v) {
   spine2d_t* spine2d = SPINE2D(widget);
   return_value_if_fail(spine2d != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
@@ -346,6 +1303,30 @@ static ret_t spine2d_get_prop(widget_t* widget, const char* name, value_t* v) {
   } else if (tk_str_eq(SPINE2D_PROP_LOOP, name)) {
     value_set_bool(v, spine2d->loop);
     return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_FIXED_FPS, name)) {
+    value_set_uint32(v, spine2d->fixed_fps);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_INTERPOLATE, name)) {
+    value_set_bool(v, spine2d->interpolate);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_UPDATE_FPS, name)) {
+    value_set_uint32(v, spine2d->update_fps);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_PRIORITY, name)) {
+    value_set_int32(v, spine2d->priority);
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_EFFECTIVE_FPS, name)) {
+    value_set_uint32(v, spine2d_get_effective_fps_impl(spine2d));
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_LAZY_LOAD, name)) {
+    value_set_bool(v, spine2d->lazy_load);
+    return RET_OK;
+  } else if (tk_str_start_with(name, SPINE2D_PROP_TRACK)) {
+    uint32_t track = 0;
+    const char* prop = spine2d_parse_track_prop(name, &track);
+    if (prop != NULL) {
+      return spine2d_get_track_prop(spine2d, track, prop, v);
+    }
   }
 
   return RET_NOT_FOUND;
@@ -375,6 +1356,27 @@ static ret_t spine2d_set_prop(widget_t* widget, const char* name, const value_t*
   } else if (tk_str_eq(SPINE2D_PROP_LOOP, name)) {
     spine2d_set_loop(widget, value_bool(v));
     return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_FIXED_FPS, name)) {
+    spine2d_set_fixed_fps(widget, value_uint32(v));
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_INTERPOLATE, name)) {
+    spine2d_set_interpolate(widget, value_bool(v));
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_UPDATE_FPS, name)) {
+    spine2d_set_update_fps(widget, value_uint32(v));
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_PRIORITY, name)) {
+    spine2d_set_priority(widget, value_int32(v));
+    return RET_OK;
+  } else if (tk_str_eq(SPINE2D_PROP_LAZY_LOAD, name)) {
+    spine2d_set_lazy_load(widget, value_bool(v));
+    return RET_OK;
+  } else if (tk_str_start_with(name, SPINE2D_PROP_TRACK)) {
+    uint32_t track = 0;
+    const char* prop = spine2d_parse_track_prop(name, &track);
+    if (prop != NULL) {
+      return spine2d_set_track_prop(widget, track, prop, v);
+    }
   }
 
   return RET_NOT_FOUND;
@@ -387,9 +1389,13 @@ static ret_t spine2d_on_destroy(widget_t* widget) {
   TKMEM_FREE(spine2d->atlas);
   TKMEM_FREE(spine2d->skeleton);
   TKMEM_FREE(spine2d->action);
-  timer_remove(spine2d->timer_id);
+  spine2d_destroy_tracks(spine2d);
+  if (spine2d->timer_id != TK_INVALID_ID) {
+    timer_remove(spine2d->timer_id);
+  }
 
   if (spine2d->skeleton_info != NULL) {
+    darray_remove(s_spine2d_widgets, widget);
     skeleton_info_destroy((skeleton_info_t*)spine2d->skeleton_info);
   }
   return RET_OK;
@@ -437,9 +1443,13 @@ static ret_t spine2d_on_event(widget_t* widget, event_t* e) {
   return RET_OK;
 }
 
-const char* s_spine2d_properties[] = {
-    SPINE2D_PROP_ATLAS,   SPINE2D_PROP_SKELETON,   SPINE2D_PROP_ACTION, SPINE2D_PROP_SCALE_X,
-    SPINE2D_PROP_SCALE_Y, SPINE2D_PROP_SCALE_TIME, SPINE2D_PROP_LOOP,   NULL};
+const char* s_spine2d_properties[] = {SPINE2D_PROP_ATLAS,       SPINE2D_PROP_SKELETON,
+                                     SPINE2D_PROP_ACTION,      SPINE2D_PROP_SCALE_X,
+                                     SPINE2D_PROP_SCALE_Y,     SPINE2D_PROP_SCALE_TIME,
+                                     SPINE2D_PROP_LOOP,        SPINE2D_PROP_FIXED_FPS,
+                                     SPINE2D_PROP_INTERPOLATE, SPINE2D_PROP_UPDATE_FPS,
+                                     SPINE2D_PROP_PRIORITY,    SPINE2D_PROP_LAZY_LOAD,
+                                     NULL};
 
 TK_DECL_VTABLE(spine2d) = {.size = sizeof(spine2d_t),
                            .type = WIDGET_TYPE_SPINE2D,
@@ -462,6 +1472,7 @@ widget_t* spine2d_create(widget_t* parent, xy_t x, xy_t y, wh_t w, wh_t h) {
   spine2d->scale_y = 1;
   spine2d->scale_time = 1;
   spine2d->loop = TRUE;
+  spine2d->timer_id = TK_INVALID_ID;
 
   return widget;
 }
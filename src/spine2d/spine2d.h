@@ -24,8 +24,57 @@
 #define TK_SPINE2D_H
 
 #include "base/widget.h"
+#include "spine2d_event.h"
 
 BEGIN_C_DECLS
+
+/**
+ * @const SPINE2D_MAX_TRACKS
+ * 动画轨道的最大个数。
+ */
+#define SPINE2D_MAX_TRACKS 8
+
+/**
+ * @const SPINE2D_MAX_CATCH_UP_STEPS
+ * 固定步长模拟时，一次更新最多模拟的步数。
+ */
+#define SPINE2D_MAX_CATCH_UP_STEPS 4
+
+/**
+ * @const SPINE2D_THROTTLED_FPS
+ * 超出 CPU 预算时，被限制的控件的更新频率。
+ */
+#define SPINE2D_THROTTLED_FPS 15
+
+/**
+ * @enum spine2d_blend_t
+ * @prefix SPINE2D_BLEND_
+ * @annotation ["scriptable"]
+ * 轨道动画和下层轨道的混合方式，和 spine 的 MixBlend 一一对应。
+ */
+typedef enum _spine2d_blend_t {
+  /**
+   * @const SPINE2D_BLEND_SETUP
+   * 和初始姿势混合。
+   */
+  SPINE2D_BLEND_SETUP = 0,
+  /**
+   * @const SPINE2D_BLEND_FIRST
+   * 和初始姿势混合，用于最底层的轨道。
+   */
+  SPINE2D_BLEND_FIRST,
+  /**
+   * @const SPINE2D_BLEND_REPLACE
+   * 按 alpha 覆盖下层轨道的结果(缺省)。
+   */
+  SPINE2D_BLEND_REPLACE,
+  /**
+   * @const SPINE2D_BLEND_ADD
+   * 按 alpha 叠加到下层轨道的结果上。
+   */
+  SPINE2D_BLEND_ADD
+} spine2d_blend_t;
+
 /**
  * @class spine2d_t
  * @parent widget_t
@@ -48,6 +97,15 @@ BEGIN_C_DECLS
  *   </style>
  * </spine2d>
  * ```
+ *
+ * 多个动画可以在不同的轨道上同时播放，编号大的轨道叠加在编号小的轨道之上，
+ * 所有轨道共用一个骨骼，每帧只计算一次骨骼的世界变换。action 和 loop 属性对应轨道 0，
+ * 其它轨道通过 spine2d_set_track_action 等函数或者 "track1.action" 形式的属性设置。如：
+ *
+ * ```xml
+ * <!-- ui -->
+ * <spine2d action="run" track1.action="aim" track1.blend="add" track1.alpha="0.8"/>
+ * ```
  */
 typedef struct _spine2d_t {
   widget_t widget;
@@ -101,7 +159,52 @@ typedef struct _spine2d_t {
    */
   bool_t loop;
 
+  /**
+   * @property {uint32_t} fixed_fps
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 固定步长模拟的频率(每秒步数)。
+   * 0 表示按实际间隔更新(缺省)，大于 0 时按 1/fixed_fps 秒的固定步长模拟，
+   * 定时器的抖动不会影响物理模拟，落后太多时最多追赶 SPINE2D_MAX_CATCH_UP_STEPS 步。
+   */
+  uint32_t fixed_fps;
+
+  /**
+   * @property {bool_t} interpolate
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 固定步长模拟时，绘制时是否在最近两步的结果之间插值。
+   * 启用后可以用较低的模拟频率(如 30)得到平滑的绘制结果(如 60Hz)，代价是绘制延迟一步。
+   */
+  bool_t interpolate;
+
+  /**
+   * @property {uint32_t} update_fps
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 更新频率(每秒次数)。0 表示跟随显示(缺省)，不重要的小动画可以设置较低的频率以节省 CPU。
+   */
+  uint32_t update_fps;
+
+  /**
+   * @property {int32_t} priority
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 优先级(缺省为 0)。超出 CPU 预算时，从优先级低的控件开始降低更新频率。
+   */
+  int32_t priority;
+
+  /**
+   * @property {bool_t} lazy_load
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 是否按需解码动画(缺省不启用)。
+   * 启用后加载骨骼时跳过动画数据，每个动画第一次播放时才解码；
+   * 最近用过的动作以外、也不在轨道上的动画，在切换动作时释放，以后用到时再解码。
+   * 需要在加载骨骼前设置。ROM 中的资源不支持，总是在加载时解码全部动画。
+   */
+  bool_t lazy_load;
+
   /*private*/
+  bool_t throttled;
+  bool_t update_due;
+  uint64_t next_update_us;
+  void* tracks;
   void* skeleton_info;
   uint32_t timer_id;
 } spine2d_t;
@@ -121,6 +224,11 @@ typedef struct _spine2d_t {
  * 动画结束事件。
  */
 
+/**
+ * @event {spine2d_event_t} EVT_SPINE2D_EVENTS
+ * 一次更新中产生的全部动画事件(开始、打断、结束、完成、释放和自定义事件)。
+ */
+
 /**
  * @method spine2d_create
  * @annotation ["constructor", "scriptable"]
@@ -223,6 +331,163 @@ ret_t spine2d_set_scale_time(widget_t* widget, float scale_time);
  */
 ret_t spine2d_set_loop(widget_t* widget, bool_t loop);
 
+/**
+ * @method spine2d_set_fixed_fps
+ * 设置 固定步长模拟的频率。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} fixed_fps 每秒模拟的步数，0 表示按实际间隔更新。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_fixed_fps(widget_t* widget, uint32_t fixed_fps);
+
+/**
+ * @method spine2d_set_interpolate
+ * 设置 固定步长模拟时是否插值绘制。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {bool_t} interpolate 是否插值绘制。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_interpolate(widget_t* widget, bool_t interpolate);
+
+/**
+ * @method spine2d_set_update_fps
+ * 设置 更新频率。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} update_fps 每秒更新次数，0 表示跟随显示。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_update_fps(widget_t* widget, uint32_t update_fps);
+
+/**
+ * @method spine2d_set_priority
+ * 设置 优先级。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {int32_t} priority 优先级，超出 CPU 预算时优先级低的控件先降低更新频率。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_priority(widget_t* widget, int32_t priority);
+
+/**
+ * @method spine2d_set_lazy_load
+ * 设置 是否按需解码动画。需要在加载骨骼前设置。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {bool_t} lazy_load 是否按需解码动画。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_lazy_load(widget_t* widget, bool_t lazy_load);
+
+/**
+ * @method spine2d_get_effective_fps
+ * 获取实际使用的更新频率(考虑跟随显示和 CPU 预算的限制)，用于诊断。
+ * 也可以通过只读属性 effective_fps 获取。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ *
+ * @return {uint32_t} 返回每秒更新次数。
+ */
+uint32_t spine2d_get_effective_fps(widget_t* widget);
+
+/**
+ * @method spine2d_set_cpu_budget
+ * 设置全部 spine2d 控件更新骨骼的 CPU 预算。
+ *
+ * 每隔半秒根据各控件最近的更新耗时估算总的 CPU 占用，超出预算时，
+ * 从优先级低的控件开始把更新频率降到 SPINE2D_THROTTLED_FPS，直到不超出预算为止。
+ * @annotation ["static", "scriptable"]
+ * @param {uint32_t} percent 占一个 CPU 核的百分比，0 表示不限制(缺省)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_cpu_budget(uint32_t percent);
+
+/**
+ * @method spine2d_set_track_action
+ * 设置指定轨道的动画。
+ * 多个动画名用逗号分隔，依次播放。轨道 0 等同于设置 action 和 loop 属性。
+ * 其它轨道的动画名为空时，按轨道的混合时间淡出并清除该轨道。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} track 轨道序号(小于SPINE2D_MAX_TRACKS)。
+ * @param {const char*} action 动画名。
+ * @param {bool_t} loop 是否循环。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_track_action(widget_t* widget, uint32_t track, const char* action, bool_t loop);
+
+/**
+ * @method spine2d_set_track_alpha
+ * 设置指定轨道的混合比例，立即作用于轨道上的当前动画和等待播放的动画。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} track 轨道序号(小于SPINE2D_MAX_TRACKS)。
+ * @param {float} alpha 混合比例(0-1)，缺省为 1。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_track_alpha(widget_t* widget, uint32_t track, float alpha);
+
+/**
+ * @method spine2d_set_track_mix
+ * 设置指定轨道切换动画时的过渡时间(下次设置动画后生效)。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} track 轨道序号(小于SPINE2D_MAX_TRACKS)。
+ * @param {float} duration 过渡时间(秒)，小于 0 表示使用缺省的过渡时间。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_track_mix(widget_t* widget, uint32_t track, float duration);
+
+/**
+ * @method spine2d_set_track_blend
+ * 设置指定轨道和下层轨道的混合方式，立即作用于轨道上的当前动画和等待播放的动画。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} track 轨道序号(小于SPINE2D_MAX_TRACKS)。
+ * @param {spine2d_blend_t} blend 混合方式，缺省为 SPINE2D_BLEND_REPLACE。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_track_blend(widget_t* widget, uint32_t track, spine2d_blend_t blend);
+
+/**
+ * @method spine2d_clear_track
+ * 按轨道的过渡时间淡出并清除指定轨道的动画。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget widget对象。
+ * @param {uint32_t} track 轨道序号(小于SPINE2D_MAX_TRACKS)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_clear_track(widget_t* widget, uint32_t track);
+
+/**
+ * @method spine2d_set_parallel_update
+ * 设置并行更新的线程数。
+ *
+ * 启用后所有 spine2d 控件由一个定时器统一更新，每个控件的动画状态和骨骼更新作为独立任务，
+ * 在任务窃取线程池中并行执行(调用线程也参与)。动画事件先缓存，全部更新完成后在 UI 线程中分发。
+ * 绘制仍然在 UI 线程中进行。
+ *
+ * > 退出程序前请调用 spine2d_set_parallel_update(0) 停止工作线程。
+ * @annotation ["static", "scriptable"]
+ * @param {uint32_t} threads 并行度(包括 UI 线程)，小于 2 表示禁用并行更新。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine2d_set_parallel_update(uint32_t threads);
+
 #define SPINE2D_PROP_ATLAS "atlas"
 #define SPINE2D_PROP_SKELETON "skeleton"
 #define SPINE2D_PROP_ACTION "action"
@@ -230,6 +495,20 @@ ret_t spine2d_set_loop(widget_t* widget, bool_t loop);
 #define SPINE2D_PROP_SCALE_Y "scale_y"
 #define SPINE2D_PROP_SCALE_TIME "scale_time"
 #define SPINE2D_PROP_LOOP "loop"
+#define SPINE2D_PROP_FIXED_FPS "fixed_fps"
+#define SPINE2D_PROP_INTERPOLATE "interpolate"
+#define SPINE2D_PROP_UPDATE_FPS "update_fps"
+#define SPINE2D_PROP_PRIORITY "priority"
+#define SPINE2D_PROP_EFFECTIVE_FPS "effective_fps"
+#define SPINE2D_PROP_LAZY_LOAD "lazy_load"
+
+/*轨道属性的名称为 "track" + 轨道序号 + "." + 下面的名称，如 "track1.alpha"*/
+#define SPINE2D_PROP_TRACK "track"
+#define SPINE2D_TRACK_PROP_ACTION "action"
+#define SPINE2D_TRACK_PROP_LOOP "loop"
+#define SPINE2D_TRACK_PROP_ALPHA "alpha"
+#define SPINE2D_TRACK_PROP_MIX "mix"
+#define SPINE2D_TRACK_PROP_BLEND "blend"
 
 #define WIDGET_TYPE_SPINE2D "spine2d"
 
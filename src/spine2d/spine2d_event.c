@@ -0,0 +1,50 @@
+/**
+ * File:   spine2d_event.c
+ * Author: AWTK Develop Team
+ * Brief:  spine2d 动画事件。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#include "tkc/utils.h"
+#include "spine2d_event.h"
+
+spine2d_event_t* spine2d_event_cast(event_t* event) {
+  return_value_if_fail(event != NULL, NULL);
+  return_value_if_fail(event->type == EVT_SPINE2D_EVENTS, NULL);
+  return_value_if_fail(event->size == sizeof(spine2d_event_t), NULL);
+
+  return (spine2d_event_t*)event;
+}
+
+const spine2d_event_item_t* spine2d_event_get_item(spine2d_event_t* event, uint32_t index) {
+  return_value_if_fail(event != NULL && index < event->nr, NULL);
+
+  return event->items + index;
+}
+
+event_t* spine2d_event_init(spine2d_event_t* event, void* target, const spine2d_event_item_t* items,
+                            uint32_t nr) {
+  return_value_if_fail(event != NULL, NULL);
+  return_value_if_fail(items != NULL || nr == 0, NULL);
+
+  memset(event, 0x00, sizeof(*event));
+  event->e = event_init(EVT_SPINE2D_EVENTS, target);
+  event->e.size = sizeof(*event);
+  event->items = items;
+  event->nr = nr;
+
+  return (event_t*)event;
+}
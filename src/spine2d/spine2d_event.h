@@ -0,0 +1,217 @@
+/**
+ * File:   spine2d_event.h
+ * Author: AWTK Develop Team
+ * Brief:  spine2d 动画事件。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#ifndef TK_SPINE2D_EVENT_H
+#define TK_SPINE2D_EVENT_H
+
+#include "tkc/event.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @enum spine2d_event_type_t
+ * @prefix EVT_SPINE2D_
+ * @annotation ["scriptable"]
+ * spine2d 事件类型。
+ */
+typedef enum _spine2d_event_type_t {
+  /**
+   * @const EVT_SPINE2D_EVENTS
+   * 一次更新中产生的全部动画事件(spine2d_event_t)。
+   */
+  EVT_SPINE2D_EVENTS = EVT_USER_START + 0x5d20
+} spine2d_event_type_t;
+
+/**
+ * @enum spine2d_event_item_type_t
+ * @prefix SPINE2D_EVENT_
+ * @annotation ["scriptable"]
+ * 动画事件的类型，和 spine 的 EventType 一一对应。
+ */
+typedef enum _spine2d_event_item_type_t {
+  /**
+   * @const SPINE2D_EVENT_START
+   * 动画开始。
+   */
+  SPINE2D_EVENT_START = 0,
+  /**
+   * @const SPINE2D_EVENT_INTERRUPT
+   * 动画被其它动画打断。
+   */
+  SPINE2D_EVENT_INTERRUPT,
+  /**
+   * @const SPINE2D_EVENT_END
+   * 动画不再被应用。
+   */
+  SPINE2D_EVENT_END,
+  /**
+   * @const SPINE2D_EVENT_COMPLETE
+   * 动画播放完一次。
+   */
+  SPINE2D_EVENT_COMPLETE,
+  /**
+   * @const SPINE2D_EVENT_DISPOSE
+   * 动画的轨道项被释放。
+   */
+  SPINE2D_EVENT_DISPOSE,
+  /**
+   * @const SPINE2D_EVENT_USER
+   * 动画中设计的自定义事件。
+   */
+  SPINE2D_EVENT_USER
+} spine2d_event_item_type_t;
+
+/**
+ * @class spine2d_event_item_t
+ * @annotation ["scriptable"]
+ * 一个动画事件。
+ *
+ * 字符串都指向骨骼数据中的名称，不复制也不需要释放，只在事件处理函数中有效。
+ */
+typedef struct _spine2d_event_item_t {
+  /**
+   * @property {uint32_t} type
+   * @annotation ["readable", "scriptable"]
+   * 事件类型(spine2d_event_item_type_t)。
+   */
+  uint32_t type;
+  /**
+   * @property {int32_t} track
+   * @annotation ["readable", "scriptable"]
+   * 轨道序号。
+   */
+  int32_t track;
+  /**
+   * @property {const char*} animation
+   * @annotation ["readable", "scriptable"]
+   * 动画名。
+   */
+  const char* animation;
+  /**
+   * @property {const char*} name
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件名，其它类型为 NULL。
+   */
+  const char* name;
+  /**
+   * @property {int32_t} int_value
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的整数值。
+   */
+  int32_t int_value;
+  /**
+   * @property {float} float_value
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的浮点数值。
+   */
+  float float_value;
+  /**
+   * @property {const char*} string_value
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的字符串值。
+   */
+  const char* string_value;
+  /**
+   * @property {const char*} audio_path
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的音频文件，没有音频时为 NULL。
+   */
+  const char* audio_path;
+  /**
+   * @property {float} volume
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的音量。
+   */
+  float volume;
+  /**
+   * @property {float} balance
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件的声道平衡。
+   */
+  float balance;
+  /**
+   * @property {float} time
+   * @annotation ["readable", "scriptable"]
+   * 自定义事件在动画中的时间(秒)。
+   */
+  float time;
+} spine2d_event_item_t;
+
+/**
+ * @class spine2d_event_t
+ * @annotation ["scriptable"]
+ * @parent event_t
+ * 一次更新中产生的全部动画事件，按产生的顺序排列。
+ *
+ * 事件对象和事件项都不在堆上分配，只在事件处理函数中有效。
+ */
+typedef struct _spine2d_event_t {
+  event_t e;
+  /**
+   * @property {uint32_t} nr
+   * @annotation ["readable", "scriptable"]
+   * 事件个数。
+   */
+  uint32_t nr;
+  /**
+   * @property {const spine2d_event_item_t*} items
+   * @annotation ["readable"]
+   * 事件列表。
+   */
+  const spine2d_event_item_t* items;
+} spine2d_event_t;
+
+/**
+ * @method spine2d_event_cast
+ * @annotation ["cast", "scriptable"]
+ * 把event对象转spine2d_event_t对象。
+ * @param {event_t*} event event对象。
+ *
+ * @return {spine2d_event_t*} 对象。
+ */
+spine2d_event_t* spine2d_event_cast(event_t* event);
+
+/**
+ * @method spine2d_event_get_item
+ * @annotation ["scriptable"]
+ * 获取指定序号的事件。
+ * @param {spine2d_event_t*} event event对象。
+ * @param {uint32_t} index 序号。
+ *
+ * @return {const spine2d_event_item_t*} 返回事件，序号无效时返回NULL。
+ */
+const spine2d_event_item_t* spine2d_event_get_item(spine2d_event_t* event, uint32_t index);
+
+/**
+ * @method spine2d_event_init
+ * 初始化事件。
+ * @param {spine2d_event_t*} event event对象。
+ * @param {void*} target 事件目标。
+ * @param {const spine2d_event_item_t*} items 事件列表。
+ * @param {uint32_t} nr 事件个数。
+ *
+ * @return {event_t*} event对象。
+ */
+event_t* spine2d_event_init(spine2d_event_t* event, void* target, const spine2d_event_item_t* items,
+                            uint32_t nr);
+
+END_C_DECLS
+
+#endif /*TK_SPINE2D_EVENT_H*/
@@ -0,0 +1,81 @@
+/**
+ * File:   spine_clock.c
+ * Author: AWTK Develop Team
+ * Brief:  骨骼动画的更新时钟(支持固定步长)。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#include <math.h>
+#include "tkc/utils.h"
+#include "spine_clock.h"
+
+ret_t spine_clock_init(spine_clock_t* clock, uint64_t now_us) {
+  return_value_if_fail(clock != NULL, RET_BAD_PARAMS);
+
+  memset(clock, 0x00, sizeof(*clock));
+  clock->last_time_us = now_us;
+  clock->max_steps = 1;
+
+  return RET_OK;
+}
+
+ret_t spine_clock_set_step(spine_clock_t* clock, float step, uint32_t max_steps) {
+  return_value_if_fail(clock != NULL && step >= 0, RET_BAD_PARAMS);
+
+  clock->step = step;
+  clock->max_steps = tk_max(max_steps, 1);
+  clock->accumulator = 0;
+
+  return RET_OK;
+}
+
+uint32_t spine_clock_advance(spine_clock_t* clock, uint64_t now_us, float* delta) {
+  double elapsed = 0;
+  uint32_t steps = 0;
+  return_value_if_fail(clock != NULL && delta != NULL, 0);
+
+  /*整数相减后再换算成秒，不受运行时间长短的影响*/
+  if (now_us > clock->last_time_us) {
+    elapsed = (double)(now_us - clock->last_time_us) / 1000000.0;
+  }
+  clock->last_time_us = now_us;
+
+  if (clock->step <= 0) {
+    *delta = (float)elapsed;
+    return 1;
+  }
+
+  clock->accumulator += elapsed;
+  steps = (uint32_t)tk_min(floor(clock->accumulator / clock->step), (double)clock->max_steps);
+  clock->accumulator -= steps * (double)clock->step;
+  if (clock->accumulator >= clock->step) {
+    /*追不上时丢弃多余的时间，只保留不足一步的部分*/
+    clock->accumulator = fmod(clock->accumulator, clock->step);
+  }
+  *delta = clock->step;
+
+  return steps;
+}
+
+float spine_clock_get_alpha(spine_clock_t* clock) {
+  return_value_if_fail(clock != NULL, 1);
+
+  if (clock->step <= 0) {
+    return 1;
+  }
+
+  return tk_min((float)(clock->accumulator / clock->step), 1.0f);
+}
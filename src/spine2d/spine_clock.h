@@ -0,0 +1,108 @@
+/**
+ * File:   spine_clock.h
+ * Author: AWTK Develop Team
+ * Brief:  骨骼动画的更新时钟(支持固定步长)。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#ifndef TK_SPINE_CLOCK_H
+#define TK_SPINE_CLOCK_H
+
+#include "tkc/types_def.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class spine_clock_t
+ * 骨骼动画的更新时钟。
+ *
+ * 使用微秒级的单调时钟计算两次更新的间隔，长时间运行也不会丢失精度。
+ *
+ * 步长为 0 时，每次更新按实际间隔模拟一步。
+ * 步长大于 0 时，实际间隔累加起来，按固定步长模拟，定时器的抖动不会影响物理模拟。
+ * 一次最多模拟 max_steps 步，落后太多(如程序被挂起)时丢弃多余的时间，避免越追越慢。
+ */
+typedef struct _spine_clock_t {
+  /**
+   * @property {uint64_t} last_time_us
+   * @annotation ["readable"]
+   * 上次更新的时间(微秒)。
+   */
+  uint64_t last_time_us;
+  /**
+   * @property {double} accumulator
+   * @annotation ["readable"]
+   * 尚未模拟的时间(秒)。
+   */
+  double accumulator;
+  /**
+   * @property {float} step
+   * @annotation ["readable"]
+   * 固定步长(秒)，0 表示按实际间隔更新。
+   */
+  float step;
+  /**
+   * @property {uint32_t} max_steps
+   * @annotation ["readable"]
+   * 一次最多模拟的步数。
+   */
+  uint32_t max_steps;
+} spine_clock_t;
+
+/**
+ * @method spine_clock_init
+ * 初始化时钟(按实际间隔更新)。
+ * @param {spine_clock_t*} clock 时钟对象。
+ * @param {uint64_t} now_us 当前时间(微秒)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_clock_init(spine_clock_t* clock, uint64_t now_us);
+
+/**
+ * @method spine_clock_set_step
+ * 设置固定步长，并清除尚未模拟的时间。
+ * @param {spine_clock_t*} clock 时钟对象。
+ * @param {float} step 固定步长(秒)，0 表示按实际间隔更新。
+ * @param {uint32_t} max_steps 一次最多模拟的步数(至少为 1)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_clock_set_step(spine_clock_t* clock, float step, uint32_t max_steps);
+
+/**
+ * @method spine_clock_advance
+ * 推进时钟，返回本次需要模拟的步数。
+ * @param {spine_clock_t*} clock 时钟对象。
+ * @param {uint64_t} now_us 当前时间(微秒)。
+ * @param {float*} delta 返回每一步的时间(秒)。
+ *
+ * @return {uint32_t} 返回需要模拟的步数，按实际间隔更新时总是 1。
+ */
+uint32_t spine_clock_advance(spine_clock_t* clock, uint64_t now_us, float* delta);
+
+/**
+ * @method spine_clock_get_alpha
+ * 获取尚未模拟的时间占一步的比例，用于在最近两步的结果之间插值。
+ * @param {spine_clock_t*} clock 时钟对象。
+ *
+ * @return {float} 返回 0-1 之间的比例，按实际间隔更新时总是 1。
+ */
+float spine_clock_get_alpha(spine_clock_t* clock);
+
+END_C_DECLS
+
+#endif /*TK_SPINE_CLOCK_H*/
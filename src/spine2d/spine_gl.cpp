@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <cstring>
 #include "spine_gl.h"
+#include "spine_texture.h"
 #include "base/opengl.h"
 
 #include "awtk.h"
@@ -161,7 +162,10 @@ void shader_dispose(shader_t program) {
 
 texture_t texture_load(const char* file_path) {
   bitmap_t bitmap;
+  spine_texture_t raw;
   int width, height, nrChannels;
+  unsigned char* data = NULL;
+  const unsigned char* pixels = NULL;
 
   memset(&bitmap, 0x00, sizeof(bitmap));
   if (image_manager_lookup(image_manager(), file_path, &bitmap) == RET_OK) {
@@ -169,10 +173,20 @@ texture_t texture_load(const char* file_path) {
   }
   asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, file_path);
   return_value_if_fail(info != NULL, 0);
-  unsigned char* data =
-      stbi_load_from_memory(info->data, info->size, &width, &height, &nrChannels, 0);
-  asset_info_unref(info);
-  return_value_if_fail(data != NULL, 0);
+  if (spine_texture_parse(&raw, info->data, info->size) == RET_OK) {
+    /*spine2d_compile 预先解码的纹理，直接上传像素*/
+    width = raw.w;
+    height = raw.h;
+    nrChannels = raw.channels;
+    pixels = raw.pixels;
+  } else {
+    data = stbi_load_from_memory(info->data, info->size, &width, &height, &nrChannels, 0);
+    pixels = data;
+  }
+  if (pixels == NULL) {
+    asset_info_unref(info);
+    return 0;
+  }
 
   GLenum format = GL_RGBA;
   if (nrChannels == 1)
@@ -189,7 +203,7 @@ texture_t texture_load(const char* file_path) {
   texture_t texture;
   glGenTextures(1, &texture);
   glBindTexture(GL_TEXTURE_2D, texture);
-  glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+  glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
   glGenerateMipmap(GL_TEXTURE_2D);
 
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -197,7 +211,10 @@ texture_t texture_load(const char* file_path) {
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-  stbi_image_free(data);
+  if (data != NULL) {
+    stbi_image_free(data);
+  }
+  asset_info_unref(info);
 
   bitmap.w = width;
   bitmap.h = height;
@@ -0,0 +1,318 @@
+/**
+ * File:   spine_mem.cpp
+ * Author: AWTK Develop Team
+ * Brief:  spine 运行时的内存分配(基于 AWTK 的内存管理)。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "tkc/mutex.h"
+#include <spine/spine.h>
+
+#include "spine_mem.h"
+
+using namespace spine;
+
+/*每次分配前面有 8 字节的头部记录申请的大小，释放和重新分配时据此找到对象池*/
+#define SPINE_MEM_HEADER_SIZE 8
+#define SPINE_MEM_CLASS_SIZE 16
+#define SPINE_MEM_CLASSES (SPINE_MEM_POOL_MAX_SIZE / SPINE_MEM_CLASS_SIZE)
+#define SPINE_MEM_CHUNK_SIZE 4096
+
+typedef struct _spine_mem_slot_t {
+  struct _spine_mem_slot_t* next;
+} spine_mem_slot_t;
+
+typedef struct _spine_mem_chunk_t {
+  struct _spine_mem_chunk_t* next;
+  uint64_t reserved;
+} spine_mem_chunk_t;
+
+static inline uint32_t spine_mem_class_of(size_t size) {
+  return size == 0 ? 0 : (uint32_t)((size - 1) / SPINE_MEM_CLASS_SIZE);
+}
+
+static inline size_t* spine_mem_header(void* ptr) {
+  return (size_t*)((uint8_t*)ptr - SPINE_MEM_HEADER_SIZE);
+}
+
+/*SpineExtension 的成员函数中 alloc/realloc/free 会被解析成它的静态模板，在类外面调用 AWTK*/
+static void* spine_mem_tk_alloc(size_t size) {
+  return TKMEM_ALLOC(size);
+}
+
+static void* spine_mem_tk_realloc(void* ptr, size_t size) {
+  return TKMEM_REALLOC(ptr, size);
+}
+
+static void spine_mem_tk_free(void* ptr) {
+  TKMEM_FREE(ptr);
+}
+
+/*
+ * 基于 TKMEM_ALLOC 的 SpineExtension。
+ * 小对象按 16 字节分级，每级一个空闲链表，空闲链表为空时从 AWTK 申请一块 4K 的内存切分。
+ * 释放的小对象只回到空闲链表，不还给 AWTK，运行时反复创建销毁的对象不再经过系统的分配器。
+ */
+class AwtkSpineExtension : public DefaultSpineExtension {
+ public:
+  AwtkSpineExtension(SpineExtension* previous) : previous(previous), chunks(NULL), frame_allocs(0) {
+    memset(&stat, 0x00, sizeof(stat));
+    memset(free_slots, 0x00, sizeof(free_slots));
+    mutex = tk_mutex_create();
+  }
+
+  virtual ~AwtkSpineExtension() {
+    while (chunks != NULL) {
+      spine_mem_chunk_t* next = chunks->next;
+      spine_mem_tk_free(chunks);
+      chunks = next;
+    }
+    tk_mutex_destroy(mutex);
+  }
+
+  virtual void* _alloc(size_t size, const char* file, int line) override {
+    SP_UNUSED(file);
+    SP_UNUSED(line);
+    tk_mutex_lock(mutex);
+    void* ptr = allocLocked(size);
+    tk_mutex_unlock(mutex);
+    return ptr;
+  }
+
+  virtual void* _calloc(size_t size, const char* file, int line) override {
+    void* ptr = _alloc(size, file, line);
+    if (ptr != NULL) {
+      memset(ptr, 0x00, size);
+    }
+    return ptr;
+  }
+
+  virtual void* _realloc(void* ptr, size_t size, const char* file, int line) override {
+    if (ptr == NULL) {
+      return _alloc(size, file, line);
+    }
+
+    void* mem = NULL;
+    size_t* header = spine_mem_header(ptr);
+    size_t old_size = *header;
+    tk_mutex_lock(mutex);
+    if (old_size <= SPINE_MEM_POOL_MAX_SIZE && size <= SPINE_MEM_POOL_MAX_SIZE &&
+        spine_mem_class_of(old_size) == spine_mem_class_of(size)) {
+      /*同一级的对象池中原地伸缩*/
+      countAlloc();
+      *header = size;
+      stat.live_bytes = stat.live_bytes - old_size + size;
+      mem = ptr;
+    } else if (old_size > SPINE_MEM_POOL_MAX_SIZE && size > SPINE_MEM_POOL_MAX_SIZE) {
+      header = (size_t*)spine_mem_tk_realloc(header, SPINE_MEM_HEADER_SIZE + size);
+      if (header != NULL) {
+        countAlloc();
+        *header = size;
+        stat.live_bytes = stat.live_bytes - old_size + size;
+        mem = (uint8_t*)header + SPINE_MEM_HEADER_SIZE;
+      }
+    } else {
+      mem = allocLocked(size);
+      if (mem != NULL) {
+        memcpy(mem, ptr, tk_min(old_size, size));
+        freeLocked(ptr);
+      }
+    }
+    updatePeak();
+    tk_mutex_unlock(mutex);
+
+    return mem;
+  }
+
+  virtual void _free(void* mem, const char* file, int line) override {
+    SP_UNUSED(file);
+    SP_UNUSED(line);
+    if (mem != NULL) {
+      tk_mutex_lock(mutex);
+      freeLocked(mem);
+      tk_mutex_unlock(mutex);
+    }
+  }
+
+  void getStat(spine_mem_stat_t* out) {
+    tk_mutex_lock(mutex);
+    *out = stat;
+    tk_mutex_unlock(mutex);
+  }
+
+  void resetPeak() {
+    tk_mutex_lock(mutex);
+    stat.peak_bytes = stat.live_bytes;
+    tk_mutex_unlock(mutex);
+  }
+
+  void endFrame() {
+    tk_mutex_lock(mutex);
+    stat.frame_allocs = frame_allocs;
+    frame_allocs = 0;
+    tk_mutex_unlock(mutex);
+  }
+
+  uint32_t getLiveCount() {
+    tk_mutex_lock(mutex);
+    uint32_t count = stat.live_count;
+    tk_mutex_unlock(mutex);
+    return count;
+  }
+
+  SpineExtension* previous;
+
+ private:
+  void countAlloc() {
+    stat.total_allocs++;
+    frame_allocs++;
+  }
+
+  void updatePeak() {
+    if (stat.live_bytes > stat.peak_bytes) {
+      stat.peak_bytes = stat.live_bytes;
+    }
+  }
+
+  bool fillPool(uint32_t index) {
+    size_t slot_size = SPINE_MEM_HEADER_SIZE + (index + 1) * SPINE_MEM_CLASS_SIZE;
+    spine_mem_chunk_t* chunk = (spine_mem_chunk_t*)spine_mem_tk_alloc(SPINE_MEM_CHUNK_SIZE);
+    if (chunk == NULL) {
+      return false;
+    }
+
+    chunk->next = chunks;
+    chunks = chunk;
+    stat.pool_bytes += SPINE_MEM_CHUNK_SIZE;
+
+    uint8_t* p = (uint8_t*)chunk + sizeof(spine_mem_chunk_t);
+    uint8_t* end = (uint8_t*)chunk + SPINE_MEM_CHUNK_SIZE;
+    for (; p + slot_size <= end; p += slot_size) {
+      spine_mem_slot_t* slot = (spine_mem_slot_t*)p;
+      slot->next = free_slots[index];
+      free_slots[index] = slot;
+    }
+
+    return true;
+  }
+
+  void* allocLocked(size_t size) {
+    size_t* header = NULL;
+    if (size <= SPINE_MEM_POOL_MAX_SIZE) {
+      uint32_t index = spine_mem_class_of(size);
+      if (free_slots[index] == NULL && !fillPool(index)) {
+        return NULL;
+      }
+      header = (size_t*)free_slots[index];
+      free_slots[index] = free_slots[index]->next;
+    } else {
+      header = (size_t*)spine_mem_tk_alloc(SPINE_MEM_HEADER_SIZE + size);
+      if (header == NULL) {
+        return NULL;
+      }
+    }
+
+    *header = size;
+    countAlloc();
+    stat.live_count++;
+    stat.live_bytes += size;
+    updatePeak();
+
+    return (uint8_t*)header + SPINE_MEM_HEADER_SIZE;
+  }
+
+  void freeLocked(void* ptr) {
+    size_t* header = spine_mem_header(ptr);
+    size_t size = *header;
+
+    stat.live_count--;
+    stat.live_bytes -= size;
+    if (size <= SPINE_MEM_POOL_MAX_SIZE) {
+      spine_mem_slot_t* slot = (spine_mem_slot_t*)header;
+      uint32_t index = spine_mem_class_of(size);
+      slot->next = free_slots[index];
+      free_slots[index] = slot;
+    } else {
+      spine_mem_tk_free(header);
+    }
+  }
+
+  tk_mutex_t* mutex;
+  spine_mem_chunk_t* chunks;
+  spine_mem_slot_t* free_slots[SPINE_MEM_CLASSES];
+  spine_mem_stat_t stat;
+  uint32_t frame_allocs;
+};
+
+static AwtkSpineExtension* s_spine_mem = NULL;
+
+ret_t spine_mem_init(void) {
+  if (s_spine_mem == NULL) {
+    s_spine_mem = new AwtkSpineExtension(SpineExtension::getInstance());
+    SpineExtension::setInstance(s_spine_mem);
+  }
+
+  return RET_OK;
+}
+
+bool_t spine_mem_is_installed(void) {
+  return s_spine_mem != NULL && SpineExtension::getInstance() == s_spine_mem;
+}
+
+ret_t spine_mem_get_stat(spine_mem_stat_t* stat) {
+  return_value_if_fail(stat != NULL, RET_BAD_PARAMS);
+  if (s_spine_mem == NULL) {
+    memset(stat, 0x00, sizeof(*stat));
+    return RET_NOT_FOUND;
+  }
+
+  s_spine_mem->getStat(stat);
+
+  return RET_OK;
+}
+
+ret_t spine_mem_reset_peak(void) {
+  return_value_if_fail(s_spine_mem != NULL, RET_NOT_FOUND);
+  s_spine_mem->resetPeak();
+
+  return RET_OK;
+}
+
+ret_t spine_mem_end_frame(void) {
+  return_value_if_fail(s_spine_mem != NULL, RET_NOT_FOUND);
+  s_spine_mem->endFrame();
+
+  return RET_OK;
+}
+
+ret_t spine_mem_deinit(void) {
+  if (s_spine_mem == NULL) {
+    return RET_OK;
+  }
+
+  /*还有未释放的内存，或者之后又安装了别的 SpineExtension(如并行更新时加锁的)，都不能恢复*/
+  if (s_spine_mem->getLiveCount() > 0 || SpineExtension::getInstance() != s_spine_mem) {
+    return RET_BUSY;
+  }
+
+  SpineExtension::setInstance(s_spine_mem->previous);
+  delete s_spine_mem;
+  s_spine_mem = NULL;
+
+  return RET_OK;
+}
@@ -0,0 +1,148 @@
+/**
+ * File:   spine_mem.h
+ * Author: AWTK Develop Team
+ * Brief:  spine 运行时的内存分配(基于 AWTK 的内存管理)。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#ifndef TK_SPINE_MEM_H
+#define TK_SPINE_MEM_H
+
+#include "tkc/types_def.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @const SPINE_MEM_POOL_MAX_SIZE
+ * 不超过该大小的分配从按大小分级(16 字节一级)的对象池中分配，更大的直接调用 TKMEM_ALLOC。
+ */
+#define SPINE_MEM_POOL_MAX_SIZE 128
+
+/**
+ * @class spine_mem_stat_t
+ * spine 运行时的内存统计信息。
+ */
+typedef struct _spine_mem_stat_t {
+  /**
+   * @property {uint64_t} live_bytes
+   * @annotation ["readable"]
+   * 当前使用的字节数(按申请的大小计算)。
+   */
+  uint64_t live_bytes;
+  /**
+   * @property {uint64_t} peak_bytes
+   * @annotation ["readable"]
+   * 使用字节数的峰值。
+   */
+  uint64_t peak_bytes;
+  /**
+   * @property {uint32_t} live_count
+   * @annotation ["readable"]
+   * 当前未释放的分配次数。
+   */
+  uint32_t live_count;
+  /**
+   * @property {uint32_t} frame_allocs
+   * @annotation ["readable"]
+   * 上一帧的分配次数(两次调用 spine_mem_end_frame 之间)。
+   */
+  uint32_t frame_allocs;
+  /**
+   * @property {uint64_t} total_allocs
+   * @annotation ["readable"]
+   * 累计分配次数。
+   */
+  uint64_t total_allocs;
+  /**
+   * @property {uint64_t} pool_bytes
+   * @annotation ["readable"]
+   * 对象池从 AWTK 申请的字节数(对象池只增不减，spine_mem_deinit 时释放)。
+   */
+  uint64_t pool_bytes;
+} spine_mem_stat_t;
+
+/**
+ * @class spine_mem_t
+ * @annotation ["fake"]
+ * spine 运行时的内存分配。
+ *
+ * spine 默认的 SpineExtension 直接调用 malloc/realloc，绕开了 AWTK 的内存管理。
+ * spine_mem_init 安装基于 TKMEM_ALLOC 的 SpineExtension，运行时大量 16-128 字节的小对象
+ * 从按大小分级的对象池中分配，同时统计内存的使用情况。
+ *
+ * 安装之前分配的内存不能由它释放，所以要在创建任何 spine 对象之前安装(spine2d_register 中调用)。
+ * 它本身是线程安全的，并行更新时不需要再加锁。
+ */
+
+/**
+ * @method spine_mem_init
+ * 安装基于 AWTK 内存管理的 SpineExtension，重复调用不会重复安装。
+ * @annotation ["static"]
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_mem_init(void);
+
+/**
+ * @method spine_mem_is_installed
+ * 当前的 SpineExtension 是否是 spine_mem_init 安装的。
+ * @annotation ["static"]
+ *
+ * @return {bool_t} 返回TRUE表示是，否则表示不是。
+ */
+bool_t spine_mem_is_installed(void);
+
+/**
+ * @method spine_mem_get_stat
+ * 获取内存统计信息。
+ * @annotation ["static"]
+ * @param {spine_mem_stat_t*} stat 返回统计信息。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，没有安装时返回RET_NOT_FOUND。
+ */
+ret_t spine_mem_get_stat(spine_mem_stat_t* stat);
+
+/**
+ * @method spine_mem_reset_peak
+ * 把峰值重置为当前使用的字节数。
+ * @annotation ["static"]
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_mem_reset_peak(void);
+
+/**
+ * @method spine_mem_end_frame
+ * 结束一帧，记录这一帧的分配次数(spine2d 控件每次更新时调用)。
+ * @annotation ["static"]
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_mem_end_frame(void);
+
+/**
+ * @method spine_mem_deinit
+ * 恢复原来的 SpineExtension 并释放对象池。
+ * 必须在全部 spine 对象释放之后调用，还有未释放的内存时返回RET_BUSY，保持安装。
+ * @annotation ["static"]
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_mem_deinit(void);
+
+END_C_DECLS
+
+#endif /*TK_SPINE_MEM_H*/
@@ -0,0 +1,261 @@
+/**
+ * File:   spine_task_pool.c
+ * Author: AWTK Develop Team
+ * Brief:  骨骼更新用的任务窃取(work-stealing)线程池。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "tkc/mutex.h"
+#include "tkc/thread.h"
+#include "tkc/semaphore.h"
+#include "tkc/platform.h"
+
+#include "spine_task_pool.h"
+
+typedef struct _spine_task_queue_t {
+  tk_mutex_t* mutex;
+  void** tasks;
+  uint32_t capacity;
+  uint32_t head;
+  uint32_t tail;
+} spine_task_queue_t;
+
+typedef struct _spine_task_worker_t {
+  spine_task_pool_t* pool;
+  uint32_t index;
+  tk_thread_t* thread;
+} spine_task_worker_t;
+
+struct _spine_task_pool_t {
+  /*队列个数，queues[0] 属于调用线程，其余属于工作线程*/
+  uint32_t threads;
+  spine_task_queue_t* queues;
+  spine_task_worker_t* workers;
+
+  tk_semaphore_t* start;
+  tk_semaphore_t* done;
+  spine_task_pool_func_t func;
+  bool_t quit;
+};
+
+/*
+ * 等待出错(如被信号打断)时继续等，不能让工作线程退出：
+ * 少一个工作线程 post done，spine_task_pool_run 会一直等下去。
+ */
+static ret_t spine_task_sem_wait(tk_semaphore_t* sem) {
+  ret_t ret = RET_TIMEOUT;
+
+  while (ret != RET_OK) {
+    ret = tk_semaphore_wait(sem, 1000);
+    if (ret != RET_OK && ret != RET_TIMEOUT) {
+      sleep_ms(1);
+    }
+  }
+
+  return ret;
+}
+
+static void* spine_task_queue_take(spine_task_queue_t* queue, bool_t own) {
+  void* task = NULL;
+
+  tk_mutex_lock(queue->mutex);
+  if (queue->head < queue->tail) {
+    /*自己从尾部取，窃取者从头部取，减少冲突*/
+    task = own ? queue->tasks[--queue->tail] : queue->tasks[queue->head++];
+  }
+  tk_mutex_unlock(queue->mutex);
+
+  return task;
+}
+
+static void spine_task_pool_drain(spine_task_pool_t* pool, uint32_t index) {
+  uint32_t i = 0;
+  void* task = NULL;
+
+  while ((task = spine_task_queue_take(pool->queues + index, TRUE)) != NULL) {
+    pool->func(task);
+  }
+
+  for (i = 1; i < pool->threads; i++) {
+    spine_task_queue_t* victim = pool->queues + (index + i) % pool->threads;
+    while ((task = spine_task_queue_take(victim, FALSE)) != NULL) {
+      pool->func(task);
+    }
+  }
+}
+
+static void* spine_task_worker_entry(void* args) {
+  spine_task_worker_t* worker = (spine_task_worker_t*)args;
+  spine_task_pool_t* pool = worker->pool;
+
+  while (TRUE) {
+    spine_task_sem_wait(pool->start);
+    if (pool->quit) {
+      break;
+    }
+    spine_task_pool_drain(pool, worker->index);
+    tk_semaphore_post(pool->done);
+  }
+
+  return NULL;
+}
+
+spine_task_pool_t* spine_task_pool_create(uint32_t threads) {
+  uint32_t i = 0;
+  spine_task_pool_t* pool = NULL;
+  return_value_if_fail(threads > 0, NULL);
+
+  pool = TKMEM_ZALLOC(spine_task_pool_t);
+  return_value_if_fail(pool != NULL, NULL);
+
+  pool->threads = threads;
+  pool->queues = TKMEM_ZALLOCN(spine_task_queue_t, threads);
+  pool->workers = TKMEM_ZALLOCN(spine_task_worker_t, threads);
+  pool->start = tk_semaphore_create(0, NULL);
+  pool->done = tk_semaphore_create(0, NULL);
+  goto_error_if_fail(pool->queues != NULL && pool->workers != NULL);
+  goto_error_if_fail(pool->start != NULL && pool->done != NULL);
+
+  for (i = 0; i < threads; i++) {
+    pool->queues[i].mutex = tk_mutex_create();
+    goto_error_if_fail(pool->queues[i].mutex != NULL);
+  }
+
+  for (i = 1; i < threads; i++) {
+    spine_task_worker_t* worker = pool->workers + i;
+    worker->pool = pool;
+    worker->index = i;
+    worker->thread = tk_thread_create(spine_task_worker_entry, worker);
+    goto_error_if_fail(worker->thread != NULL);
+    tk_thread_set_name(worker->thread, "spine2d");
+    goto_error_if_fail(tk_thread_start(worker->thread) == RET_OK);
+  }
+
+  return pool;
+error:
+  spine_task_pool_destroy(pool);
+  return NULL;
+}
+
+uint32_t spine_task_pool_get_threads(spine_task_pool_t* pool) {
+  return_value_if_fail(pool != NULL, 0);
+
+  return pool->threads;
+}
+
+static ret_t spine_task_queue_reset(spine_task_queue_t* queue, uint32_t capacity) {
+  if (queue->capacity < capacity) {
+    void** tasks = TKMEM_REALLOCT(void*, queue->tasks, capacity);
+    return_value_if_fail(tasks != NULL, RET_OOM);
+    queue->tasks = tasks;
+    queue->capacity = capacity;
+  }
+  queue->head = 0;
+  queue->tail = 0;
+
+  return RET_OK;
+}
+
+static ret_t spine_task_pool_run_serial(spine_task_pool_func_t func, void** ctxs, uint32_t nr) {
+  uint32_t i = 0;
+
+  for (i = 0; i < nr; i++) {
+    func(ctxs[i]);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine_task_pool_run(spine_task_pool_t* pool, spine_task_pool_func_t func, void** ctxs,
+                          uint32_t nr) {
+  uint32_t i = 0;
+  uint32_t per_queue = 0;
+  return_value_if_fail(pool != NULL && func != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(ctxs != NULL || nr == 0, RET_BAD_PARAMS);
+
+  if (nr < 2 || pool->threads < 2) {
+    return spine_task_pool_run_serial(func, ctxs, nr);
+  }
+
+  /*此时工作线程都在等待 start，可以不加锁地重置队列*/
+  per_queue = (nr + pool->threads - 1) / pool->threads;
+  for (i = 0; i < pool->threads; i++) {
+    if (spine_task_queue_reset(pool->queues + i, per_queue) != RET_OK) {
+      /*队列扩容失败时在调用线程中串行执行，不能丢掉这一帧的任务*/
+      return spine_task_pool_run_serial(func, ctxs, nr);
+    }
+  }
+  for (i = 0; i < nr; i++) {
+    spine_task_queue_t* queue = pool->queues + (i % pool->threads);
+    queue->tasks[queue->tail++] = ctxs[i];
+  }
+
+  pool->func = func;
+  for (i = 1; i < pool->threads; i++) {
+    tk_semaphore_post(pool->start);
+  }
+
+  spine_task_pool_drain(pool, 0);
+
+  for (i = 1; i < pool->threads; i++) {
+    spine_task_sem_wait(pool->done);
+  }
+
+  return RET_OK;
+}
+
+ret_t spine_task_pool_destroy(spine_task_pool_t* pool) {
+  uint32_t i = 0;
+  return_value_if_fail(pool != NULL, RET_BAD_PARAMS);
+
+  pool->quit = TRUE;
+  if (pool->workers != NULL) {
+    for (i = 1; i < pool->threads; i++) {
+      if (pool->workers[i].thread != NULL) {
+        tk_semaphore_post(pool->start);
+      }
+    }
+    for (i = 1; i < pool->threads; i++) {
+      if (pool->workers[i].thread != NULL) {
+        tk_thread_join(pool->workers[i].thread);
+        tk_thread_destroy(pool->workers[i].thread);
+      }
+    }
+  }
+
+  if (pool->queues != NULL) {
+    for (i = 0; i < pool->threads; i++) {
+      if (pool->queues[i].mutex != NULL) {
+        tk_mutex_destroy(pool->queues[i].mutex);
+      }
+      TKMEM_FREE(pool->queues[i].tasks);
+    }
+  }
+
+  if (pool->start != NULL) {
+    tk_semaphore_destroy(pool->start);
+  }
+  if (pool->done != NULL) {
+    tk_semaphore_destroy(pool->done);
+  }
+  TKMEM_FREE(pool->queues);
+  TKMEM_FREE(pool->workers);
+  TKMEM_FREE(pool);
+
+  return RET_OK;
+}
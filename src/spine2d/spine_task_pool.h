@@ -0,0 +1,92 @@
+/**
+ * File:   spine_task_pool.h
+ * Author: AWTK Develop Team
+ * Brief:  骨骼更新用的任务窃取(work-stealing)线程池。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#ifndef TK_SPINE_TASK_POOL_H
+#define TK_SPINE_TASK_POOL_H
+
+#include "tkc/types_def.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class spine_task_pool_t
+ * 任务窃取(work-stealing)线程池。
+ *
+ * 每个线程(包括调用线程)有自己的任务队列，从自己队列的尾部取任务，
+ * 自己的队列为空时从其它队列的头部窃取任务，耗时不均的任务也能均匀分布到各个核上。
+ *
+ * spine_task_pool_run 是同步的，返回时全部任务都已执行完成，
+ * 所以任务之外的全局状态(如 Bone::setYDown)只要在 UI 线程修改就不会和任务并发。
+ */
+typedef struct _spine_task_pool_t spine_task_pool_t;
+
+/**
+ * @method spine_task_pool_func_t
+ * 任务函数。
+ * @param {void*} ctx 任务上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+typedef ret_t (*spine_task_pool_func_t)(void* ctx);
+
+/**
+ * @method spine_task_pool_create
+ * 创建线程池。
+ * @param {uint32_t} threads 并行度(包括调用线程)，1 表示不创建工作线程。
+ *
+ * @return {spine_task_pool_t*} 返回线程池对象。
+ */
+spine_task_pool_t* spine_task_pool_create(uint32_t threads);
+
+/**
+ * @method spine_task_pool_get_threads
+ * 获取并行度(包括调用线程)。
+ * @param {spine_task_pool_t*} pool 线程池对象。
+ *
+ * @return {uint32_t} 返回并行度。
+ */
+uint32_t spine_task_pool_get_threads(spine_task_pool_t* pool);
+
+/**
+ * @method spine_task_pool_run
+ * 并行执行一批任务，调用线程也参与执行，全部任务完成后返回。
+ * 任务队列扩容失败时在调用线程中串行执行，仍然返回RET_OK。
+ * @param {spine_task_pool_t*} pool 线程池对象。
+ * @param {spine_task_pool_func_t} func 任务函数。
+ * @param {void**} ctxs 每个任务的上下文。
+ * @param {uint32_t} nr 任务个数。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_task_pool_run(spine_task_pool_t* pool, spine_task_pool_func_t func, void** ctxs,
+                          uint32_t nr);
+
+/**
+ * @method spine_task_pool_destroy
+ * 停止工作线程并销毁线程池。
+ * @param {spine_task_pool_t*} pool 线程池对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t spine_task_pool_destroy(spine_task_pool_t* pool);
+
+END_C_DECLS
+
+#endif /*TK_SPINE_TASK_POOL_H*/
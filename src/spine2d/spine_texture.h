@@ -0,0 +1,139 @@
+/**
+ * File:   spine_texture.h
+ * Author: AWTK Develop Team
+ * Brief:  预先解码的纹理格式。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#ifndef TK_SPINE_TEXTURE_H
+#define TK_SPINE_TEXTURE_H
+
+#include "tkc/types_def.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @const SPINE_TEXTURE_VERSION
+ * 预先解码的纹理格式的版本。
+ */
+#define SPINE_TEXTURE_VERSION 1
+
+/**
+ * @const SPINE_TEXTURE_HEADER_SIZE
+ * 文件头的大小：标识(5字节)、版本(1字节)、宽度(4字节)、高度(4字节)和通道数(1字节)，之后是像素。
+ */
+#define SPINE_TEXTURE_HEADER_SIZE 15
+
+/**
+ * @class spine_texture_t
+ * 预先解码的纹理。
+ *
+ * 由 spine2d_compile 把纹理图片解码成像素保存，运行时不用再解码 PNG，直接上传到 GPU。
+ * 数值按大端保存，像素按行从上到下排列，每个像素 channels 个字节。
+ */
+typedef struct _spine_texture_t {
+  /**
+   * @property {uint32_t} w
+   * @annotation ["readable"]
+   * 宽度。
+   */
+  uint32_t w;
+  /**
+   * @property {uint32_t} h
+   * @annotation ["readable"]
+   * 高度。
+   */
+  uint32_t h;
+  /**
+   * @property {uint32_t} channels
+   * @annotation ["readable"]
+   * 每个像素的字节数(1-4)。
+   */
+  uint32_t channels;
+  /**
+   * @property {const uint8_t*} pixels
+   * @annotation ["readable"]
+   * 像素数据(引用原始数据，不拷贝)。
+   */
+  const uint8_t* pixels;
+} spine_texture_t;
+
+static inline uint32_t spine_texture_read_uint32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/**
+ * @method spine_texture_parse
+ * 解析预先解码的纹理。
+ * @param {spine_texture_t*} texture 纹理对象。
+ * @param {const uint8_t*} data 数据。
+ * @param {uint32_t} size 数据的长度。
+ *
+ * @return {ret_t} 不是预先解码的纹理或者数据不完整时返回RET_FAIL。
+ */
+static inline ret_t spine_texture_parse(spine_texture_t* texture, const uint8_t* data,
+                                        uint32_t size) {
+  uint64_t pixels_size = 0;
+  return_value_if_fail(texture != NULL && data != NULL, RET_BAD_PARAMS);
+
+  if (size < SPINE_TEXTURE_HEADER_SIZE || memcmp(data, "\x7fSTEX", 5) != 0 ||
+      data[5] != SPINE_TEXTURE_VERSION) {
+    return RET_FAIL;
+  }
+
+  texture->w = spine_texture_read_uint32(data + 6);
+  texture->h = spine_texture_read_uint32(data + 10);
+  texture->channels = data[14];
+  texture->pixels = data + SPINE_TEXTURE_HEADER_SIZE;
+
+  pixels_size = (uint64_t)texture->w * texture->h * texture->channels;
+  if (texture->channels < 1 || texture->channels > 4 ||
+      pixels_size > size - SPINE_TEXTURE_HEADER_SIZE) {
+    return RET_FAIL;
+  }
+
+  return RET_OK;
+}
+
+/**
+ * @method spine_texture_write_header
+ * 生成预先解码的纹理的文件头。
+ * @param {uint8_t*} header 文件头(SPINE_TEXTURE_HEADER_SIZE 字节)。
+ * @param {uint32_t} w 宽度。
+ * @param {uint32_t} h 高度。
+ * @param {uint32_t} channels 每个像素的字节数(1-4)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+static inline ret_t spine_texture_write_header(uint8_t* header, uint32_t w, uint32_t h,
+                                               uint32_t channels) {
+  uint32_t i = 0;
+  return_value_if_fail(header != NULL && channels >= 1 && channels <= 4, RET_BAD_PARAMS);
+
+  memcpy(header, "\x7fSTEX", 5);
+  header[5] = SPINE_TEXTURE_VERSION;
+  for (i = 0; i < 4; i++) {
+    header[6 + i] = (uint8_t)(w >> (24 - i * 8));
+    header[10 + i] = (uint8_t)(h >> (24 - i * 8));
+  }
+  header[14] = (uint8_t)channels;
+
+  return RET_OK;
+}
+
+END_C_DECLS
+
+#endif /*TK_SPINE_TEXTURE_H*/
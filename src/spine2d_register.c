@@ -25,10 +25,13 @@
 #include "spine2d_register.h"
 #include "base/widget_factory.h"
 #include "spine2d/spine2d.h"
+#include "spine2d/spine_mem.h"
 #include "base/opengl.h"
 
 ret_t spine2d_register(void) {
 	opengl_init();
+  /*在创建任何 spine 对象之前安装，spine 的内存由 AWTK 管理*/
+  spine_mem_init();
   return widget_factory_register(widget_factory(), WIDGET_TYPE_SPINE2D, spine2d_create);
 }
 
@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+/*修改前 Animation::search 的线性查找，作为参考结果和性能对比。*/
+static int linear_search(Vector<float>& frames, float target, int step) {
+  size_t n = frames.size();
+  for (size_t i = step; i < n; i += step) {
+    if (frames[i] > target) return (int)(i - step);
+  }
+  return (int)(n - step);
+}
+
+static void make_frames(Vector<float>& frames, int keys, int step) {
+  frames.setSize(keys * step, 0);
+  for (int i = 0; i < keys; i++) {
+    frames[i * step] = i / 30.0f;
+  }
+}
+
+TEST(AnimationSearch, same_as_linear) {
+  Vector<float> frames;
+  int steps[] = {1, 2, 3, 6};
+
+  for (uint32_t s = 0; s < ARRAY_SIZE(steps); s++) {
+    int step = steps[s];
+    for (int keys = 1; keys < 40; keys += 3) {
+      int cursor = 0;
+      make_frames(frames, keys, step);
+      float duration = (keys + 1) / 30.0f;
+
+      /*顺序播放、倒放和循环*/
+      for (float t = -0.1f; t < duration * 3; t += 0.007f) {
+        float time = t > duration * 2 ? duration * 3 - t : (t > duration ? t - duration : t);
+        int expected = linear_search(frames, time, step);
+        ASSERT_EQ(Animation::search(frames, time, step), expected);
+        ASSERT_EQ(Animation::search(frames, time, step, &cursor), expected);
+        ASSERT_EQ(Animation::search(frames, time, step, NULL), expected);
+      }
+
+      /*随机跳转*/
+      for (int i = 0; i < 200; i++) {
+        float time = (float)((i * 7919) % 1000) / 1000.0f * duration;
+        ASSERT_EQ(Animation::search(frames, time, step, &cursor), linear_search(frames, time, step));
+      }
+
+      /*无效的游标*/
+      cursor = -5;
+      ASSERT_EQ(Animation::search(frames, 0.5f, step, &cursor), linear_search(frames, 0.5f, step));
+      cursor = keys * step + 7;
+      ASSERT_EQ(Animation::search(frames, 0.5f, step, &cursor), linear_search(frames, 0.5f, step));
+    }
+  }
+}
+
+TEST(AnimationSearch, track_entry) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton cached(data);
+  Skeleton direct(data);
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  Vector<Event*> events;
+  Animation* run = data->findAnimation("run");
+  ASSERT_TRUE(run != NULL);
+
+  state.setAnimation(0, run, true);
+  for (int frame = 0; frame < 200; frame++) {
+    state.update(1 / 60.0f);
+    cached.setToSetupPose();
+    state.apply(cached);
+    ASSERT_TRUE(cached.getTimelineCursor() == NULL);
+
+    direct.setToSetupPose();
+    float time = state.getCurrent(0)->getAnimationTime();
+    run->apply(direct, time, time, true, &events, 1, MixBlend_Setup, MixDirection_In);
+
+    for (size_t i = 0; i < cached.getBones().size(); i++) {
+      Bone* a = cached.getBones()[i];
+      Bone* b = direct.getBones()[i];
+      ASSERT_EQ(a->getX(), b->getX());
+      ASSERT_EQ(a->getY(), b->getY());
+      ASSERT_EQ(a->getRotation(), b->getRotation());
+      ASSERT_EQ(a->getScaleX(), b->getScaleX());
+    }
+  }
+
+  delete data;
+  delete atlas;
+}
+
+/*CurveTimeline1 每帧 2 个值*/
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(AnimationSearch, DISABLED_bench) {
+  Vector<float> frames;
+  int keys[] = {10, 100, 1000};
+  uint32_t samples = 20000;
+
+  for (uint32_t k = 0; k < ARRAY_SIZE(keys); k++) {
+    int cursor = 0;
+    int sum[3] = {0, 0, 0};
+    uint64_t cost[3] = {0, 0, 0};
+    float duration = keys[k] / 30.0f;
+    float delta = duration / samples * 3;
+
+    make_frames(frames, keys[k], 2);
+
+    uint64_t start = time_now_us();
+    for (uint32_t i = 0; i < samples; i++) {
+      sum[0] += linear_search(frames, MathUtil::fmod(i * delta, duration), 2);
+    }
+    cost[0] = time_now_us() - start;
+
+    start = time_now_us();
+    for (uint32_t i = 0; i < samples; i++) {
+      sum[1] += Animation::search(frames, MathUtil::fmod(i * delta, duration), 2);
+    }
+    cost[1] = time_now_us() - start;
+
+    start = time_now_us();
+    for (uint32_t i = 0; i < samples; i++) {
+      sum[2] += Animation::search(frames, MathUtil::fmod(i * delta, duration), 2, &cursor);
+    }
+    cost[2] = time_now_us() - start;
+
+    ASSERT_EQ(sum[0], sum[1]);
+    ASSERT_EQ(sum[0], sum[2]);
+    log_debug("search x %u on %d keys: linear %uus binary %uus cursor %uus\n", samples, keys[k],
+              (uint32_t)cost[0], (uint32_t)cost[1], (uint32_t)cost[2]);
+  }
+}
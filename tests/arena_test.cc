@@ -0,0 +1,515 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include "spine2d/spine_task_pool.h"
+#include <atomic>
+
+using namespace spine;
+
+/*统计经过 SpineExtension 实例的分配次数*/
+class CountingExtension : public SpineExtension {
+ public:
+  SpineExtension* base;
+  uint32_t allocs;
+
+  CountingExtension() : base(SpineExtension::getInstance()), allocs(0) {
+    SpineExtension::setInstance(this);
+  }
+  ~CountingExtension() {
+    SpineExtension::setInstance(base);
+  }
+
+  void* _alloc(size_t size, const char* file, int line) {
+    allocs++;
+    return base->_alloc(size, file, line);
+  }
+  void* _calloc(size_t size, const char* file, int line) {
+    allocs++;
+    return base->_calloc(size, file, line);
+  }
+  void* _realloc(void* ptr, size_t size, const char* file, int line) {
+    allocs++;
+    return base->_realloc(ptr, size, file, line);
+  }
+  void _free(void* mem, const char* file, int line) {
+    base->_free(mem, file, line);
+  }
+  char* _readFile(const String& path, int* length) {
+    return base->_readFile(path, length);
+  }
+};
+
+static SkeletonData* load_skeleton_data(Atlas* atlas, bool_t binary, bool arena) {
+  SkeletonData* data = NULL;
+  const char* name = binary ? SPINE_TEST_SKEL : SPINE_TEST_JSON;
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, name);
+  return_value_if_fail(info != NULL, NULL);
+  if (binary) {
+    SkeletonBinary reader(atlas);
+    reader.setArena(arena);
+    data = reader.readSkeletonData(info->data, info->size);
+  } else {
+    SkeletonJson reader(atlas);
+    reader.setArena(arena);
+    char* json = tk_strndup((const char*)info->data, info->size);
+    data = reader.readSkeletonData(json);
+    TKMEM_FREE(json);
+  }
+  asset_info_unref(info);
+  return data;
+}
+
+static void expect_same_poses(SkeletonData* a, SkeletonData* b, const char* name) {
+  AnimationStateData state_data_a(a);
+  AnimationStateData state_data_b(b);
+  AnimationState state_a(&state_data_a);
+  AnimationState state_b(&state_data_b);
+  Skeleton skeleton_a(a);
+  Skeleton skeleton_b(b);
+
+  state_a.setAnimation(0, name, true);
+  state_b.setAnimation(0, name, true);
+  for (int frame = 0; frame < 30; frame++) {
+    state_a.update(1 / 30.0f);
+    state_a.apply(skeleton_a);
+    skeleton_a.updateWorldTransform(Physics_Update);
+    state_b.update(1 / 30.0f);
+    state_b.apply(skeleton_b);
+    skeleton_b.updateWorldTransform(Physics_Update);
+    for (size_t i = 0; i < skeleton_a.getBones().size(); i++) {
+      ASSERT_EQ(skeleton_a.getBones()[i]->getWorldX(), skeleton_b.getBones()[i]->getWorldX());
+      ASSERT_EQ(skeleton_a.getBones()[i]->getWorldY(), skeleton_b.getBones()[i]->getWorldY());
+    }
+  }
+}
+
+TEST(Arena, alloc) {
+  Arena arena(1024);
+  char* heap = SpineExtension::alloc<char>(16, __FILE__, __LINE__);
+  ASSERT_FALSE(arena.owns(heap));
+
+  char* a = NULL;
+  int* b = NULL;
+  {
+    ArenaScope scope(&arena);
+    ASSERT_TRUE(Arena::getCurrent() == &arena);
+
+    a = SpineExtension::alloc<char>(3, __FILE__, __LINE__);
+    memcpy(a, "ab", 3);
+    b = SpineExtension::calloc<int>(4, __FILE__, __LINE__);
+    ASSERT_EQ((uintptr_t)a % 8, 0u);
+    ASSERT_TRUE((char*)b == a + 8);
+    ASSERT_EQ(b[0] | b[1] | b[2] | b[3], 0);
+    ASSERT_TRUE(arena.owns(a));
+    ASSERT_EQ(arena.getUsed(), 24u);
+    ASSERT_EQ(arena.getBlockCount(), 1u);
+
+    /*最后一次分配原地伸缩，其它的搬到新的位置*/
+    b[3] = 3;
+    ASSERT_TRUE(SpineExtension::realloc<int>(b, 8, __FILE__, __LINE__) == b);
+    ASSERT_EQ(arena.getUsed(), 40u);
+    char* moved = SpineExtension::realloc<char>(a, 64, __FILE__, __LINE__);
+    ASSERT_TRUE(moved != a && arena.owns(moved));
+    ASSERT_STREQ(moved, "ab");
+    ASSERT_EQ(b[3], 3);
+
+    /*释放最后一次分配时归还，其它的不归还*/
+    SpineExtension::free(moved, __FILE__, __LINE__);
+    ASSERT_EQ(arena.getUsed(), 40u);
+    SpineExtension::free(a, __FILE__, __LINE__);
+    ASSERT_EQ(arena.getUsed(), 40u);
+
+    /*大的分配单独一块，之后仍然从原来的块分配*/
+    char* large = SpineExtension::alloc<char>(600, __FILE__, __LINE__);
+    ASSERT_EQ(arena.getBlockCount(), 2u);
+    ASSERT_TRUE(arena.owns(large + 599));
+    ASSERT_FALSE(arena.owns(large + 600));
+    ASSERT_TRUE(SpineExtension::alloc<char>(1, __FILE__, __LINE__) == (char*)b + 32);
+
+    /*之前从实例分配的仍然由实例重新分配*/
+    heap = SpineExtension::realloc<char>(heap, 32, __FILE__, __LINE__);
+    ASSERT_FALSE(arena.owns(heap));
+
+    {
+      ArenaScope suspend(NULL);
+      char* outside = SpineExtension::alloc<char>(8, __FILE__, __LINE__);
+      ASSERT_FALSE(arena.owns(outside));
+      SpineExtension::free(outside, __FILE__, __LINE__);
+    }
+    ASSERT_TRUE(Arena::getCurrent() == &arena);
+  }
+  ASSERT_TRUE(Arena::getCurrent() == NULL);
+
+  /*内存池中的内存只在它是当前内存池时重新分配和释放，在内存池中搬移*/
+  size_t used = arena.getUsed();
+  {
+    ArenaScope scope(&arena);
+    int* moved = SpineExtension::realloc<int>(b, 16, __FILE__, __LINE__);
+    ASSERT_TRUE(moved != b && arena.owns(moved));
+    ASSERT_EQ(moved[3], 3);
+    SpineExtension::free(moved, __FILE__, __LINE__);
+    ASSERT_EQ(arena.getUsed(), used);
+  }
+  ASSERT_TRUE(arena.getCapacity() > used);
+
+  SpineExtension::free(heap, __FILE__, __LINE__);
+}
+
+TEST(Arena, retire) {
+  /*没有分配过的内存池什么都不做*/
+  Arena* empty = new Arena();
+  empty->retire();
+  ASSERT_TRUE(Arena::getCurrent() == NULL);
+  delete empty;
+
+  Arena* outer = new Arena(1024);
+  Arena* arena = new Arena(1024);
+  char* a = NULL;
+  {
+    ArenaScope scope(arena);
+    a = SpineExtension::alloc<char>(16, __FILE__, __LINE__);
+  }
+
+  /*持有者析构时设为当前的内存池直到销毁，之后恢复原来的*/
+  {
+    ArenaScope scope(outer);
+    arena->retire();
+    ASSERT_TRUE(Arena::getCurrent() == arena);
+    char* heap = NULL;
+    {
+      ArenaScope suspend(NULL);
+      heap = SpineExtension::alloc<char>(16, __FILE__, __LINE__);
+    }
+    SpineExtension::free(heap, __FILE__, __LINE__);
+    SpineExtension::free(a, __FILE__, __LINE__);
+    ASSERT_EQ(arena->getUsed(), 0u);
+    delete arena;
+    ASSERT_TRUE(Arena::getCurrent() == outer);
+  }
+  ASSERT_TRUE(Arena::getCurrent() == NULL);
+  delete outer;
+}
+
+TEST(Arena, skeleton_binary) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = load_skeleton_data(atlas, TRUE, false);
+  ASSERT_TRUE(data != NULL);
+  ASSERT_EQ(data->getArena().getBlockCount(), 0u);
+
+  uint32_t allocs[2] = {0, 0};
+  SkeletonData* arena = NULL;
+  {
+    CountingExtension counting;
+    SkeletonData* heap = load_skeleton_data(atlas, TRUE, false);
+    allocs[0] = counting.allocs;
+    delete heap;
+
+    counting.allocs = 0;
+    arena = load_skeleton_data(atlas, TRUE, true);
+    allocs[1] = counting.allocs;
+  }
+  ASSERT_TRUE(arena != NULL);
+  ASSERT_TRUE(arena->getArena().owns(arena->getBones()[0]));
+  ASSERT_TRUE(arena->getArena().owns(arena->getAnimations().buffer()));
+  ASSERT_FALSE(arena->getArena().owns(arena));
+  ASSERT_LT(allocs[1] * 10, allocs[0]);
+  log_debug("load %s: %u allocations, with arena %u allocations, %u blocks, %u/%u bytes\n",
+            SPINE_TEST_SKEL, allocs[0], allocs[1], (uint32_t)arena->getArena().getBlockCount(),
+            (uint32_t)arena->getArena().getUsed(), (uint32_t)arena->getArena().getCapacity());
+
+  expect_same_poses(data, arena, "run");
+  expect_same_poses(data, arena, "portal");
+
+  /*加载后在它的内存池中修改*/
+  Skin* skin = arena->getDefaultSkin();
+  Vector<Attachment*> attachments;
+  skin->findAttachmentsForSlot(arena->findSlot("eye")->getIndex(), attachments);
+  ASSERT_TRUE(attachments.size() > 0);
+  {
+    ArenaScope scope(&arena->getArena());
+    for (int i = 0; i < 40; i++) {
+      char name[32];
+      tk_snprintf(name, sizeof(name), "extra%d", i);
+      skin->setAttachment(3, name, attachments[0]);
+    }
+    size_t animations = arena->getAnimations().size();
+    Animation** buffer = arena->getAnimations().buffer();
+    for (size_t i = 0; i < animations * 2; i++) {
+      arena->getAnimations().add(NULL);
+    }
+    ASSERT_TRUE(arena->getAnimations().buffer() != buffer);
+    ASSERT_TRUE(arena->getArena().owns(arena->getAnimations().buffer()));
+    arena->getAnimations().setSize(animations, NULL);
+  }
+  ASSERT_TRUE(skin->getAttachment(3, "extra39") == attachments[0]);
+  expect_same_poses(data, arena, "walk");
+
+  delete arena;
+  delete data;
+  delete atlas;
+}
+
+TEST(Arena, skeleton_json) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = load_skeleton_data(atlas, FALSE, false);
+  ASSERT_TRUE(data != NULL);
+
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_JSON);
+  char* json = tk_strndup((const char*)info->data, info->size);
+  SkeletonJson reader(atlas);
+  reader.setArena(true);
+
+  /*同一个读取器读两次，中间删除第一次的结果，读取器自己的数据不能留在第一次的内存池中*/
+  SkeletonData* first = reader.readSkeletonData(json);
+  ASSERT_TRUE(first != NULL);
+  ASSERT_TRUE(first->getArena().owns(first->getBones()[0]));
+  size_t used = first->getArena().getUsed();
+  delete first;
+
+  SkeletonData* arena = reader.readSkeletonData(json);
+  ASSERT_TRUE(arena != NULL);
+  ASSERT_EQ(arena->getArena().getUsed(), used);
+  expect_same_poses(data, arena, "run");
+  expect_same_poses(data, arena, "portal");
+  delete arena;
+
+  /*失败时错误信息在内存池之外*/
+  char* version = strstr(json, "\"4.2.");
+  ASSERT_TRUE(version != NULL);
+  version[1] = '3';
+  ASSERT_TRUE(reader.readSkeletonData(json) == NULL);
+  ASSERT_TRUE(strstr(reader.getError().buffer(), "does not match") != NULL);
+
+  TKMEM_FREE(json);
+  asset_info_unref(info);
+  delete data;
+  delete atlas;
+}
+
+TEST(Arena, skeleton) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = load_skeleton_data(atlas, TRUE, true);
+  ASSERT_TRUE(data != NULL);
+
+  uint32_t allocs = 0;
+  Skeleton* skeleton = NULL;
+  {
+    CountingExtension counting;
+    skeleton = new Skeleton(data);
+    allocs = counting.allocs;
+  }
+
+  /*骨骼、插槽和约束都在同一块内存中*/
+  Arena& arena = skeleton->getArena();
+  ASSERT_EQ(arena.getBlockCount(), 1u);
+  ASSERT_LE(allocs, 2u);
+  ASSERT_FALSE(arena.owns(skeleton));
+  ASSERT_TRUE(arena.owns(skeleton->getBones()[0]));
+  ASSERT_TRUE(arena.owns(skeleton->getSlots()[0]));
+  ASSERT_TRUE(arena.owns(skeleton->getIkConstraints()[0]));
+  ASSERT_TRUE(arena.owns(skeleton->getBones()[0]->getChildren().buffer()));
+  ASSERT_EQ(skeleton->getBones()[0]->getChildren().getCapacity(),
+            skeleton->getBones()[0]->getChildren().size());
+  log_debug("new Skeleton(%s): %u allocations, %u/%u bytes\n", SPINE_TEST_SKEL, allocs,
+            (uint32_t)arena.getUsed(), (uint32_t)arena.getCapacity());
+
+  /*之后换皮肤和播放动画时的分配不再进入内存池*/
+  SkeletonData* heap = load_skeleton_data(atlas, TRUE, false);
+  Skeleton expected(heap);
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  AnimationStateData expected_state_data(heap);
+  AnimationState expected_state(&expected_state_data);
+  size_t used = arena.getUsed();
+  state.setAnimation(0, "portal", false);
+  expected_state.setAnimation(0, "portal", false);
+  for (int frame = 0; frame < 60; frame++) {
+    state.update(1 / 30.0f);
+    state.apply(*skeleton);
+    skeleton->updateWorldTransform(Physics_Update);
+    expected_state.update(1 / 30.0f);
+    expected_state.apply(expected);
+    expected.updateWorldTransform(Physics_Update);
+    for (size_t i = 0; i < expected.getBones().size(); i++) {
+      ASSERT_EQ(skeleton->getBones()[i]->getWorldX(), expected.getBones()[i]->getWorldX());
+      ASSERT_EQ(skeleton->getBones()[i]->getWorldY(), expected.getBones()[i]->getWorldY());
+    }
+  }
+  ASSERT_EQ(arena.getUsed(), used);
+
+  delete skeleton;
+  delete heap;
+  delete data;
+  delete atlas;
+}
+
+TEST(Arena, skeleton_skin) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = load_skeleton_data(atlas, TRUE, true);
+  ASSERT_TRUE(data != NULL);
+
+  /*只有皮肤需要的骨骼不在初始的更新缓存中*/
+  Vector<BoneData*>& bones = data->getBones();
+  Skin* skin = new Skin("extra");
+  for (size_t i = bones.size() - 3; i < bones.size(); i++) {
+    bones[i]->setSkinRequired(true);
+    skin->getBones().add(bones[i]);
+  }
+
+  /*换皮肤后更新缓存变长，在骨骼自己的内存池中增长*/
+  Skeleton* skeleton = new Skeleton(data);
+  Arena& arena = skeleton->getArena();
+  size_t cached = skeleton->getUpdateCacheList().size();
+  size_t used = arena.getUsed();
+  skeleton->setSkin(skin);
+  ASSERT_EQ(skeleton->getUpdateCacheList().size(), cached + 3);
+  ASSERT_TRUE(arena.getUsed() > used);
+  skeleton->updateWorldTransform(Physics_Update);
+
+  used = arena.getUsed();
+  skeleton->setSkin((Skin*)NULL);
+  skeleton->setSkin(skin);
+  ASSERT_EQ(arena.getUsed(), used);
+  ASSERT_EQ(arena.getBlockCount(), 1u);
+
+  delete skeleton;
+  delete skin;
+  delete data;
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(Arena, DISABLED_load_time) {
+  Atlas* atlas = spine_test_load_atlas();
+  uint32_t times = 50;
+  uint64_t cost[2] = {0, 0};
+  for (uint32_t i = 0; i < times; i++) {
+    for (int arena = 0; arena < 2; arena++) {
+      uint64_t start = time_now_us();
+      SkeletonData* data = load_skeleton_data(atlas, TRUE, arena != 0);
+      delete data;
+      cost[arena] += time_now_us() - start;
+    }
+  }
+
+  log_debug("load and delete %s x %u: heap %uus, arena %uus\n", SPINE_TEST_SKEL, times,
+            (uint32_t)cost[0], (uint32_t)cost[1]);
+  delete atlas;
+}
+
+/*统计经过 SpineExtension 实例的全部调用，可以在多个线程中使用*/
+class FrameCountingExtension : public SpineExtension {
+ public:
+  SpineExtension* base;
+  std::atomic<uint32_t> allocs;
+  std::atomic<uint32_t> frees;
+
+  FrameCountingExtension() : base(SpineExtension::getInstance()), allocs(0), frees(0) {
+    SpineExtension::setInstance(this);
+  }
+  ~FrameCountingExtension() {
+    SpineExtension::setInstance(base);
+  }
+
+  void* _alloc(size_t size, const char* file, int line) {
+    allocs++;
+    return base->_alloc(size, file, line);
+  }
+  void* _calloc(size_t size, const char* file, int line) {
+    allocs++;
+    return base->_calloc(size, file, line);
+  }
+  void* _realloc(void* ptr, size_t size, const char* file, int line) {
+    allocs++;
+    return base->_realloc(ptr, size, file, line);
+  }
+  void _free(void* mem, const char* file, int line) {
+    frees++;
+    base->_free(mem, file, line);
+  }
+  char* _readFile(const String& path, int* length) {
+    return base->_readFile(path, length);
+  }
+};
+
+typedef struct _frame_task_t {
+  Skeleton* skeleton;
+  AnimationState* state;
+} frame_task_t;
+
+static ret_t frame_task(void* ctx) {
+  frame_task_t* task = (frame_task_t*)ctx;
+
+  task->state->update(1 / 60.0f);
+  task->state->apply(*(task->skeleton));
+  task->skeleton->update(1 / 60.0f);
+  task->skeleton->updateWorldTransform(Physics_Update);
+
+  return RET_OK;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(Arena, DISABLED_parallel_frame) {
+  const uint32_t nr = 64;
+  const uint32_t frames = 600;
+  FrameCountingExtension* counting = new FrameCountingExtension();
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = load_skeleton_data(atlas, TRUE, true);
+  ASSERT_TRUE(data != NULL);
+
+  frame_task_t tasks[nr];
+  void* ctxs[nr];
+  AnimationStateData state_data(data);
+  state_data.setDefaultMix(0.2f);
+  Vector<Animation*>& animations = data->getAnimations();
+  spine_task_pool_t* pool = spine_task_pool_create(4);
+  ASSERT_TRUE(pool != NULL);
+
+  counting->allocs = 0;
+  counting->frees = 0;
+  uint64_t start = time_now_us();
+  for (uint32_t i = 0; i < nr; i++) {
+    tasks[i].skeleton = new Skeleton(data);
+    tasks[i].state = new AnimationState(&state_data);
+    tasks[i].state->setAnimation(0, animations[i % animations.size()], true);
+    ctxs[i] = tasks + i;
+  }
+  log_debug("new Skeleton x %u: %u allocations, %uus\n", nr, (uint32_t)counting->allocs,
+            (uint32_t)(time_now_us() - start));
+
+  /*每秒每个骨骼换一次动画，统计稳定后的每帧分配次数和耗时*/
+  uint32_t allocs = 0;
+  uint32_t frees = 0;
+  uint64_t cost = 0;
+  for (uint32_t frame = 0; frame < frames * 2; frame++) {
+    if (frame % 60 == 0) {
+      for (uint32_t i = 0; i < nr; i++) {
+        tasks[i].state->setAnimation(0, animations[(i + frame / 60) % animations.size()], true);
+      }
+    }
+    if (frame == frames) {
+      counting->allocs = 0;
+      counting->frees = 0;
+    }
+    start = time_now_us();
+    ASSERT_EQ(spine_task_pool_run(pool, frame_task, ctxs, nr), RET_OK);
+    if (frame >= frames) {
+      cost += time_now_us() - start;
+    }
+  }
+  allocs = counting->allocs;
+  frees = counting->frees;
+  log_debug("%u skeletons on 4 threads x %u frames: %u allocations %u frees, %uus per frame\n", nr,
+            frames, allocs, frees, (uint32_t)(cost / frames));
+
+  start = time_now_us();
+  for (uint32_t i = 0; i < nr; i++) {
+    delete tasks[i].state;
+    delete tasks[i].skeleton;
+  }
+  log_debug("delete Skeleton x %u: %uus\n", nr, (uint32_t)(time_now_us() - start));
+
+  spine_task_pool_destroy(pool);
+  delete data;
+  delete atlas;
+  delete counting;
+}
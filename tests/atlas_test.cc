@@ -0,0 +1,176 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+/*记录加载的纹理路径*/
+class PathTextureLoader : public TextureLoader {
+ public:
+  Vector<String> paths;
+
+  void load(AtlasPage& page, const String& path) {
+    paths.add(path);
+    page.texture = (void*)1;
+  }
+  void unload(void* texture) {
+  }
+};
+
+static void expect_same_atlas(Atlas* a, Atlas* b) {
+  ASSERT_EQ(a->getPages().size(), b->getPages().size());
+  for (size_t i = 0; i < a->getPages().size(); i++) {
+    AtlasPage* page_a = a->getPages()[i];
+    AtlasPage* page_b = b->getPages()[i];
+    ASSERT_TRUE(page_a->name == page_b->name);
+    ASSERT_TRUE(page_a->texturePath == page_b->texturePath);
+    ASSERT_EQ(page_a->format, page_b->format);
+    ASSERT_EQ(page_a->minFilter, page_b->minFilter);
+    ASSERT_EQ(page_a->magFilter, page_b->magFilter);
+    ASSERT_EQ(page_a->uWrap, page_b->uWrap);
+    ASSERT_EQ(page_a->vWrap, page_b->vWrap);
+    ASSERT_EQ(page_a->width, page_b->width);
+    ASSERT_EQ(page_a->height, page_b->height);
+    ASSERT_EQ(page_a->pma, page_b->pma);
+    ASSERT_EQ(page_a->index, page_b->index);
+  }
+
+  ASSERT_EQ(a->getRegions().size(), b->getRegions().size());
+  for (size_t i = 0; i < a->getRegions().size(); i++) {
+    AtlasRegion* region_a = a->getRegions()[i];
+    AtlasRegion* region_b = b->getRegions()[i];
+    ASSERT_TRUE(region_a->name == region_b->name);
+    ASSERT_EQ(region_a->page->index, region_b->page->index);
+    ASSERT_TRUE(region_b->rendererObject == region_b->page->texture);
+    ASSERT_EQ(region_a->index, region_b->index);
+    ASSERT_EQ(region_a->x, region_b->x);
+    ASSERT_EQ(region_a->y, region_b->y);
+    ASSERT_EQ(region_a->width, region_b->width);
+    ASSERT_EQ(region_a->height, region_b->height);
+    ASSERT_EQ(region_a->originalWidth, region_b->originalWidth);
+    ASSERT_EQ(region_a->originalHeight, region_b->originalHeight);
+    ASSERT_EQ(region_a->offsetX, region_b->offsetX);
+    ASSERT_EQ(region_a->offsetY, region_b->offsetY);
+    ASSERT_EQ(region_a->degrees, region_b->degrees);
+    ASSERT_EQ(region_a->u, region_b->u);
+    ASSERT_EQ(region_a->v, region_b->v);
+    ASSERT_EQ(region_a->u2, region_b->u2);
+    ASSERT_EQ(region_a->v2, region_b->v2);
+    ASSERT_EQ(region_a->names.size(), region_b->names.size());
+    for (size_t n = 0; n < region_a->names.size(); n++) {
+      ASSERT_TRUE(region_a->names[n] == region_b->names[n]);
+    }
+    ASSERT_EQ(region_a->values.size(), region_b->values.size());
+    for (size_t n = 0; n < region_a->values.size(); n++) {
+      ASSERT_EQ(region_a->values[n], region_b->values[n]);
+    }
+  }
+}
+
+TEST(Atlas, binary) {
+  PathTextureLoader text_loader;
+  PathTextureLoader binary_loader;
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_ATLAS);
+  ASSERT_TRUE(info != NULL);
+  ASSERT_FALSE(Atlas::isBinary((const char*)info->data, info->size));
+
+  Atlas text((const char*)info->data, info->size, "data", &text_loader);
+  ASSERT_TRUE(text.getRegions().size() > 0);
+
+  Vector<unsigned char> data;
+  text.writeBinary(data);
+  ASSERT_TRUE(Atlas::isBinary((const char*)data.buffer(), data.size()));
+
+  Atlas binary((const char*)data.buffer(), data.size(), "data", &binary_loader);
+  expect_same_atlas(&text, &binary);
+  ASSERT_EQ(text_loader.paths.size(), binary_loader.paths.size());
+  for (size_t i = 0; i < text_loader.paths.size(); i++) {
+    ASSERT_TRUE(text_loader.paths[i] == binary_loader.paths[i]);
+  }
+  ASSERT_TRUE(binary.findRegion("eye-indifferent") != NULL);
+
+  /*再次转换的结果不变*/
+  Vector<unsigned char> again;
+  binary.writeBinary(again);
+  ASSERT_EQ(again.size(), data.size());
+  ASSERT_EQ(memcmp(again.buffer(), data.buffer(), data.size()), 0);
+
+  /*旋转的区域预先算好了 UV*/
+  for (size_t i = 0; i < binary.getRegions().size(); i++) {
+    AtlasRegion* region = binary.getRegions()[i];
+    if (region->degrees == 90) {
+      ASSERT_EQ(region->u2, (float)(region->x + region->height) / region->page->width);
+      ASSERT_EQ(region->v2, (float)(region->y + region->width) / region->page->height);
+    }
+  }
+
+  asset_info_unref(info);
+}
+
+TEST(Atlas, binary_skeleton) {
+  NullTextureLoader texture_loader;
+  Atlas* text = spine_test_load_atlas();
+  ASSERT_TRUE(text != NULL);
+
+  Vector<unsigned char> data;
+  text->writeBinary(data);
+  Atlas* binary = new Atlas((const char*)data.buffer(), data.size(), "", &texture_loader);
+  SkeletonData* skeleton_data = spine_test_load_skeleton_data(binary, TRUE);
+  ASSERT_TRUE(skeleton_data != NULL);
+
+  Skin::AttachmentMap::Entries entries = skeleton_data->getDefaultSkin()->getAttachments();
+  while (entries.hasNext()) {
+    Attachment* attachment = entries.next()._attachment;
+    if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+      ASSERT_TRUE(((RegionAttachment*)attachment)->getRegion() != NULL);
+    }
+  }
+
+  delete skeleton_data;
+  delete binary;
+  delete text;
+}
+
+TEST(Atlas, binary_corrupt) {
+  Atlas* text = spine_test_load_atlas();
+  Vector<unsigned char> data;
+  text->writeBinary(data);
+
+  /*截断的数据只加载完整的部分*/
+  for (size_t size = 6; size < data.size(); size += 7) {
+    Atlas atlas((const char*)data.buffer(), size, "", NULL);
+    ASSERT_LT(atlas.getRegions().size(), text->getRegions().size());
+  }
+
+  /*版本不匹配时不加载*/
+  data[5] = 2;
+  Atlas atlas((const char*)data.buffer(), data.size(), "", NULL);
+  ASSERT_EQ(atlas.getPages().size(), 0u);
+
+  delete text;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(Atlas, DISABLED_load_time) {
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_ATLAS);
+  ASSERT_TRUE(info != NULL);
+
+  Vector<unsigned char> data;
+  Atlas((const char*)info->data, info->size, "", NULL, false).writeBinary(data);
+
+  uint32_t times = 200;
+  uint64_t cost[2] = {0, 0};
+  for (uint32_t i = 0; i < times; i++) {
+    uint64_t start = time_now_us();
+    Atlas text((const char*)info->data, info->size, "", NULL, false);
+    cost[0] += time_now_us() - start;
+
+    start = time_now_us();
+    Atlas binary((const char*)data.buffer(), data.size(), "", NULL, false);
+    cost[1] += time_now_us() - start;
+  }
+
+  log_debug("load %s x %u: text %u bytes %uus, binary %u bytes %uus\n", SPINE_TEST_ATLAS, times,
+            info->size, (uint32_t)cost[0], (uint32_t)data.size(), (uint32_t)cost[1]);
+
+  asset_info_unref(info);
+}
@@ -0,0 +1,197 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+typedef struct _play_result_t {
+  float max_error;
+  uint32_t events;
+} play_result_t;
+
+class CountListener : public AnimationStateListenerObject {
+ public:
+  uint32_t events;
+
+  CountListener() : events(0) {
+  }
+
+  void callback(AnimationState* state, EventType type, TrackEntry* entry, Event* event) {
+    if (type == EventType_Event) {
+      events++;
+    }
+  }
+};
+
+/*分别播放原始动画和烘焙动画，返回骨骼世界坐标的最大误差*/
+static play_result_t play(SkeletonData* data, SkeletonData* baked_data, const char* name) {
+  play_result_t result = {0, 0};
+  AnimationStateData exact_state_data(data);
+  AnimationStateData baked_state_data(baked_data);
+  AnimationState exact_state(&exact_state_data);
+  AnimationState baked_state(&baked_state_data);
+  Skeleton exact(data);
+  Skeleton baked(baked_data);
+  CountListener listener;
+
+  exact_state.setAnimation(0, name, true);
+  baked_state.setAnimation(0, name, true);
+  baked_state.setListener(&listener);
+
+  for (int frame = 0; frame < 240; frame++) {
+    exact_state.update(1 / 60.0f);
+    exact_state.apply(exact);
+    exact.updateWorldTransform(Physics_None);
+
+    baked_state.update(1 / 60.0f);
+    baked_state.apply(baked);
+    baked.updateWorldTransform(Physics_None);
+
+    for (size_t i = 0; i < exact.getBones().size(); i++) {
+      Bone* a = exact.getBones()[i];
+      Bone* b = baked.getBones()[i];
+      result.max_error = tk_max(result.max_error, MathUtil::abs(a->getWorldX() - b->getWorldX()));
+      result.max_error = tk_max(result.max_error, MathUtil::abs(a->getWorldY() - b->getWorldY()));
+    }
+  }
+  result.events = listener.events;
+
+  return result;
+}
+
+TEST(BakedAnimation, bake) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Animation* run = data->findAnimation("run");
+  BakedAnimation* baked = run->bake(*data, 30);
+  ASSERT_TRUE(run->getBaked() == baked);
+  ASSERT_FALSE(baked->isQuantized());
+  ASSERT_EQ(baked->getFrameCount(), (size_t)MathUtil::ceil(run->getDuration() * 30) + 1);
+  ASSERT_TRUE(baked->getTrackCount() > 0);
+
+  /*事件、附件等时间线不烘焙*/
+  Vector<Timeline*>& timelines = run->getTimelines();
+  for (size_t i = 0; i < timelines.size(); i++) {
+    bool bone = timelines[i]->getRTTI().instanceOf(RotateTimeline::rtti) ||
+                timelines[i]->getRTTI().instanceOf(TranslateTimeline::rtti);
+    bool other = timelines[i]->getRTTI().instanceOf(EventTimeline::rtti) ||
+                 timelines[i]->getRTTI().instanceOf(AttachmentTimeline::rtti) ||
+                 timelines[i]->getRTTI().instanceOf(DeformTimeline::rtti);
+    if (bone) ASSERT_TRUE(baked->isBaked(i));
+    if (other) ASSERT_FALSE(baked->isBaked(i));
+  }
+
+  size_t size = baked->getSampleSize();
+  baked = run->bake(*data, 30, true);
+  ASSERT_TRUE(baked->isQuantized());
+  ASSERT_TRUE(baked->getSampleSize() < size);
+
+  data->bakeAnimations(30);
+  for (size_t i = 0; i < data->getAnimations().size(); i++) {
+    ASSERT_TRUE(data->getAnimations()[i]->getBaked() != NULL);
+  }
+
+  delete data;
+  delete atlas;
+}
+
+TEST(BakedAnimation, play) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  SkeletonData* baked_data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL && baked_data != NULL);
+
+  baked_data->bakeAnimations(60);
+  play_result_t result = play(data, baked_data, "walk");
+  log_debug("walk 60fps: max error %f\n", result.max_error);
+  ASSERT_LT(result.max_error, 2.0f);
+
+  baked_data->bakeAnimations(60, true);
+  result = play(data, baked_data, "walk");
+  log_debug("walk 60fps quantized: max error %f\n", result.max_error);
+  ASSERT_LT(result.max_error, 2.0f);
+
+  baked_data->bakeAnimations(60);
+  result = play(data, baked_data, "run");
+  log_debug("run 60fps: max error %f, %u events\n", result.max_error, result.events);
+  ASSERT_LT(result.max_error, 5.0f);
+  ASSERT_TRUE(result.events > 0);
+
+  delete baked_data;
+  delete data;
+  delete atlas;
+}
+
+TEST(BakedAnimation, mix) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  SkeletonData* baked_data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL && baked_data != NULL);
+
+  AnimationStateData state_data(data);
+  AnimationStateData baked_state_data(baked_data);
+  AnimationState state(&state_data);
+  AnimationState baked_state(&baked_state_data);
+  Skeleton skeleton(data);
+  Skeleton baked(baked_data);
+
+  /*混合过程中不使用烘焙数据*/
+  baked_data->bakeAnimations(30);
+  state_data.setDefaultMix(0.5f);
+  baked_state_data.setDefaultMix(0.5f);
+  state.setAnimation(0, "walk", true);
+  baked_state.setAnimation(0, "walk", true);
+  state.update(0.3f);
+  state.apply(skeleton);
+  baked_state.update(0.3f);
+  baked_state.apply(baked);
+  state.setAnimation(0, "run", true);
+  baked_state.setAnimation(0, "run", true);
+
+  for (int frame = 0; frame < 20; frame++) {
+    state.update(1 / 60.0f);
+    state.apply(skeleton);
+    baked_state.update(1 / 60.0f);
+    baked_state.apply(baked);
+    ASSERT_TRUE(baked_state.getCurrent(0)->getMixingFrom() != NULL);
+    for (size_t i = 0; i < skeleton.getBones().size(); i++) {
+      ASSERT_EQ(skeleton.getBones()[i]->getRotation(), baked.getBones()[i]->getRotation());
+      ASSERT_EQ(skeleton.getBones()[i]->getX(), baked.getBones()[i]->getX());
+    }
+  }
+
+  delete baked_data;
+  delete data;
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(BakedAnimation, DISABLED_bench) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  Skeleton skeleton(data);
+  uint64_t cost[2] = {0, 0};
+  uint32_t times = 2000;
+
+  state.setAnimation(0, "run", true);
+  for (int baked = 0; baked < 2; baked++) {
+    if (baked) data->bakeAnimations(60);
+    uint64_t start = time_now_us();
+    for (uint32_t i = 0; i < times; i++) {
+      state.update(1 / 60.0f);
+      state.apply(skeleton);
+    }
+    cost[baked] = time_now_us() - start;
+  }
+
+  log_debug("apply run x %u: timelines %uus baked %uus\n", times, (uint32_t)cost[0],
+            (uint32_t)cost[1]);
+
+  delete data;
+  delete atlas;
+}
@@ -0,0 +1,189 @@
+#include <math.h>
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+#define BEZIER_SIZE 18
+
+/*修改前 CurveTimeline::getBezierValue 的实现，逐段查找贝塞尔曲线的采样点。*/
+static float scan_bezier_value(CurveTimeline1* timeline, float time, int frame, int i) {
+  Vector<float>& curves = timeline->getCurves();
+  Vector<float>& frames = timeline->getFrames();
+
+  if (curves[i] > time) {
+    float x = frames[frame], y = frames[frame + 1];
+    return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+  }
+  int n = i + BEZIER_SIZE;
+  for (i += 2; i < n; i += 2) {
+    if (curves[i] >= time) {
+      float x = curves[i - 2], y = curves[i - 1];
+      return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+    }
+  }
+  float x = curves[n - 2], y = curves[n - 1];
+  return y + (time - x) / (frames[frame + 2] - x) * (frames[frame + 3] - y);
+}
+
+static void collect_curves(SkeletonData* data, Vector<CurveTimeline1*>& timelines) {
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    Vector<Timeline*>& list = animations[i]->getTimelines();
+    for (size_t j = 0; j < list.size(); j++) {
+      if (list[j]->getRTTI().instanceOf(CurveTimeline1::rtti)) {
+        timelines.add((CurveTimeline1*)list[j]);
+      }
+    }
+  }
+}
+
+TEST(CurveTimeline, bezier_lut) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Vector<CurveTimeline1*> timelines;
+  uint32_t beziers = 0;
+
+  collect_curves(data, timelines);
+  for (size_t t = 0; t < timelines.size(); t++) {
+    CurveTimeline1* timeline = timelines[t];
+    Vector<float>& frames = timeline->getFrames();
+    Vector<float>& curves = timeline->getCurves();
+
+    for (size_t f = 0; f + 1 < timeline->getFrameCount(); f++) {
+      int curve = (int)curves[f];
+      if (curve < 2) continue;
+      beziers++;
+
+      int frame = f * 2;
+      float time1 = frames[frame], time2 = frames[frame + 2];
+      for (int s = 0; s < 50; s++) {
+        float time = time1 + (time2 - time1) * s / 50;
+        ASSERT_EQ(timeline->getCurveValue(time), scan_bezier_value(timeline, time, frame, curve - 2));
+      }
+
+      /*分段的端点及其两侧*/
+      for (int s = 0; s < BEZIER_SIZE; s += 2) {
+        float x = curves[curve - 2 + s];
+        float times[] = {x, nextafterf(x, time1), nextafterf(x, time2)};
+        for (uint32_t n = 0; n < ARRAY_SIZE(times); n++) {
+          if (times[n] < time1 || times[n] >= time2) continue;
+          ASSERT_EQ(timeline->getCurveValue(times[n]),
+                    scan_bezier_value(timeline, times[n], frame, curve - 2));
+        }
+      }
+    }
+  }
+
+  ASSERT_TRUE(beziers > 0);
+
+  delete data;
+  delete atlas;
+}
+
+/*时间线数据占用的内存*/
+static size_t timelines_memory(SkeletonData* data) {
+  size_t size = 0;
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    Vector<Timeline*>& timelines = animations[i]->getTimelines();
+    for (size_t j = 0; j < timelines.size(); j++) {
+      size += timelines[j]->getFrames().getCapacity() * sizeof(float);
+      if (timelines[j]->getRTTI().instanceOf(CurveTimeline::rtti)) {
+        size += ((CurveTimeline*)timelines[j])->getCurves().getCapacity() * sizeof(float);
+      }
+    }
+  }
+  return size;
+}
+
+TEST(CurveTimeline, compact) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  SkeletonData* compact_data = spine_test_load_skeleton_data(atlas, TRUE, TRUE);
+  SkeletonData* compact_json = spine_test_load_skeleton_data(atlas, FALSE, TRUE);
+  ASSERT_TRUE(data != NULL && compact_data != NULL && compact_json != NULL);
+
+  size_t size = timelines_memory(data);
+  size_t compact_size = timelines_memory(compact_data);
+  log_debug("%s timelines: %u bytes, compact curves %u bytes\n", SPINE_TEST_SKEL, (uint32_t)size,
+            (uint32_t)compact_size);
+  ASSERT_LT(compact_size, size / 2);
+  ASSERT_EQ(timelines_memory(compact_json), compact_size);
+
+  Skeleton skeleton(data);
+  Skeleton compact(compact_data);
+  Vector<Animation*>& animations = data->getAnimations();
+  float max_error = 0;
+  for (size_t i = 0; i < animations.size(); i++) {
+    Animation* animation = animations[i];
+    Animation* compact_animation = compact_data->getAnimations()[i];
+    for (float time = 0; time < animation->getDuration(); time += 1 / 60.0f) {
+      skeleton.setToSetupPose();
+      compact.setToSetupPose();
+      animation->apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+      compact_animation->apply(compact, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+      for (size_t b = 0; b < skeleton.getBones().size(); b++) {
+        Bone* a = skeleton.getBones()[b];
+        Bone* c = compact.getBones()[b];
+        max_error = tk_max(max_error, MathUtil::abs(a->getRotation() - c->getRotation()));
+        max_error = tk_max(max_error, MathUtil::abs(a->getX() - c->getX()));
+        max_error = tk_max(max_error, MathUtil::abs(a->getY() - c->getY()));
+      }
+    }
+  }
+
+  /*默认的分段线性近似在陡峭的曲线上和精确求解有几个单位的差异*/
+  log_debug("compact curves max difference %f\n", max_error);
+  ASSERT_LT(max_error, 5.0f);
+
+  delete compact_json;
+  delete compact_data;
+  delete data;
+  delete atlas;
+}
+
+class TestCurveTimeline : public CurveTimeline1 {
+ public:
+  TestCurveTimeline() : CurveTimeline1(2, 1) {
+  }
+  void apply(Skeleton& skeleton, float lastTime, float time, Vector<Event*>* events, float alpha,
+             MixBlend blend, MixDirection direction) {
+  }
+};
+
+static double bezier(double p0, double p1, double p2, double p3, double t) {
+  double u = 1 - t;
+  return u * u * u * p0 + 3 * u * u * t * p1 + 3 * u * t * t * p2 + t * t * t * p3;
+}
+
+TEST(CurveTimeline, compact_accuracy) {
+  float curves[][4] = {{0.1f, 5, 0.7f, 1}, {0.9f, 0, 0.95f, 1}, {0.01f, 1, 0.02f, 1}, {0.5f, -3, 0.5f, 4}};
+
+  for (uint32_t c = 0; c < ARRAY_SIZE(curves); c++) {
+    float* k = curves[c];
+    TestCurveTimeline timeline;
+    timeline.setCompact(true);
+    ASSERT_TRUE(timeline.isCompact());
+    ASSERT_EQ(timeline.getCurves().size(), 2u + 4u);
+    timeline.setFrame(0, 0, 0);
+    timeline.setFrame(1, 1, 10);
+    timeline.setBezier(0, 0, 0, 0, 0, k[0], k[1] * 10, k[2], k[3] * 10, 1, 10);
+
+    for (int s = 0; s < 1000; s++) {
+      float time = s / 1000.0f;
+      double low = 0, high = 1;
+      for (int i = 0; i < 60; i++) {
+        double middle = (low + high) / 2;
+        if (bezier(0, k[0], k[2], 1, middle) < time) {
+          low = middle;
+        } else {
+          high = middle;
+        }
+      }
+      ASSERT_NEAR(timeline.getCurveValue(time), bezier(0, k[1] * 10, k[3] * 10, 10, low), 0.01);
+    }
+  }
+}
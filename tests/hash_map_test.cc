@@ -0,0 +1,124 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+TEST(HashMap, basic) {
+  HashMap<PropertyId, int> map;
+  for (int i = 0; i < 1000; i++) {
+    map.put(((PropertyId)(i % 7) << 32) | i, i);
+  }
+  ASSERT_EQ(map.size(), 1000u);
+  map.put(((PropertyId)3 << 32) | 3, -3);
+  ASSERT_EQ(map.size(), 1000u);
+  ASSERT_EQ(map[((PropertyId)3 << 32) | 3], -3);
+  map.put(((PropertyId)3 << 32) | 3, 3);
+  ASSERT_FALSE(map.containsKey(3));
+
+  /*删除后同一探测序列上的其它键仍然能找到*/
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_TRUE(map.remove(((PropertyId)(i % 7) << 32) | i));
+  }
+  ASSERT_FALSE(map.remove(0));
+  ASSERT_EQ(map.size(), 500u);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(map.containsKey(((PropertyId)(i % 7) << 32) | i), i % 2 == 1);
+  }
+
+  int count = 0;
+  long long sum = 0;
+  HashMap<PropertyId, int>::Entries entries = map.getEntries();
+  while (entries.hasNext()) {
+    HashMap<PropertyId, int>::Pair pair = entries.next();
+    ASSERT_EQ(pair.key & 0xffffffff, pair.value);
+    count++;
+    sum += pair.value;
+  }
+  ASSERT_EQ(count, 500);
+  ASSERT_EQ(sum, 250000);
+
+  HashMap<PropertyId, int> copy(map);
+  map.clear();
+  ASSERT_EQ(map.size(), 0u);
+  ASSERT_FALSE(map.containsKey(((PropertyId)1 << 32) | 1));
+  ASSERT_EQ(copy.size(), 500u);
+  ASSERT_EQ(copy[((PropertyId)1 << 32) | 1], 1);
+
+  Vector<PropertyId> ids;
+  ids.add(1);
+  ids.add(2);
+  ASSERT_TRUE(map.addAll(ids, 0));
+  ASSERT_FALSE(map.addAll(ids, 1));
+  ASSERT_EQ(map[2], 1);
+}
+
+TEST(HashMap, mix) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  AnimationStateData state_data(data);
+  state_data.setDefaultMix(0.5f);
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    for (size_t j = 0; j < animations.size(); j += 2) {
+      state_data.setMix(animations[i], animations[j], i + j * 0.01f);
+    }
+  }
+  for (size_t i = 0; i < animations.size(); i++) {
+    for (size_t j = 0; j < animations.size(); j++) {
+      ASSERT_EQ(state_data.getMix(animations[i], animations[j]), j % 2 == 0 ? i + j * 0.01f : 0.5f);
+    }
+  }
+
+  delete data;
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(HashMap, DISABLED_animations_changed) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  /*把全部动画的时间轴合成一个有几百个时间轴的动画*/
+  Vector<Timeline*> timelines;
+  for (size_t i = 0; i < data->getAnimations().size(); i++) {
+    timelines.addAll(data->getAnimations()[i]->getTimelines());
+  }
+  Animation* all = new Animation("all", timelines, 1);
+  Animation* run = data->findAnimation("run");
+
+  {
+    Skeleton skeleton(data);
+    AnimationStateData state_data(data);
+    state_data.setDefaultMix(0.2f);
+    AnimationState state(&state_data);
+    state.setAnimation(1, run, true);
+
+    /*每次切换动画后的第一次 apply 调用 animationsChanged，减去不切换时 apply 的耗时*/
+    uint32_t times = 200;
+    uint64_t cost[2] = {0, 0};
+    for (uint32_t i = 0; i < times; i++) {
+      uint64_t start = time_now_us();
+      state.setAnimation(0, i % 2 ? all : run, true);
+      state.update(0.01f);
+      state.apply(skeleton);
+      cost[0] += time_now_us() - start;
+
+      start = time_now_us();
+      state.update(0.01f);
+      state.apply(skeleton);
+      cost[1] += time_now_us() - start;
+    }
+
+    log_debug("animationsChanged with %u timelines x %u: %uus (apply with changes %uus, without %uus)\n",
+              (uint32_t)timelines.size(), times, (uint32_t)(cost[0] > cost[1] ? cost[0] - cost[1] : 0),
+              (uint32_t)cost[0], (uint32_t)cost[1]);
+  }
+
+  all->getTimelines().clear();
+  delete all;
+  delete data;
+  delete atlas;
+}
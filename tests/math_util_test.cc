@@ -0,0 +1,112 @@
+#include <math.h>
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+TEST(MathUtil, sin_cos_libm) {
+  float s = 0;
+  float c = 0;
+
+  MathUtil::setFastTrig(false);
+  for (int i = -3600; i <= 3600; i++) {
+    float radians = i * 0.1f * MathUtil::Deg_Rad;
+    MathUtil::sinCos(radians, s, c);
+    ASSERT_EQ(s, (float)::sin(radians));
+    ASSERT_EQ(c, (float)::cos(radians));
+  }
+}
+
+TEST(MathUtil, sin_cos_fast) {
+  float s = 0;
+  float c = 0;
+  double max_error = 0;
+
+  MathUtil::setFastTrig(true);
+  for (int i = -720000; i <= 720000; i++) {
+    float radians = i * 0.01f * MathUtil::Deg_Rad;
+    MathUtil::sinCos(radians, s, c);
+    max_error = tk_max(max_error, fabs(s - ::sin((double)radians)));
+    max_error = tk_max(max_error, fabs(c - ::cos((double)radians)));
+    ASSERT_EQ(s, MathUtil::sin(radians));
+    ASSERT_EQ(c, MathUtil::cos(radians));
+  }
+  ASSERT_LT(max_error, 5e-7);
+
+  /* 超出多项式的适用范围时回退到 libm。*/
+  MathUtil::sinCos(1e6f, s, c);
+  ASSERT_EQ(s, (float)::sin(1e6f));
+  ASSERT_EQ(c, (float)::cos(1e6f));
+  MathUtil::setFastTrig(false);
+
+  log_debug("fast sinCos max error: %g\n", max_error);
+}
+
+TEST(MathUtil, bone_update_fast) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton skeleton(data);
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  Vector<float> expected;
+
+  state.setAnimation(0, "run", true);
+  state.update(0.3f);
+  state.apply(skeleton);
+
+  for (int fast = 0; fast < 2; fast++) {
+    MathUtil::setFastTrig(fast != 0);
+    skeleton.updateWorldTransform(Physics_None);
+
+    Vector<Bone*>& bones = skeleton.getBones();
+    for (size_t i = 0; i < bones.size(); i++) {
+      Bone* bone = bones[i];
+      if (fast == 0) {
+        expected.add(bone->getWorldX());
+        expected.add(bone->getWorldY());
+      } else {
+        ASSERT_NEAR(bone->getWorldX(), expected[2 * i], 0.01f);
+        ASSERT_NEAR(bone->getWorldY(), expected[2 * i + 1], 0.01f);
+      }
+    }
+  }
+  MathUtil::setFastTrig(false);
+
+  delete data;
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(MathUtil, DISABLED_bone_update_bench) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton skeleton(data);
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  uint64_t cost[2] = {0, 0};
+  uint32_t times = 5000;
+
+  state.setAnimation(0, "run", true);
+  state.update(0.3f);
+  state.apply(skeleton);
+
+  for (int fast = 0; fast < 2; fast++) {
+    uint64_t start = time_now_us();
+    MathUtil::setFastTrig(fast != 0);
+    for (uint32_t n = 0; n < times; n++) {
+      skeleton.updateWorldTransform(Physics_None);
+    }
+    cost[fast] = time_now_us() - start;
+  }
+  MathUtil::setFastTrig(false);
+
+  log_debug("updateWorldTransform x %u on %d bones: libm %uus fast %uus\n", times,
+            (int)skeleton.getBones().size(), (uint32_t)cost[0], (uint32_t)cost[1]);
+
+  delete data;
+  delete atlas;
+}
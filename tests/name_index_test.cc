@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+template <typename T>
+static void check_names(SkeletonData* data, Vector<T*>& items,
+                        T* (SkeletonData::*find)(const String&)) {
+  for (size_t i = 0; i < items.size(); i++) {
+    String name(items[i]->getName().buffer());
+    ASSERT_EQ((data->*find)(name), ContainerUtil::findWithName(items, name));
+  }
+  ASSERT_TRUE((data->*find)("not-exist") == NULL);
+}
+
+TEST(NameIndex, skeleton_data) {
+  Atlas* atlas = spine_test_load_atlas();
+
+  for (int binary = 0; binary < 2; binary++) {
+    SkeletonData* data = spine_test_load_skeleton_data(atlas, binary);
+    ASSERT_TRUE(data != NULL);
+
+    check_names(data, data->getBones(), &SkeletonData::findBone);
+    check_names(data, data->getSlots(), &SkeletonData::findSlot);
+    check_names(data, data->getSkins(), &SkeletonData::findSkin);
+    check_names(data, data->getAnimations(), &SkeletonData::findAnimation);
+
+    Skeleton skeleton(data);
+    for (size_t i = 0; i < skeleton.getBones().size(); i++) {
+      Bone* bone = skeleton.getBones()[i];
+      ASSERT_EQ(skeleton.findBone(bone->getData().getName()), bone);
+    }
+    for (size_t i = 0; i < skeleton.getSlots().size(); i++) {
+      Slot* slot = skeleton.getSlots()[i];
+      ASSERT_EQ(skeleton.findSlot(slot->getData().getName()), slot);
+    }
+    ASSERT_TRUE(skeleton.findBone("not-exist") == NULL);
+    ASSERT_TRUE(skeleton.findSlot("not-exist") == NULL);
+
+    delete data;
+  }
+
+  delete atlas;
+}
+
+TEST(NameIndex, stale) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  /*列表大小变化后退回线性查找，重建后使用新的索引*/
+  Vector<Timeline*> timelines;
+  Animation* animation = new Animation("added", timelines, 1);
+  data->getAnimations().add(animation);
+  ASSERT_EQ(data->findAnimation("added"), animation);
+  data->updateNameIndex();
+  ASSERT_EQ(data->findAnimation("added"), animation);
+  ASSERT_EQ(data->findAnimation("run"), ContainerUtil::findWithName(data->getAnimations(), "run"));
+
+  data->getAnimations().removeAt(data->getAnimations().size() - 1);
+  ASSERT_TRUE(data->findAnimation("added") == NULL);
+  ASSERT_TRUE(data->findAnimation("run") != NULL);
+
+  delete animation;
+  delete data;
+  delete atlas;
+}
+
+TEST(NameIndex, duplicate) {
+  Vector<Timeline*> timelines;
+  Vector<Animation*> animations;
+  NameIndex index;
+  char name[32];
+
+  for (int i = 0; i < 100; i++) {
+    tk_snprintf(name, sizeof(name), "anim%d", i % 50);
+    animations.add(new Animation(name, timelines, 1));
+  }
+  index.build(animations);
+
+  /*重名时和线性查找一样返回第一个*/
+  for (int i = 0; i < 50; i++) {
+    tk_snprintf(name, sizeof(name), "anim%d", i);
+    ASSERT_EQ(index.findIndex(animations, name), i);
+    ASSERT_EQ(index.find(animations, name), animations[i]);
+  }
+  ASSERT_EQ(index.findIndex(animations, "anim50"), -1);
+
+  ContainerUtil::cleanUpVectorOfPointers(animations);
+}
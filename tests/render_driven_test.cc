@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+static void skeleton_pose(Skeleton& skeleton, AnimationState& state, float time) {
+  state.update(time);
+  state.apply(skeleton);
+}
+
+static void expect_same_world(Skeleton& a, Skeleton& b, bool updated_only) {
+  Vector<Bone*>& bones = a.getBones();
+  for (size_t i = 0; i < bones.size(); i++) {
+    Bone* bone = bones[i];
+    Bone* other = b.getBones()[i];
+    if (updated_only && !a.isBoneUpdated(*bone)) continue;
+    ASSERT_FLOAT_EQ(bone->getWorldX(), other->getWorldX());
+    ASSERT_FLOAT_EQ(bone->getWorldY(), other->getWorldY());
+    ASSERT_FLOAT_EQ(bone->getA(), other->getA());
+    ASSERT_FLOAT_EQ(bone->getD(), other->getD());
+  }
+}
+
+TEST(RenderDriven, visible) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton full(data);
+  Skeleton lazy(data);
+  AnimationStateData state_data(data);
+  AnimationState full_state(&state_data);
+  AnimationState lazy_state(&state_data);
+
+  lazy.setRenderDriven(true);
+  ASSERT_TRUE(lazy.isRenderDriven());
+  full_state.setAnimation(0, "run", true);
+  lazy_state.setAnimation(0, "run", true);
+
+  for (int frame = 0; frame < 20; frame++) {
+    skeleton_pose(full, full_state, 0.05f);
+    skeleton_pose(lazy, lazy_state, 0.05f);
+    full.updateWorldTransform(Physics_Update);
+    lazy.updateWorldTransform(Physics_Update);
+
+    Vector<Slot*>& slots = lazy.getSlots();
+    for (size_t i = 0; i < slots.size(); i++) {
+      Slot* slot = slots[i];
+      if (slot->getAttachment() != NULL && slot->getColor().a > 0 &&
+          !slot->getAttachment()->getRTTI().isExactly(PointAttachment::rtti) &&
+          !slot->getAttachment()->getRTTI().isExactly(BoundingBoxAttachment::rtti)) {
+        ASSERT_TRUE(lazy.isBoneUpdated(slot->getBone()));
+      }
+    }
+    expect_same_world(lazy, full, true);
+  }
+
+  delete data;
+  delete atlas;
+}
+
+TEST(RenderDriven, hidden) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton full(data);
+  Skeleton lazy(data);
+  uint32_t updated = 0;
+
+  full.updateWorldTransform(Physics_Update);
+  lazy.setRenderDriven(true);
+  lazy.getColor().a = 0;
+  lazy.updateWorldTransform(Physics_Update);
+
+  Vector<Bone*>& bones = lazy.getBones();
+  for (size_t i = 0; i < bones.size(); i++) {
+    if (lazy.isBoneUpdated(*bones[i])) updated++;
+  }
+  ASSERT_TRUE(updated < bones.size());
+
+  /*显式请求的骨骼及其父骨骼总是会被更新。*/
+  Bone* tip = lazy.findBone("gun-tip");
+  ASSERT_TRUE(tip != NULL);
+  ASSERT_FALSE(lazy.isBoneRequired(*tip));
+  lazy.setBoneRequired(*tip, true);
+  ASSERT_TRUE(lazy.isBoneRequired(*tip));
+  lazy.updateWorldTransform(Physics_Update);
+  for (Bone* bone = tip; bone != NULL; bone = bone->getParent()) {
+    ASSERT_TRUE(lazy.isBoneUpdated(*bone));
+  }
+  expect_same_world(lazy, full, true);
+
+  /*关闭后恢复完整更新。*/
+  lazy.setRenderDriven(false);
+  lazy.updateWorldTransform(Physics_Update);
+  for (size_t i = 0; i < bones.size(); i++) {
+    ASSERT_TRUE(lazy.isBoneUpdated(*bones[i]));
+  }
+  expect_same_world(lazy, full, false);
+
+  delete data;
+  delete atlas;
+}
@@ -0,0 +1,570 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+class TestSkeletonDataBuffer : public SkeletonDataBuffer {
+ public:
+  uint8_t* data;
+  uint32_t size;
+  bool_t* deleted;
+
+  TestSkeletonDataBuffer(const uint8_t* data, uint32_t size, bool_t* deleted)
+      : size(size), deleted(deleted) {
+    this->data = (uint8_t*)TKMEM_ALLOC(size);
+    memcpy(this->data, data, size);
+    *deleted = FALSE;
+  }
+
+  ~TestSkeletonDataBuffer() {
+    TKMEM_FREE(data);
+    *deleted = TRUE;
+  }
+
+  bool_t contains(const String& str) {
+    const uint8_t* p = (const uint8_t*)str.buffer();
+    return p >= data && p < data + size;
+  }
+};
+
+static void expect_same_worlds(SkeletonData* a, SkeletonData* b, const char* name) {
+  AnimationStateData state_data_a(a);
+  AnimationStateData state_data_b(b);
+  AnimationState state_a(&state_data_a);
+  AnimationState state_b(&state_data_b);
+  Skeleton skeleton_a(a);
+  Skeleton skeleton_b(b);
+
+  state_a.setAnimation(0, name, true);
+  state_b.setAnimation(0, name, true);
+  for (int frame = 0; frame < 60; frame++) {
+    state_a.update(1 / 30.0f);
+    state_a.apply(skeleton_a);
+    skeleton_a.updateWorldTransform(Physics_Update);
+    state_b.update(1 / 30.0f);
+    state_b.apply(skeleton_b);
+    skeleton_b.updateWorldTransform(Physics_Update);
+    for (size_t i = 0; i < skeleton_a.getBones().size(); i++) {
+      ASSERT_EQ(skeleton_a.getBones()[i]->getWorldX(), skeleton_b.getBones()[i]->getWorldX());
+      ASSERT_EQ(skeleton_a.getBones()[i]->getWorldY(), skeleton_b.getBones()[i]->getWorldY());
+    }
+    for (size_t i = 0; i < skeleton_a.getSlots().size(); i++) {
+      Attachment* attachment_a = skeleton_a.getSlots()[i]->getAttachment();
+      Attachment* attachment_b = skeleton_b.getSlots()[i]->getAttachment();
+      ASSERT_EQ(attachment_a == NULL, attachment_b == NULL);
+      if (attachment_a != NULL) {
+        ASSERT_TRUE(attachment_a->getName() == attachment_b->getName());
+      }
+    }
+  }
+}
+
+TEST(SkeletonBinary, in_place) {
+  bool_t deleted = FALSE;
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(data != NULL && info != NULL);
+
+  TestSkeletonDataBuffer* buffer = new TestSkeletonDataBuffer(info->data, info->size, &deleted);
+  SkeletonBinary binary(atlas);
+  SkeletonData* in_place = binary.readSkeletonData(buffer->data, buffer->size, buffer);
+  ASSERT_TRUE(in_place != NULL);
+  ASSERT_TRUE(in_place->getBuffer() == buffer);
+  ASSERT_TRUE(data->getBuffer() == NULL);
+
+  ASSERT_TRUE(data->getVersion() == in_place->getVersion());
+  ASSERT_TRUE(data->getHash() == in_place->getHash());
+  ASSERT_EQ(data->getBones().size(), in_place->getBones().size());
+  for (size_t i = 0; i < data->getBones().size(); i++) {
+    ASSERT_TRUE(data->getBones()[i]->getName() == in_place->getBones()[i]->getName());
+    ASSERT_TRUE(buffer->contains(in_place->getBones()[i]->getName()));
+  }
+  for (size_t i = 0; i < data->getSlots().size(); i++) {
+    ASSERT_TRUE(data->getSlots()[i]->getName() == in_place->getSlots()[i]->getName());
+    ASSERT_TRUE(data->getSlots()[i]->getAttachmentName() ==
+                in_place->getSlots()[i]->getAttachmentName());
+  }
+  for (size_t i = 0; i < data->getEvents().size(); i++) {
+    EventData* a = data->getEvents()[i];
+    EventData* b = in_place->getEvents()[i];
+    ASSERT_TRUE(a->getName() == b->getName());
+    ASSERT_TRUE(a->getStringValue() == b->getStringValue());
+    ASSERT_TRUE(a->getAudioPath() == b->getAudioPath());
+  }
+  ASSERT_EQ(data->getAnimations().size(), in_place->getAnimations().size());
+  for (size_t i = 0; i < data->getAnimations().size(); i++) {
+    ASSERT_TRUE(buffer->contains(in_place->getAnimations()[i]->getName()));
+    ASSERT_TRUE(in_place->findAnimation(data->getAnimations()[i]->getName()) ==
+                in_place->getAnimations()[i]);
+  }
+
+  Skin::AttachmentMap::Entries entries_a = data->getDefaultSkin()->getAttachments();
+  Skin::AttachmentMap::Entries entries_b = in_place->getDefaultSkin()->getAttachments();
+  while (entries_a.hasNext() && entries_b.hasNext()) {
+    Skin::AttachmentMap::Entry& entry_a = entries_a.next();
+    Skin::AttachmentMap::Entry& entry_b = entries_b.next();
+    ASSERT_TRUE(entry_a._name == entry_b._name);
+    if (entry_a._attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+      MeshAttachment* mesh_a = (MeshAttachment*)entry_a._attachment;
+      MeshAttachment* mesh_b = (MeshAttachment*)entry_b._attachment;
+      ASSERT_TRUE(mesh_a->getPath() == mesh_b->getPath());
+      ASSERT_EQ(mesh_a->getVertices().size(), mesh_b->getVertices().size());
+      ASSERT_EQ(mesh_a->getBones().size(), mesh_b->getBones().size());
+      ASSERT_EQ(mesh_a->getTriangles().size(), mesh_b->getTriangles().size());
+      ASSERT_EQ(mesh_a->getRegionUVs().size(), mesh_b->getRegionUVs().size());
+      ASSERT_EQ(mesh_b->getRegionUVs().getCapacity(), mesh_b->getRegionUVs().size());
+      for (size_t i = 0; i < mesh_a->getVertices().size(); i++) {
+        ASSERT_EQ(mesh_a->getVertices()[i], mesh_b->getVertices()[i]);
+      }
+      for (size_t i = 0; i < mesh_a->getUVs().size(); i++) {
+        ASSERT_EQ(mesh_a->getUVs()[i], mesh_b->getUVs()[i]);
+      }
+    }
+  }
+  ASSERT_EQ(entries_a.hasNext(), entries_b.hasNext());
+
+  expect_same_worlds(data, in_place, "run");
+  expect_same_worlds(data, in_place, "portal");
+
+  ASSERT_FALSE(deleted);
+  delete in_place;
+  ASSERT_TRUE(deleted);
+
+  asset_info_unref(info);
+  delete data;
+  delete atlas;
+}
+
+TEST(SkeletonBinary, in_place_error) {
+  bool_t deleted = FALSE;
+  Atlas* atlas = spine_test_load_atlas();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL);
+
+  /*版本号不匹配时读取失败，缓冲区也随之释放*/
+  TestSkeletonDataBuffer* buffer = new TestSkeletonDataBuffer(info->data, info->size, &deleted);
+  buffer->data[9] = '0';
+  SkeletonBinary binary(atlas);
+  ASSERT_TRUE(binary.readSkeletonData(buffer->data, buffer->size, buffer) == NULL);
+  ASSERT_FALSE(binary.getError().isEmpty());
+  ASSERT_TRUE(deleted);
+
+  asset_info_unref(info);
+  delete atlas;
+}
+
+TEST(SkeletonBinary, in_place_twice) {
+  bool_t deleted[2] = {FALSE, FALSE};
+  Atlas* atlas = spine_test_load_atlas();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL);
+
+  /*原地读取改写了缓冲区，同一块数据不能再次读取*/
+  TestSkeletonDataBuffer* buffer = new TestSkeletonDataBuffer(info->data, info->size, deleted);
+  SkeletonBinary binary(atlas);
+  SkeletonData* first = binary.readSkeletonData(buffer->data, buffer->size, buffer);
+  ASSERT_TRUE(first != NULL);
+  ASSERT_NE(memcmp(buffer->data, info->data, info->size), 0);
+  SkeletonBinary again(atlas);
+  ASSERT_TRUE(again.readSkeletonData(buffer->data, buffer->size) == NULL);
+
+  /*共享的资源每次复制一份私有的再原地读取(spine2d 加载缓存中的资源时)，资源本身不变*/
+  buffer = new TestSkeletonDataBuffer(info->data, info->size, deleted + 1);
+  SkeletonData* second = binary.readSkeletonData(buffer->data, buffer->size, buffer);
+  ASSERT_TRUE(second != NULL);
+  expect_same_worlds(first, second, "run");
+  ASSERT_TRUE(first->getBones()[1]->getName() == second->getBones()[1]->getName());
+  ASSERT_TRUE(first->getBones()[1]->getName().buffer() != second->getBones()[1]->getName().buffer());
+
+  delete first;
+  ASSERT_TRUE(deleted[0]);
+  expect_same_worlds(second, second, "walk");
+  delete second;
+  ASSERT_TRUE(deleted[1]);
+
+  asset_info_unref(info);
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(SkeletonBinary, DISABLED_load_time) {
+  Atlas* atlas = spine_test_load_atlas();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL);
+
+  bool_t deleted = FALSE;
+  uint32_t times = 50;
+  uint64_t cost[2] = {0, 0};
+  for (uint32_t i = 0; i < times; i++) {
+    SkeletonBinary binary(atlas);
+    uint64_t start = time_now_us();
+    delete binary.readSkeletonData(info->data, info->size);
+    cost[0] += time_now_us() - start;
+
+    TestSkeletonDataBuffer* buffer = new TestSkeletonDataBuffer(info->data, info->size, &deleted);
+    start = time_now_us();
+    delete binary.readSkeletonData(buffer->data, buffer->size, buffer);
+    cost[1] += time_now_us() - start;
+  }
+
+  log_debug("load %s x %u: copy %uus in place %uus\n", SPINE_TEST_SKEL, times, (uint32_t)cost[0],
+            (uint32_t)cost[1]);
+
+  asset_info_unref(info);
+  delete atlas;
+}
+
+static SkeletonData* load_lazy(Atlas* atlas, asset_info_t* info, bool_t* deleted) {
+  TestSkeletonDataBuffer* buffer = new TestSkeletonDataBuffer(info->data, info->size, deleted);
+  SkeletonBinary binary(atlas);
+  binary.setLazyAnimations(true);
+  return binary.readSkeletonData(buffer->data, buffer->size, buffer);
+}
+
+TEST(SkeletonBinary, lazy_animations) {
+  bool_t deleted = FALSE;
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(data != NULL && info != NULL);
+
+  SkeletonData* lazy = load_lazy(atlas, info, &deleted);
+  ASSERT_TRUE(lazy != NULL);
+  Vector<Animation*>& animations = lazy->getAnimations();
+  ASSERT_EQ(animations.size(), data->getAnimations().size());
+  for (size_t i = 0; i < animations.size(); i++) {
+    ASSERT_FALSE(animations[i]->isLoaded());
+    ASSERT_TRUE(animations[i]->getName() == data->getAnimations()[i]->getName());
+  }
+
+  /*查找动画不解码，播放时才解码*/
+  Animation* run = lazy->findAnimation("run");
+  ASSERT_TRUE(run != NULL);
+  ASSERT_FALSE(run->isLoaded());
+  expect_same_worlds(data, lazy, "run");
+  ASSERT_TRUE(run->isLoaded());
+  ASSERT_FALSE(lazy->findAnimation("walk")->isLoaded());
+
+  /*跳过动画数据后的偏移必须正确，每个动画解码的结果都和直接读取的相同*/
+  for (size_t i = 0; i < animations.size(); i++) {
+    Animation* expected = data->getAnimations()[i];
+    ASSERT_EQ(animations[i]->getDuration(), expected->getDuration());
+    ASSERT_EQ(animations[i]->getTimelines().size(), expected->getTimelines().size());
+    for (size_t t = 0; t < expected->getTimelines().size(); t++) {
+      Timeline* a = expected->getTimelines()[t];
+      Timeline* b = animations[i]->getTimelines()[t];
+      ASSERT_TRUE(a->getRTTI().isExactly(b->getRTTI()));
+      ASSERT_EQ(a->getFrames().size(), b->getFrames().size());
+      for (size_t f = 0; f < a->getFrames().size(); f++) {
+        ASSERT_EQ(a->getFrames()[f], b->getFrames()[f]);
+      }
+    }
+  }
+
+  /*释放后再次用到时重新解码*/
+  run->unload();
+  ASSERT_FALSE(run->isLoaded());
+  expect_same_worlds(data, lazy, "run");
+
+  /*直接读取的动画不能释放*/
+  data->findAnimation("run")->unload();
+  ASSERT_TRUE(data->findAnimation("run")->isLoaded());
+
+  /*同一个资源再加载一次(各自复制一份)，两份互不影响*/
+  bool_t deleted_again = FALSE;
+  SkeletonData* again = load_lazy(atlas, info, &deleted_again);
+  ASSERT_TRUE(again != NULL);
+  ASSERT_FALSE(again->findAnimation("run")->isLoaded());
+  delete lazy;
+  ASSERT_TRUE(deleted);
+  expect_same_worlds(data, again, "run");
+  expect_same_worlds(data, again, "walk");
+
+  delete again;
+  ASSERT_TRUE(deleted_again);
+  asset_info_unref(info);
+  delete data;
+  delete atlas;
+}
+
+/*播放到指定时间，返回骨骼的世界坐标*/
+static void pose_at(SkeletonData* data, const char* name, float time, Vector<float>& worlds) {
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  Skeleton skeleton(data);
+
+  state.setAnimation(0, name, true);
+  state.update(time);
+  state.apply(skeleton);
+  skeleton.updateWorldTransform(Physics_None);
+  worlds.clear();
+  for (size_t i = 0; i < skeleton.getBones().size(); i++) {
+    worlds.add(skeleton.getBones()[i]->getWorldX());
+    worlds.add(skeleton.getBones()[i]->getWorldY());
+  }
+}
+
+TEST(SkeletonBinary, lazy_baked) {
+  bool_t deleted = FALSE;
+  Vector<float> exact;
+  Vector<float> baked;
+  Vector<float> reloaded;
+  Atlas* atlas = spine_test_load_atlas();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL);
+
+  SkeletonData* lazy = load_lazy(atlas, info, &deleted);
+  ASSERT_TRUE(lazy != NULL);
+  Animation* walk = lazy->findAnimation("walk");
+  pose_at(lazy, "walk", 0.37f, exact);
+
+  /*采样率很低，烘焙的结果和原始动画有明显差别*/
+  BakedAnimation* samples = walk->bake(*lazy, 5);
+  pose_at(lazy, "walk", 0.37f, baked);
+  ASSERT_FALSE(baked == exact);
+
+  /*释放时间线后保留烘焙数据，重新解码后仍然按烘焙数据播放*/
+  walk->unload();
+  ASSERT_FALSE(walk->isLoaded());
+  ASSERT_TRUE(walk->getBaked() == samples);
+  pose_at(lazy, "walk", 0.37f, reloaded);
+  ASSERT_TRUE(walk->isLoaded());
+  ASSERT_TRUE(reloaded == baked);
+
+  walk->clearBaked();
+  pose_at(lazy, "walk", 0.37f, reloaded);
+  ASSERT_TRUE(reloaded == exact);
+
+  delete lazy;
+  ASSERT_TRUE(deleted);
+  asset_info_unref(info);
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(SkeletonBinary, DISABLED_lazy_load_time) {
+  bool_t deleted = FALSE;
+  Atlas* atlas = spine_test_load_atlas();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL);
+
+  uint32_t times = 50;
+  uint64_t cost[2] = {0, 0};
+  for (uint32_t i = 0; i < times; i++) {
+    SkeletonBinary binary(atlas);
+    uint64_t start = time_now_us();
+    delete binary.readSkeletonData(info->data, info->size);
+    cost[0] += time_now_us() - start;
+
+    start = time_now_us();
+    SkeletonData* lazy = load_lazy(atlas, info, &deleted);
+    lazy->findAnimation("portal")->getDuration();
+    lazy->findAnimation("run")->getDuration();
+    delete lazy;
+    cost[1] += time_now_us() - start;
+  }
+
+  log_debug("load %s x %u: all animations %uus, lazy portal and run %uus\n", SPINE_TEST_SKEL, times,
+            (uint32_t)cost[0], (uint32_t)cost[1]);
+
+  asset_info_unref(info);
+  delete atlas;
+}
+
+static SkeletonData* read_binary(Atlas* atlas, Vector<unsigned char>& binary) {
+  SkeletonBinary reader(atlas);
+  reader.setCompactCurves(true);
+  return reader.readSkeletonData(binary.buffer(), (int)binary.size());
+}
+
+static void expect_same_timelines(SkeletonData* a, SkeletonData* b) {
+  ASSERT_EQ(a->getAnimations().size(), b->getAnimations().size());
+  for (size_t i = 0; i < a->getAnimations().size(); i++) {
+    Vector<Timeline*>& timelines_a = a->getAnimations()[i]->getTimelines();
+    Vector<Timeline*>& timelines_b = b->getAnimations()[i]->getTimelines();
+    ASSERT_TRUE(a->getAnimations()[i]->getName() == b->getAnimations()[i]->getName());
+    ASSERT_EQ(a->getAnimations()[i]->getDuration(), b->getAnimations()[i]->getDuration());
+    ASSERT_EQ(timelines_a.size(), timelines_b.size());
+
+    /*写出时按骨骼、槽位分组，顺序可能不同，按属性找对应的时间轴*/
+    for (size_t t = 0; t < timelines_a.size(); t++) {
+      Timeline* timeline_a = timelines_a[t];
+      Timeline* timeline_b = NULL;
+      for (size_t n = 0; n < timelines_b.size() && timeline_b == NULL; n++) {
+        if (!timelines_b[n]->getRTTI().isExactly(timeline_a->getRTTI())) continue;
+        if (timeline_a->getRTTI().isExactly(DeformTimeline::rtti)) {
+          DeformTimeline* deform_a = (DeformTimeline*)timeline_a;
+          DeformTimeline* deform_b = (DeformTimeline*)timelines_b[n];
+          if (deform_a->getSlotIndex() == deform_b->getSlotIndex() &&
+              deform_a->getAttachment()->getName() == deform_b->getAttachment()->getName()) {
+            timeline_b = timelines_b[n];
+          }
+        } else if (timelines_b[n]->getPropertyIds()[0] == timeline_a->getPropertyIds()[0]) {
+          timeline_b = timelines_b[n];
+        }
+      }
+      ASSERT_TRUE(timeline_b != NULL) << timeline_a->getRTTI().getClassName();
+
+      bool_t color = timeline_a->getRTTI().instanceOf(RGBATimeline::rtti) ||
+                     timeline_a->getRTTI().instanceOf(RGBTimeline::rtti) ||
+                     timeline_a->getRTTI().instanceOf(AlphaTimeline::rtti);
+      ASSERT_EQ(timeline_a->getFrames().size(), timeline_b->getFrames().size());
+      for (size_t f = 0; f < timeline_a->getFrames().size(); f++) {
+        if (color && f % timeline_a->getFrameEntries() != 0) {
+          ASSERT_NEAR(timeline_a->getFrames()[f], timeline_b->getFrames()[f], 1e-6);
+        } else {
+          ASSERT_EQ(timeline_a->getFrames()[f], timeline_b->getFrames()[f]);
+        }
+      }
+
+      if (timeline_a->getRTTI().instanceOf(CurveTimeline::rtti)) {
+        Vector<float>& curves_a = ((CurveTimeline*)timeline_a)->getCurves();
+        Vector<float>& curves_b = ((CurveTimeline*)timeline_b)->getCurves();
+        ASSERT_EQ(curves_a.size(), curves_b.size());
+        for (size_t c = 0; c < curves_a.size(); c++) {
+          ASSERT_EQ(curves_a[c], curves_b[c]);
+        }
+      }
+
+      if (timeline_a->getRTTI().isExactly(DeformTimeline::rtti)) {
+        Vector<Vector<float> >& vertices_a = ((DeformTimeline*)timeline_a)->getVertices();
+        Vector<Vector<float> >& vertices_b = ((DeformTimeline*)timeline_b)->getVertices();
+        for (size_t f = 0; f < vertices_a.size(); f++) {
+          ASSERT_EQ(vertices_a[f].size(), vertices_b[f].size());
+          for (size_t v = 0; v < vertices_a[f].size(); v++) {
+            ASSERT_NEAR(vertices_a[f][v], vertices_b[f][v], 1e-3);
+          }
+        }
+      }
+
+      if (timeline_a->getRTTI().isExactly(AttachmentTimeline::rtti)) {
+        Vector<String>& names_a = ((AttachmentTimeline*)timeline_a)->getAttachmentNames();
+        Vector<String>& names_b = ((AttachmentTimeline*)timeline_b)->getAttachmentNames();
+        for (size_t f = 0; f < names_a.size(); f++) {
+          ASSERT_TRUE(names_a[f] == names_b[f]);
+        }
+      }
+    }
+  }
+}
+
+TEST(SkeletonBinary, write) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* json = spine_test_load_skeleton_data(atlas, FALSE, TRUE);
+  ASSERT_TRUE(json != NULL);
+
+  Vector<unsigned char> binary;
+  SkeletonBinary writer(atlas);
+  ASSERT_TRUE(writer.writeSkeletonData(json, binary));
+  SkeletonData* data = read_binary(atlas, binary);
+  ASSERT_TRUE(data != NULL) << writer.getError().buffer();
+
+  ASSERT_TRUE(data->getVersion() == json->getVersion());
+  ASSERT_EQ(data->getBones().size(), json->getBones().size());
+  ASSERT_EQ(data->getSlots().size(), json->getSlots().size());
+  ASSERT_EQ(data->getSkins().size(), json->getSkins().size());
+  ASSERT_EQ(data->getEvents().size(), json->getEvents().size());
+  ASSERT_EQ(data->getIkConstraints().size(), json->getIkConstraints().size());
+  ASSERT_EQ(data->getTransformConstraints().size(), json->getTransformConstraints().size());
+  ASSERT_EQ(data->getPathConstraints().size(), json->getPathConstraints().size());
+  ASSERT_EQ(data->getPhysicsConstraints().size(), json->getPhysicsConstraints().size());
+  for (size_t i = 0; i < json->getSlots().size(); i++) {
+    ASSERT_TRUE(data->getSlots()[i]->getAttachmentName() == json->getSlots()[i]->getAttachmentName());
+  }
+  expect_same_timelines(json, data);
+  for (size_t i = 0; i < json->getAnimations().size(); i++) {
+    expect_same_worlds(json, data, json->getAnimations()[i]->getName().buffer());
+  }
+
+  /*写出的数据再次读写，结果不变*/
+  Vector<unsigned char> again;
+  ASSERT_TRUE(writer.writeSkeletonData(data, again));
+  ASSERT_EQ(again.size(), binary.size());
+  ASSERT_EQ(memcmp(again.buffer(), binary.buffer(), binary.size()), 0);
+
+  /*从 skel 读取的数据写出后也一样，只是去掉了非必需的数据*/
+  SkeletonData* skel = spine_test_load_skeleton_data(atlas, TRUE, TRUE);
+  ASSERT_TRUE(skel != NULL);
+  ASSERT_TRUE(writer.writeSkeletonData(skel, again));
+  SkeletonData* skel_again = read_binary(atlas, again);
+  ASSERT_TRUE(skel_again != NULL);
+  expect_same_timelines(skel, skel_again);
+
+  log_debug("write %s: %u bytes, %s: %u bytes\n", SPINE_TEST_JSON, (uint32_t)binary.size(),
+            SPINE_TEST_SKEL, (uint32_t)again.size());
+
+  delete skel_again;
+  delete skel;
+  delete data;
+  delete json;
+  delete atlas;
+}
+
+TEST(SkeletonBinary, write_stripped) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* json = spine_test_load_skeleton_data(atlas, FALSE, TRUE);
+  ASSERT_TRUE(json != NULL);
+
+  /*只保留一个动画，写出后再放回去由骨架数据释放*/
+  Vector<Animation*> animations;
+  Animation* run = json->findAnimation("run");
+  animations.addAll(json->getAnimations());
+  json->getAnimations().clear();
+  json->getAnimations().add(run);
+
+  Vector<unsigned char> binary;
+  SkeletonBinary writer(atlas);
+  bool written = writer.writeSkeletonData(json, binary);
+  json->getAnimations().clear();
+  json->getAnimations().addAll(animations);
+  ASSERT_TRUE(written);
+
+  SkeletonData* data = read_binary(atlas, binary);
+  ASSERT_TRUE(data != NULL);
+  ASSERT_EQ(data->getAnimations().size(), 1u);
+  ASSERT_TRUE(data->findAnimation("run") != NULL);
+  expect_same_worlds(json, data, "run");
+
+  delete data;
+  delete json;
+  delete atlas;
+}
+
+TEST(SkeletonBinary, write_error) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* json = spine_test_load_skeleton_data(atlas, FALSE, FALSE);
+  ASSERT_TRUE(json != NULL);
+
+  /*曲线没有以控制点保存时无法写出*/
+  Vector<unsigned char> binary;
+  SkeletonBinary writer(atlas);
+  ASSERT_FALSE(writer.writeSkeletonData(json, binary));
+  ASSERT_FALSE(writer.getError().isEmpty());
+
+  delete json;
+  delete atlas;
+}
+
+TEST(String, borrow) {
+  char chars[] = "spineboy";
+  String borrowed(chars, true, false);
+  String copy(borrowed);
+  String assigned;
+  assigned = borrowed;
+
+  ASSERT_TRUE(copy.buffer() == chars);
+  ASSERT_TRUE(assigned.buffer() == chars);
+
+  copy.append("-pro");
+  ASSERT_TRUE(copy.buffer() != chars);
+  ASSERT_STREQ(copy.buffer(), "spineboy-pro");
+  ASSERT_STREQ(chars, "spineboy");
+
+  String owned("run");
+  String owned_copy(owned);
+  ASSERT_TRUE(owned_copy.buffer() != owned.buffer());
+  assigned = owned;
+  ASSERT_TRUE(assigned.buffer() != owned.buffer());
+  ASSERT_TRUE(assigned == owned);
+}
@@ -0,0 +1,235 @@
+#include <math.h>
+#include <string>
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include <spine/Debug.h>
+
+using namespace spine;
+
+static SkeletonData* load_json(Atlas* atlas, const char* json, bool streaming) {
+  SkeletonJson reader(atlas);
+  reader.setStreaming(streaming);
+  return reader.readSkeletonData(json);
+}
+
+static std::string load_json_text(void) {
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_JSON);
+  return_value_if_fail(info != NULL, std::string());
+
+  std::string json((const char*)info->data, info->size);
+  asset_info_unref(info);
+
+  return json;
+}
+
+static void expect_same_data(SkeletonData* a, SkeletonData* b) {
+  ASSERT_EQ(a->getBones().size(), b->getBones().size());
+  for (size_t i = 0; i < a->getBones().size(); i++) {
+    ASSERT_TRUE(a->getBones()[i]->getName() == b->getBones()[i]->getName());
+    ASSERT_EQ(a->getBones()[i]->getX(), b->getBones()[i]->getX());
+    ASSERT_EQ(a->getBones()[i]->getRotation(), b->getBones()[i]->getRotation());
+  }
+  ASSERT_EQ(a->getSlots().size(), b->getSlots().size());
+  ASSERT_EQ(a->getSkins().size(), b->getSkins().size());
+  ASSERT_EQ(a->getEvents().size(), b->getEvents().size());
+
+  ASSERT_EQ(a->getAnimations().size(), b->getAnimations().size());
+  for (size_t i = 0; i < a->getAnimations().size(); i++) {
+    Animation* animation_a = a->getAnimations()[i];
+    Animation* animation_b = b->getAnimations()[i];
+    ASSERT_TRUE(animation_a->getName() == animation_b->getName());
+    ASSERT_TRUE(b->findAnimation(animation_a->getName()) == animation_b);
+    ASSERT_EQ(animation_a->getDuration(), animation_b->getDuration());
+    ASSERT_EQ(animation_a->getTimelines().size(), animation_b->getTimelines().size());
+    for (size_t t = 0; t < animation_a->getTimelines().size(); t++) {
+      Timeline* timeline_a = animation_a->getTimelines()[t];
+      Timeline* timeline_b = animation_b->getTimelines()[t];
+      ASSERT_TRUE(timeline_a->getRTTI().isExactly(timeline_b->getRTTI()));
+      ASSERT_EQ(timeline_a->getFrames().size(), timeline_b->getFrames().size());
+      for (size_t f = 0; f < timeline_a->getFrames().size(); f++) {
+        ASSERT_EQ(timeline_a->getFrames()[f], timeline_b->getFrames()[f]);
+      }
+    }
+  }
+}
+
+TEST(SkeletonJson, streaming) {
+  Atlas* atlas = spine_test_load_atlas();
+  std::string json = load_json_text();
+  ASSERT_FALSE(json.empty());
+
+  SkeletonData* data = load_json(atlas, json.c_str(), false);
+  SkeletonData* streamed = load_json(atlas, json.c_str(), true);
+  ASSERT_TRUE(data != NULL && streamed != NULL);
+  expect_same_data(data, streamed);
+  ASSERT_EQ(streamed->getAnimations().getCapacity(), streamed->getAnimations().size());
+
+  /*动画在其引用的皮肤和事件之前也能读取*/
+  size_t pos = json.find(",\n\"animations\"");
+  size_t end = json.rfind('}');
+  ASSERT_TRUE(pos != std::string::npos && end != std::string::npos);
+  std::string reordered = "{" + json.substr(pos + 2, end - pos - 2) + "," + json.substr(1, pos - 1) + "}";
+  SkeletonData* reordered_data = load_json(atlas, reordered.c_str(), true);
+  ASSERT_TRUE(reordered_data != NULL);
+  expect_same_data(data, reordered_data);
+
+  delete reordered_data;
+  delete streamed;
+  delete data;
+  delete atlas;
+}
+
+TEST(SkeletonJson, streaming_error) {
+  Atlas* atlas = spine_test_load_atlas();
+  std::string json = load_json_text();
+  SkeletonJson reader(atlas);
+
+  /*动画数据不完整*/
+  std::string truncated = json.substr(0, json.size() * 9 / 10);
+  ASSERT_TRUE(reader.readSkeletonData(truncated.c_str()) == NULL);
+  ASSERT_FALSE(reader.getError().isEmpty());
+
+  /*动画引用了不存在的骨骼*/
+  std::string unknown = json;
+  size_t pos = unknown.find("\"bones\": {", unknown.find("\"animations\""));
+  ASSERT_TRUE(pos != std::string::npos);
+  unknown.insert(pos + 10, "\"nobody\": { \"rotate\": [ { \"value\": 1 } ] },");
+  ASSERT_TRUE(reader.readSkeletonData(unknown.c_str()) == NULL);
+  ASSERT_STREQ(reader.getError().buffer(), "Bone not found: nobody");
+
+  /*键不是字符串或者键后面没有冒号*/
+  const char* bad_keys[] = {"{\"a\" 1}", "{1: 2}", "{\"skeleton\": {\"spine\" \"4.2\"}}",
+                            "{\"skeleton\": {}, \"animations\": {\"run\": {}, walk: {}}}"};
+  for (uint32_t i = 0; i < ARRAY_SIZE(bad_keys); i++) {
+    const char* deferred = NULL;
+    ASSERT_TRUE(Json::parse(bad_keys[i], NULL, &deferred) == NULL) << bad_keys[i];
+    ASSERT_TRUE(Json::getError() != NULL) << bad_keys[i];
+    ASSERT_TRUE(reader.readSkeletonData(bad_keys[i]) == NULL) << bad_keys[i];
+    ASSERT_FALSE(reader.getError().isEmpty()) << bad_keys[i];
+  }
+
+  delete atlas;
+}
+
+TEST(Json, parse_number) {
+  const char* numbers[] = {"0",        "-0",         "1",          "0.5",        "-12.75",
+                           "247.27",   "-188.63",    "0.0333",     "0.00001",    "1e3",
+                           "2.5E-2",   "-1.5e+2",    "3.4028234e38", "123456789", "0.1234567",
+                           "1.17549435e-38", "12345678901234567890123", "0.333333333333333333333"};
+
+  for (uint32_t i = 0; i < ARRAY_SIZE(numbers); i++) {
+    std::string text = std::string("{\"value\": ") + numbers[i] + "}";
+    Json json(text.c_str());
+    ASSERT_EQ(Json::getFloat(&json, "value", -1), (float)strtod(numbers[i], NULL)) << numbers[i];
+    if (fabs(strtod(numbers[i], NULL)) < 1e9) {
+      ASSERT_EQ(Json::getInt(&json, "value", -1), (int)strtod(numbers[i], NULL)) << numbers[i];
+    }
+  }
+}
+
+/*记录分配过的内存峰值*/
+class PeakMemoryExtension : public DebugExtension {
+ public:
+  PeakMemoryExtension(SpineExtension* extension) : DebugExtension(extension), peak(0) {
+    clearAllocations();
+  }
+
+  size_t peak;
+
+  virtual void* _alloc(size_t size, const char* file, int line) {
+    void* result = DebugExtension::_alloc(size, file, line);
+    peak = tk_max(peak, getUsedMemory());
+    return result;
+  }
+
+  virtual void* _calloc(size_t size, const char* file, int line) {
+    void* result = DebugExtension::_calloc(size, file, line);
+    peak = tk_max(peak, getUsedMemory());
+    return result;
+  }
+
+  virtual void* _realloc(void* ptr, size_t size, const char* file, int line) {
+    void* result = DebugExtension::_realloc(ptr, size, file, line);
+    peak = tk_max(peak, getUsedMemory());
+    return result;
+  }
+};
+
+typedef SkeletonData* (*load_func_t)(Atlas* atlas, const std::string& data);
+
+static SkeletonData* load_json_dom(Atlas* atlas, const std::string& data) {
+  return load_json(atlas, data.c_str(), false);
+}
+
+static SkeletonData* load_json_streaming(Atlas* atlas, const std::string& data) {
+  return load_json(atlas, data.c_str(), true);
+}
+
+static SkeletonData* load_binary(Atlas* atlas, const std::string& data) {
+  SkeletonBinary reader(atlas);
+  return reader.readSkeletonData((const unsigned char*)data.data(), (int)data.size());
+}
+
+/*读取过程中的内存峰值和读取完成后数据占用的内存*/
+static void measure_memory(Atlas* atlas, const std::string& data, load_func_t load,
+                           size_t* peak, size_t* used) {
+  SpineExtension* extension = SpineExtension::getInstance();
+  PeakMemoryExtension* debug = new PeakMemoryExtension(extension);
+
+  SpineExtension::setInstance(debug);
+  SkeletonData* skeleton_data = load(atlas, data);
+  *peak = debug->peak;
+  *used = debug->getUsedMemory();
+  delete skeleton_data;
+  SpineExtension::setInstance(extension);
+
+  delete debug;
+}
+
+TEST(SkeletonJson, streaming_memory) {
+  Atlas* atlas = spine_test_load_atlas();
+  std::string json = load_json_text();
+  ASSERT_FALSE(json.empty());
+
+  size_t used = 0;
+  size_t peaks[2] = {0, 0};
+  measure_memory(atlas, json, load_json_dom, peaks, &used);
+  measure_memory(atlas, json, load_json_streaming, peaks + 1, &used);
+
+  /*流式读取不建立整个文件的 DOM，读取过程中的内存峰值不到一半*/
+  ASSERT_LT(peaks[1], peaks[0] / 2);
+
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(SkeletonJson, DISABLED_load_benchmark) {
+  Atlas* atlas = spine_test_load_atlas();
+  std::string json = load_json_text();
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_SKEL);
+  ASSERT_TRUE(info != NULL && !json.empty());
+  std::string skel((const char*)info->data, info->size);
+  asset_info_unref(info);
+
+  const char* names[] = {"json", "json streaming", "skel"};
+  load_func_t loads[] = {load_json_dom, load_json_streaming, load_binary};
+  const std::string* inputs[] = {&json, &json, &skel};
+  size_t peaks[ARRAY_SIZE(loads)];
+
+  uint32_t times = 20;
+  for (uint32_t i = 0; i < ARRAY_SIZE(loads); i++) {
+    size_t used = 0;
+    uint64_t start = time_now_us();
+    for (uint32_t n = 0; n < times; n++) {
+      delete loads[i](atlas, *inputs[i]);
+    }
+    uint64_t cost = time_now_us() - start;
+
+    measure_memory(atlas, *inputs[i], loads[i], peaks + i, &used);
+    log_debug("load %s (%u bytes) as %s x %u: %uus, peak heap %u bytes, data %u bytes\n",
+              i == 2 ? SPINE_TEST_SKEL : SPINE_TEST_JSON, (uint32_t)inputs[i]->size(), names[i],
+              times, (uint32_t)cost, (uint32_t)peaks[i], (uint32_t)used);
+  }
+
+  delete atlas;
+}
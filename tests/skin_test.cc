@@ -0,0 +1,242 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+/*原来的查找方式：逐个比较名字*/
+static Attachment* find_linear(Skin* skin, size_t slot_index, const String& name) {
+  Skin::AttachmentMap::Entries entries = skin->getAttachments();
+  while (entries.hasNext()) {
+    Skin::AttachmentMap::Entry& entry = entries.next();
+    if (entry._slotIndex == slot_index && entry._name == name) {
+      return entry._attachment;
+    }
+  }
+
+  return NULL;
+}
+
+TEST(Skin, hashed_lookup) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skin* skin = data->getDefaultSkin();
+  Skin::AttachmentMap::Entries entries = skin->getAttachments();
+  while (entries.hasNext()) {
+    Skin::AttachmentMap::Entry& entry = entries.next();
+    ASSERT_EQ(entry._hash, NameIndex::hashName(entry._name));
+    ASSERT_TRUE(skin->getAttachment(entry._slotIndex, entry._name) == entry._attachment);
+    ASSERT_TRUE(skin->getAttachment(entry._slotIndex, entry._name, entry._hash) ==
+                find_linear(skin, entry._slotIndex, entry._name));
+  }
+
+  ASSERT_TRUE(skin->getAttachment(0, "nobody") == NULL);
+  ASSERT_TRUE(skin->getAttachment(data->getSlots().size() + 1, "eye") == NULL);
+
+  delete data;
+  delete atlas;
+}
+
+TEST(Skin, put_remove) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Vector<Attachment*> attachments;
+  data->getDefaultSkin()->findAttachmentsForSlot(data->findSlot("head")->getIndex(), attachments);
+  data->getDefaultSkin()->findAttachmentsForSlot(data->findSlot("eye")->getIndex(), attachments);
+  ASSERT_TRUE(attachments.size() >= 2);
+
+  Skin* skin = new Skin("test");
+  skin->setAttachment(3, "a", attachments[0]);
+  skin->setAttachment(3, "b", attachments[1]);
+  ASSERT_TRUE(skin->getAttachment(3, "a") == attachments[0]);
+  ASSERT_TRUE(skin->getAttachment(3, "b") == attachments[1]);
+
+  /*同名替换*/
+  skin->setAttachment(3, "a", attachments[1]);
+  ASSERT_TRUE(skin->getAttachment(3, "a") == attachments[1]);
+  ASSERT_TRUE(skin->getAttachment(3, "a", NameIndex::hashName("a")) == attachments[1]);
+
+  skin->removeAttachment(3, "a");
+  ASSERT_TRUE(skin->getAttachment(3, "a") == NULL);
+  ASSERT_TRUE(skin->getAttachment(3, "b") == attachments[1]);
+
+  /*换上自定义皮肤后，骨架先查它再查默认皮肤*/
+  Skeleton skeleton(data);
+  skeleton.setSkin(skin);
+  ASSERT_TRUE(skeleton.getAttachment(3, "b") == attachments[1]);
+  ASSERT_TRUE(skeleton.getAttachment(3, "b", NameIndex::hashName("b")) == attachments[1]);
+  Slot* slot = skeleton.getSlots()[0];
+  String name = slot->getData().getAttachmentName();
+  if (!name.isEmpty()) {
+    ASSERT_TRUE(skeleton.getAttachment(0, name, NameIndex::hashName(name)) ==
+                data->getDefaultSkin()->getAttachment(0, name));
+  }
+  ASSERT_TRUE(skeleton.getAttachment(3, "") == NULL);
+
+  skeleton.setSkin(NULL);
+  delete skin;
+  delete data;
+  delete atlas;
+}
+
+TEST(Skin, timeline_hashes) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, FALSE);
+  ASSERT_TRUE(data != NULL);
+
+  uint32_t count = 0;
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    Vector<Timeline*>& timelines = animations[i]->getTimelines();
+    for (size_t t = 0; t < timelines.size(); t++) {
+      if (!timelines[t]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+
+      AttachmentTimeline* timeline = (AttachmentTimeline*)timelines[t];
+      Vector<String>& names = timeline->getAttachmentNames();
+      ASSERT_EQ(names.size(), timeline->getAttachmentHashes().size());
+      for (size_t f = 0; f < names.size(); f++) {
+        ASSERT_EQ(timeline->getAttachmentHashes()[f], NameIndex::hashName(names[f]));
+      }
+      count++;
+    }
+  }
+  ASSERT_TRUE(count > 0);
+
+  AttachmentTimeline timeline(2, 0);
+  timeline.setFrame(1, 0.5f, "eye-surprised");
+  ASSERT_EQ(timeline.getAttachmentHashes()[0], NameIndex::hashName(String()));
+  ASSERT_EQ(timeline.getAttachmentHashes()[1], NameIndex::hashName("eye-surprised"));
+
+  delete data;
+  delete atlas;
+}
+
+/*皮肤、槽位和时间轴里相同的附件名共享同一份字符*/
+static void expect_interned(SkeletonData* data) {
+  Skin* skin = data->getDefaultSkin();
+  uint32_t shared = 0;
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    Vector<Timeline*>& timelines = animations[i]->getTimelines();
+    for (size_t t = 0; t < timelines.size(); t++) {
+      if (!timelines[t]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+
+      AttachmentTimeline* timeline = (AttachmentTimeline*)timelines[t];
+      Vector<String>& names = timeline->getAttachmentNames();
+      for (size_t f = 0; f < names.size(); f++) {
+        Skin::AttachmentMap::Entries entries = skin->getAttachments();
+        while (entries.hasNext()) {
+          Skin::AttachmentMap::Entry& entry = entries.next();
+          if (entry._slotIndex == (size_t)timeline->getSlotIndex() && entry._name == names[f]) {
+            ASSERT_TRUE(entry._name.buffer() == names[f].buffer());
+            shared++;
+          }
+        }
+      }
+    }
+  }
+  ASSERT_TRUE(shared > 0);
+
+  for (size_t i = 0; i < data->getSlots().size(); i++) {
+    SlotData* slot = data->getSlots()[i];
+    const String& name = slot->getAttachmentName();
+    Skin::AttachmentMap::Entries entries = skin->getAttachments();
+    while (entries.hasNext()) {
+      Skin::AttachmentMap::Entry& entry = entries.next();
+      if (entry._name == name) {
+        ASSERT_TRUE(entry._name.buffer() == name.buffer());
+      }
+    }
+  }
+}
+
+TEST(Skin, interned_names) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* binary = spine_test_load_skeleton_data(atlas, TRUE);
+  SkeletonData* json = spine_test_load_skeleton_data(atlas, FALSE);
+  ASSERT_TRUE(binary != NULL && json != NULL);
+
+  expect_interned(binary);
+  expect_interned(json);
+
+  delete json;
+  delete binary;
+  delete atlas;
+}
+
+/*按槽位分桶、逐个比较名字，即原来的查找方式*/
+static Attachment* find_in_bucket(Vector<Skin::AttachmentMap::Entry>& bucket, const String& name) {
+  for (size_t i = 0; i < bucket.size(); i++) {
+    if (bucket[i]._name == name) return bucket[i]._attachment;
+  }
+
+  return NULL;
+}
+
+/*时间轴切换附件时的查找：原来用各自复制的名字逐个比较，现在用共享的名字和预先算好的哈希*/
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(Skin, DISABLED_lookup_benchmark) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, FALSE);
+  ASSERT_TRUE(data != NULL);
+
+  Skin* skin = data->getDefaultSkin();
+  Vector<Vector<Skin::AttachmentMap::Entry> > buckets;
+  buckets.setSize(data->getSlots().size(), Vector<Skin::AttachmentMap::Entry>());
+  Skin::AttachmentMap::Entries iter = skin->getAttachments();
+  while (iter.hasNext()) {
+    Skin::AttachmentMap::Entry& entry = iter.next();
+    buckets[entry._slotIndex].add(Skin::AttachmentMap::Entry(entry._slotIndex, entry._name.buffer(),
+                                                             entry._attachment));
+  }
+
+  Vector<size_t> slots;
+  Vector<String> names;
+  Vector<String> copies;
+  Vector<unsigned int> hashes;
+  Vector<Animation*>& animations = data->getAnimations();
+  for (size_t i = 0; i < animations.size(); i++) {
+    Vector<Timeline*>& timelines = animations[i]->getTimelines();
+    for (size_t t = 0; t < timelines.size(); t++) {
+      if (!timelines[t]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+
+      AttachmentTimeline* timeline = (AttachmentTimeline*)timelines[t];
+      for (size_t f = 0; f < timeline->getAttachmentNames().size(); f++) {
+        if (timeline->getAttachmentNames()[f].isEmpty()) continue;
+        slots.add(timeline->getSlotIndex());
+        names.add(timeline->getAttachmentNames()[f]);
+        copies.add(String(timeline->getAttachmentNames()[f].buffer()));
+        hashes.add(timeline->getAttachmentHashes()[f]);
+      }
+    }
+  }
+  ASSERT_TRUE(names.size() > 0);
+
+  uint32_t times = 2000;
+  uint32_t found[2] = {0, 0};
+  uint64_t start = time_now_us();
+  for (uint32_t i = 0; i < times; i++) {
+    for (size_t e = 0; e < copies.size(); e++) {
+      found[0] += find_in_bucket(buckets[slots[e]], copies[e]) != NULL;
+    }
+  }
+  uint64_t linear = time_now_us() - start;
+
+  start = time_now_us();
+  for (uint32_t i = 0; i < times; i++) {
+    for (size_t e = 0; e < names.size(); e++) {
+      found[1] += skin->getAttachment(slots[e], names[e], hashes[e]) != NULL;
+    }
+  }
+  uint64_t hashed = time_now_us() - start;
+
+  ASSERT_EQ(found[1], found[0]);
+  log_debug("lookup %u timeline keys x %u: linear %uus, interned and hashed %uus\n",
+            (uint32_t)names.size(), times, (uint32_t)linear, (uint32_t)hashed);
+
+  delete data;
+  delete atlas;
+}
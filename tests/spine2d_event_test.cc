@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include "spine2d/spine2d_event.h"
+
+TEST(spine2d_event, init) {
+  spine2d_event_t e;
+  spine2d_event_item_t items[2];
+  int target = 0;
+
+  memset(items, 0x00, sizeof(items));
+  items[0].type = SPINE2D_EVENT_START;
+  items[0].animation = "walk";
+  items[1].type = SPINE2D_EVENT_USER;
+  items[1].animation = "walk";
+  items[1].name = "footstep";
+  items[1].int_value = 3;
+
+  event_t* evt = spine2d_event_init(&e, &target, items, ARRAY_SIZE(items));
+  ASSERT_EQ(evt, (event_t*)&e);
+  ASSERT_EQ(evt->type, (uint32_t)EVT_SPINE2D_EVENTS);
+  ASSERT_EQ(evt->target, (void*)&target);
+  ASSERT_EQ(spine2d_event_cast(evt), &e);
+  ASSERT_EQ(e.nr, 2u);
+
+  ASSERT_EQ(spine2d_event_get_item(&e, 0)->type, (uint32_t)SPINE2D_EVENT_START);
+  ASSERT_STREQ(spine2d_event_get_item(&e, 1)->name, "footstep");
+  ASSERT_EQ(spine2d_event_get_item(&e, 1)->int_value, 3);
+  ASSERT_TRUE(spine2d_event_get_item(&e, 2) == NULL);
+
+  ASSERT_TRUE(spine2d_event_init(&e, &target, NULL, 0) != NULL);
+  ASSERT_EQ(e.nr, 0u);
+  ASSERT_TRUE(spine2d_event_init(&e, &target, NULL, 1) == NULL);
+}
+
+TEST(spine2d_event, cast) {
+  event_t e = event_init(EVT_USER_START, NULL);
+  ASSERT_TRUE(spine2d_event_cast(&e) == NULL);
+  ASSERT_TRUE(spine2d_event_cast(NULL) == NULL);
+}
+
+/*事件类型和 spine 的 EventType 一一对应，监听器直接转换*/
+TEST(spine2d_event, type) {
+  ASSERT_EQ((int)SPINE2D_EVENT_START, (int)spine::EventType_Start);
+  ASSERT_EQ((int)SPINE2D_EVENT_INTERRUPT, (int)spine::EventType_Interrupt);
+  ASSERT_EQ((int)SPINE2D_EVENT_END, (int)spine::EventType_End);
+  ASSERT_EQ((int)SPINE2D_EVENT_COMPLETE, (int)spine::EventType_Complete);
+  ASSERT_EQ((int)SPINE2D_EVENT_DISPOSE, (int)spine::EventType_Dispose);
+  ASSERT_EQ((int)SPINE2D_EVENT_USER, (int)spine::EventType_Event);
+}
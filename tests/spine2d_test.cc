@@ -7,3 +7,87 @@ TEST(spine2d, basic) {
 
   widget_destroy(w);
 }
+
+TEST(spine2d, track) {
+  value_t v;
+  widget_t* w = spine2d_create(NULL, 10, 20, 30, 40);
+
+  ASSERT_EQ(widget_get_prop(w, "track1.alpha", &v), RET_OK);
+  ASSERT_EQ(value_float(&v), 1.0f);
+  ASSERT_EQ(widget_get_prop(w, "track1.blend", &v), RET_OK);
+  ASSERT_STREQ(value_str(&v), "replace");
+
+  ASSERT_EQ(widget_set_prop_str(w, "track1.action", "aim"), RET_OK);
+  ASSERT_EQ(widget_set_prop_str(w, "track1.blend", "add"), RET_OK);
+  ASSERT_EQ(widget_set_prop_float(w, "track1.alpha", 0.5f), RET_OK);
+  ASSERT_EQ(widget_set_prop_float(w, "track1.mix", 0.3f), RET_OK);
+  ASSERT_STREQ(widget_get_prop_str(w, "track1.action", NULL), "aim");
+  ASSERT_STREQ(widget_get_prop_str(w, "track1.blend", NULL), "add");
+  ASSERT_EQ(widget_get_prop_float(w, "track1.alpha", 0), 0.5f);
+  ASSERT_EQ(widget_get_prop_float(w, "track1.mix", 0), 0.3f);
+
+  /*轨道 0 即 action 属性*/
+  ASSERT_EQ(spine2d_set_track_action(w, 0, "run", FALSE), RET_OK);
+  ASSERT_STREQ(SPINE2D(w)->action, "run");
+  ASSERT_EQ(SPINE2D(w)->loop, FALSE);
+  ASSERT_STREQ(widget_get_prop_str(w, "track0.action", NULL), "run");
+
+  ASSERT_EQ(spine2d_set_track_blend(w, 2, SPINE2D_BLEND_FIRST), RET_OK);
+  ASSERT_STREQ(widget_get_prop_str(w, "track2.blend", NULL), "first");
+  ASSERT_EQ(spine2d_clear_track(w, 1), RET_OK);
+  ASSERT_TRUE(widget_get_prop_str(w, "track1.action", NULL) == NULL);
+
+  ASSERT_NE(spine2d_set_track_alpha(w, SPINE2D_MAX_TRACKS, 1), RET_OK);
+  ASSERT_NE(widget_get_prop(w, "track8.alpha", &v), RET_OK);
+  ASSERT_NE(widget_get_prop(w, "track1.unknown", &v), RET_OK);
+
+  widget_destroy(w);
+}
+
+TEST(spine2d, fixed_fps) {
+  widget_t* w = spine2d_create(NULL, 10, 20, 30, 40);
+
+  ASSERT_EQ(widget_get_prop_int(w, SPINE2D_PROP_FIXED_FPS, -1), 0);
+  ASSERT_EQ(widget_get_prop_bool(w, SPINE2D_PROP_INTERPOLATE, TRUE), FALSE);
+
+  ASSERT_EQ(widget_set_prop_int(w, SPINE2D_PROP_FIXED_FPS, 30), RET_OK);
+  ASSERT_EQ(widget_set_prop_bool(w, SPINE2D_PROP_INTERPOLATE, TRUE), RET_OK);
+  ASSERT_EQ(SPINE2D(w)->fixed_fps, 30u);
+  ASSERT_EQ(SPINE2D(w)->interpolate, TRUE);
+
+  widget_destroy(w);
+}
+
+TEST(spine2d, update_fps) {
+  widget_t* w = spine2d_create(NULL, 10, 20, 30, 40);
+
+  /*跟随显示*/
+  ASSERT_EQ(widget_get_prop_int(w, SPINE2D_PROP_UPDATE_FPS, -1), 0);
+  ASSERT_EQ(widget_get_prop_int(w, SPINE2D_PROP_EFFECTIVE_FPS, 0), 62);
+
+  ASSERT_EQ(widget_set_prop_int(w, SPINE2D_PROP_UPDATE_FPS, 20), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(w, SPINE2D_PROP_EFFECTIVE_FPS, 0), 20);
+  ASSERT_EQ(spine2d_get_effective_fps(w), 20u);
+
+  /*不能超过定时器的频率*/
+  ASSERT_EQ(spine2d_set_update_fps(w, 120), RET_OK);
+  ASSERT_EQ(spine2d_get_effective_fps(w), 62u);
+
+  ASSERT_EQ(widget_set_prop_int(w, SPINE2D_PROP_PRIORITY, -3), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(w, SPINE2D_PROP_PRIORITY, 0), -3);
+  ASSERT_EQ(spine2d_set_cpu_budget(0), RET_OK);
+
+  widget_destroy(w);
+}
+
+TEST(spine2d, lazy_load) {
+  widget_t* w = spine2d_create(NULL, 10, 20, 30, 40);
+
+  ASSERT_EQ(widget_get_prop_bool(w, SPINE2D_PROP_LAZY_LOAD, TRUE), FALSE);
+  ASSERT_EQ(widget_set_prop_bool(w, SPINE2D_PROP_LAZY_LOAD, TRUE), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(w, SPINE2D_PROP_LAZY_LOAD, FALSE), TRUE);
+  ASSERT_EQ(spine2d_set_lazy_load(w, FALSE), RET_OK);
+  ASSERT_EQ(SPINE2D(w)->lazy_load, FALSE);
+
+  widget_destroy(w);
+}
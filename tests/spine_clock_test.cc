@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include "spine2d/spine_clock.h"
+
+TEST(SpineClock, variable) {
+  float delta = 0;
+  spine_clock_t clock;
+  /*运行一年以后，毫秒转秒的 float 已经无法表示 16ms 的间隔*/
+  uint64_t now = 365ull * 24 * 3600 * 1000000;
+
+  spine_clock_init(&clock, now);
+  ASSERT_EQ(spine_clock_advance(&clock, now + 16667, &delta), 1u);
+  ASSERT_NEAR(delta, 0.016667f, 1e-6);
+  ASSERT_EQ(spine_clock_get_alpha(&clock), 1.0f);
+
+  /*时间倒退时按 0 处理*/
+  ASSERT_EQ(spine_clock_advance(&clock, now, &delta), 1u);
+  ASSERT_EQ(delta, 0.0f);
+}
+
+TEST(SpineClock, fixed) {
+  float delta = 0;
+  uint32_t steps = 0;
+  uint32_t i = 0;
+  spine_clock_t clock;
+  uint64_t now = 1000;
+
+  spine_clock_init(&clock, now);
+  ASSERT_EQ(spine_clock_set_step(&clock, 1 / 30.0f, 4), RET_OK);
+
+  /*60Hz 的定时器驱动 30Hz 的模拟，平均每两次更新模拟一步*/
+  for (i = 0; i < 600; i++) {
+    now += 16667 + (i % 3) * 1000 - 1000;
+    steps += spine_clock_advance(&clock, now, &delta);
+    ASSERT_EQ(delta, 1 / 30.0f);
+    ASSERT_TRUE(spine_clock_get_alpha(&clock) >= 0 && spine_clock_get_alpha(&clock) < 1);
+  }
+  ASSERT_NEAR(steps, 300, 1);
+
+  /*挂起很久后最多追赶 max_steps 步*/
+  now += 10 * 1000000;
+  ASSERT_EQ(spine_clock_advance(&clock, now, &delta), 4u);
+  ASSERT_TRUE(spine_clock_get_alpha(&clock) < 1);
+  now += 20000;
+  ASSERT_TRUE(spine_clock_advance(&clock, now, &delta) <= 1);
+
+  ASSERT_EQ(spine_clock_set_step(&clock, 0, 0), RET_OK);
+  ASSERT_EQ(clock.max_steps, 1u);
+  ASSERT_EQ(spine_clock_advance(&clock, now + 5000, &delta), 1u);
+  ASSERT_NEAR(delta, 0.005f, 1e-6);
+}
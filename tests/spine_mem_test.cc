@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include "spine2d/spine_mem.h"
+
+using namespace spine;
+
+TEST(SpineMem, alloc) {
+  spine_mem_stat_t stat;
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_NOT_FOUND);
+  ASSERT_EQ(stat.live_bytes, 0u);
+
+  ASSERT_EQ(spine_mem_init(), RET_OK);
+  ASSERT_TRUE(spine_mem_is_installed());
+
+  /*小对象来自对象池，同一级内原地伸缩*/
+  char* a = SpineExtension::alloc<char>(20, __FILE__, __LINE__);
+  int* b = SpineExtension::calloc<int>(4, __FILE__, __LINE__);
+  ASSERT_EQ((uintptr_t)a % 8, 0u);
+  ASSERT_EQ(b[0] | b[1] | b[2] | b[3], 0);
+  memcpy(a, "spine", 6);
+  ASSERT_TRUE(SpineExtension::realloc<char>(a, 32, __FILE__, __LINE__) == a);
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  ASSERT_EQ(stat.live_bytes, 48u);
+  ASSERT_EQ(stat.live_count, 2u);
+  ASSERT_EQ(stat.total_allocs, 3u);
+  ASSERT_EQ(stat.pool_bytes, 8192u);
+
+  /*跨级和超过对象池的大小时搬移，内容保持不变*/
+  a = SpineExtension::realloc<char>(a, 100, __FILE__, __LINE__);
+  ASSERT_STREQ(a, "spine");
+  a = SpineExtension::realloc<char>(a, 1000, __FILE__, __LINE__);
+  ASSERT_STREQ(a, "spine");
+  a = SpineExtension::realloc<char>(a, 5000, __FILE__, __LINE__);
+  ASSERT_STREQ(a, "spine");
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  ASSERT_EQ(stat.live_bytes, 5016u);
+  ASSERT_EQ(stat.peak_bytes, 5016u);
+  ASSERT_EQ(stat.live_count, 2u);
+
+  a = SpineExtension::realloc<char>(a, 10, __FILE__, __LINE__);
+  ASSERT_EQ(memcmp(a, "spine", 6), 0);
+  ASSERT_EQ(spine_mem_reset_peak(), RET_OK);
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  ASSERT_EQ(stat.peak_bytes, 26u);
+
+  /*释放的对象回到对象池，再次分配时复用*/
+  SpineExtension::free(b, __FILE__, __LINE__);
+  ASSERT_TRUE(SpineExtension::alloc<int>(3, __FILE__, __LINE__) == b);
+
+  /*还有未释放的内存时不能卸载*/
+  ASSERT_EQ(spine_mem_deinit(), RET_BUSY);
+  ASSERT_TRUE(spine_mem_is_installed());
+  SpineExtension::free(a, __FILE__, __LINE__);
+  SpineExtension::free(b, __FILE__, __LINE__);
+
+  ASSERT_EQ(spine_mem_end_frame(), RET_OK);
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  ASSERT_EQ(stat.frame_allocs, 8u);
+  ASSERT_EQ(stat.live_bytes, 0u);
+  ASSERT_EQ(stat.live_count, 0u);
+
+  ASSERT_EQ(spine_mem_deinit(), RET_OK);
+  ASSERT_FALSE(spine_mem_is_installed());
+}
+
+TEST(SpineMem, skeleton) {
+  spine_mem_stat_t stat;
+  ASSERT_EQ(spine_mem_init(), RET_OK);
+
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  uint64_t loaded = stat.live_bytes;
+  log_debug("load %s: %u bytes, %u allocations, %u pool bytes\n", SPINE_TEST_SKEL,
+            (uint32_t)stat.live_bytes, stat.live_count, (uint32_t)stat.pool_bytes);
+
+  {
+    AnimationStateData state_data(data);
+    AnimationState state(&state_data);
+    Skeleton skeleton(data);
+    state.setAnimation(0, "run", true);
+    state.addAnimation(0, "jump", false, 0.5f);
+    state.addAnimation(0, "walk", true, 0);
+
+    uint32_t max_frame_allocs = 0;
+    spine_mem_end_frame();
+    for (int frame = 0; frame < 120; frame++) {
+      state.update(1 / 30.0f);
+      state.apply(skeleton);
+      skeleton.updateWorldTransform(Physics_Update);
+      spine_mem_end_frame();
+      spine_mem_get_stat(&stat);
+      if (frame >= 60) {
+        max_frame_allocs = tk_max(max_frame_allocs, stat.frame_allocs);
+      }
+    }
+
+    /*动画切换完成后的稳定状态每帧不应该再分配内存*/
+    ASSERT_EQ(max_frame_allocs, 0u);
+    ASSERT_TRUE(stat.live_bytes > loaded);
+    ASSERT_TRUE(stat.peak_bytes >= stat.live_bytes);
+  }
+
+  delete data;
+  delete atlas;
+
+  ASSERT_EQ(spine_mem_get_stat(&stat), RET_OK);
+  ASSERT_EQ(stat.live_count, 0u);
+  ASSERT_EQ(stat.live_bytes, 0u);
+  ASSERT_EQ(spine_mem_deinit(), RET_OK);
+}
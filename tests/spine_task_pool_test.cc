@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include "spine2d/spine_task_pool.h"
+
+using namespace spine;
+
+typedef struct _counter_task_t {
+  uint32_t value;
+  uint32_t times;
+} counter_task_t;
+
+static ret_t counter_task(void* ctx) {
+  counter_task_t* task = (counter_task_t*)ctx;
+  uint32_t i = 0;
+
+  /*让任务耗时不均，触发窃取*/
+  for (i = 0; i < (task->value % 7) * 1000; i++) {
+    task->times += 0;
+  }
+  task->times++;
+
+  return RET_OK;
+}
+
+TEST(SpineTaskPool, run) {
+  counter_task_t tasks[1000];
+  void* ctxs[1000];
+  uint32_t threads[] = {1, 2, 4, 7};
+
+  for (uint32_t t = 0; t < ARRAY_SIZE(threads); t++) {
+    spine_task_pool_t* pool = spine_task_pool_create(threads[t]);
+    ASSERT_TRUE(pool != NULL);
+    ASSERT_EQ(spine_task_pool_get_threads(pool), threads[t]);
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(tasks); i++) {
+      tasks[i].value = i;
+      tasks[i].times = 0;
+      ctxs[i] = tasks + i;
+    }
+
+    for (uint32_t n = 0; n < 10; n++) {
+      ASSERT_EQ(spine_task_pool_run(pool, counter_task, ctxs, ARRAY_SIZE(tasks)), RET_OK);
+    }
+    ASSERT_EQ(spine_task_pool_run(pool, counter_task, ctxs, 0), RET_OK);
+    ASSERT_EQ(spine_task_pool_run(pool, counter_task, ctxs, 1), RET_OK);
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(tasks); i++) {
+      ASSERT_EQ(tasks[i].times, i == 0 ? 11u : 10u);
+    }
+
+    ASSERT_EQ(spine_task_pool_destroy(pool), RET_OK);
+  }
+}
+
+typedef struct _skeleton_task_t {
+  Skeleton* skeleton;
+  AnimationState* state;
+} skeleton_task_t;
+
+static ret_t skeleton_task(void* ctx) {
+  skeleton_task_t* task = (skeleton_task_t*)ctx;
+
+  task->state->update(1 / 60.0f);
+  task->state->apply(*(task->skeleton));
+  task->skeleton->update(1 / 60.0f);
+  task->skeleton->updateWorldTransform(Physics_Update);
+
+  return RET_OK;
+}
+
+TEST(SpineTaskPool, skeleton) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  const uint32_t nr = 16;
+  skeleton_task_t serial[nr];
+  skeleton_task_t parallel[nr];
+  void* ctxs[nr];
+  AnimationStateData state_data(data);
+  Vector<Animation*>& animations = data->getAnimations();
+  spine_task_pool_t* pool = spine_task_pool_create(4);
+  ASSERT_TRUE(pool != NULL);
+
+  for (uint32_t i = 0; i < nr; i++) {
+    const String& name = animations[i % animations.size()]->getName();
+    serial[i].skeleton = new Skeleton(data);
+    serial[i].state = new AnimationState(&state_data);
+    serial[i].state->setAnimation(0, name, true);
+    parallel[i].skeleton = new Skeleton(data);
+    parallel[i].state = new AnimationState(&state_data);
+    parallel[i].state->setAnimation(0, name, true);
+    ctxs[i] = parallel + i;
+  }
+
+  for (uint32_t frame = 0; frame < 60; frame++) {
+    for (uint32_t i = 0; i < nr; i++) {
+      skeleton_task(serial + i);
+    }
+    ASSERT_EQ(spine_task_pool_run(pool, skeleton_task, ctxs, nr), RET_OK);
+  }
+
+  for (uint32_t i = 0; i < nr; i++) {
+    Vector<Bone*>& a = serial[i].skeleton->getBones();
+    Vector<Bone*>& b = parallel[i].skeleton->getBones();
+    for (size_t j = 0; j < a.size(); j++) {
+      ASSERT_EQ(a[j]->getWorldX(), b[j]->getWorldX());
+      ASSERT_EQ(a[j]->getWorldY(), b[j]->getWorldY());
+    }
+    delete serial[i].state;
+    delete serial[i].skeleton;
+    delete parallel[i].state;
+    delete parallel[i].skeleton;
+  }
+
+  spine_task_pool_destroy(pool);
+  delete data;
+  delete atlas;
+}
@@ -0,0 +1,71 @@
+/**
+ * File:   spine_test_helper.h
+ * Author: AWTK Develop Team
+ * Brief:  spine 运行时测试的辅助函数。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+#ifndef TK_SPINE_TEST_HELPER_H
+#define TK_SPINE_TEST_HELPER_H
+
+#include "awtk.h"
+#include <spine/spine.h>
+
+#define SPINE_TEST_ATLAS "spineboy-pma.atlas"
+#define SPINE_TEST_SKEL "spineboy-pro.skel"
+#define SPINE_TEST_JSON "spineboy-pro.json"
+
+/*测试不需要纹理，只记录一个非空的占位。*/
+class NullTextureLoader : public spine::TextureLoader {
+ public:
+  void load(spine::AtlasPage& page, const spine::String& path) {
+    page.texture = (void*)1;
+  }
+  void unload(void* texture) {
+  }
+};
+
+static inline spine::Atlas* spine_test_load_atlas(void) {
+  static NullTextureLoader s_texture_loader;
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, SPINE_TEST_ATLAS);
+  return_value_if_fail(info != NULL, NULL);
+
+  spine::Atlas* atlas =
+      new spine::Atlas((const char*)info->data, info->size, "", &s_texture_loader);
+  asset_info_unref(info);
+
+  return atlas;
+}
+
+static inline spine::SkeletonData* spine_test_load_skeleton_data(spine::Atlas* atlas,
+                                                                 bool_t binary,
+                                                                 bool_t compact_curves = FALSE) {
+  spine::SkeletonData* data = NULL;
+  const char* name = binary ? SPINE_TEST_SKEL : SPINE_TEST_JSON;
+  asset_info_t* info = assets_manager_load(assets_manager(), ASSET_TYPE_DATA, name);
+  return_value_if_fail(info != NULL, NULL);
+
+  if (binary) {
+    spine::SkeletonBinary reader(atlas);
+    reader.setCompactCurves(compact_curves);
+    data = reader.readSkeletonData(info->data, info->size);
+  } else {
+    spine::SkeletonJson reader(atlas);
+    reader.setCompactCurves(compact_curves);
+    char* json = tk_strndup((const char*)info->data, info->size);
+    data = reader.readSkeletonData(json);
+    TKMEM_FREE(json);
+  }
+  asset_info_unref(info);
+
+  return data;
+}
+
+#endif /*TK_SPINE_TEST_HELPER_H*/
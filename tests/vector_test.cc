@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+#include <math.h>
+
+using namespace spine;
+
+/*不能按字节拷贝的 float，走逐个构造和析构的通用路径*/
+class GenericFloat {
+ public:
+  GenericFloat(float value = 0) : value(value) {
+    s_alive++;
+  }
+  GenericFloat(const GenericFloat& other) : value(other.value) {
+    s_alive++;
+  }
+  ~GenericFloat() {
+    s_alive--;
+  }
+  GenericFloat& operator=(const GenericFloat& other) {
+    value = other.value;
+    return *this;
+  }
+
+  float value;
+  static int s_alive;
+};
+
+int GenericFloat::s_alive = 0;
+
+static float value_of(float value) {
+  return value;
+}
+
+static float value_of(const GenericFloat& value) {
+  return value.value;
+}
+
+TEST(Vector, trivial) {
+  Vector<float> a;
+  a.setSize(5, 0);
+  a.setSize(10, 1.5f);
+  ASSERT_EQ(a[4], 0.0f);
+  ASSERT_EQ(a[5], 1.5f);
+  ASSERT_EQ(a[9], 1.5f);
+
+  /*负零不是全零字节*/
+  a.setSize(12, -0.0f);
+  ASSERT_TRUE(signbit(a[11]));
+
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = (float)i;
+  }
+  a.removeAt(3);
+  ASSERT_EQ(a.size(), 11u);
+  ASSERT_EQ(a[2], 2.0f);
+  ASSERT_EQ(a[3], 4.0f);
+  ASSERT_EQ(a[10], 11.0f);
+  a.removeAt(10);
+  ASSERT_EQ(a[9], 10.0f);
+
+  /*加入自己*/
+  a.addAll(a);
+  ASSERT_EQ(a.size(), 20u);
+  ASSERT_EQ(a[10], 0.0f);
+  ASSERT_EQ(a[19], 10.0f);
+
+  Vector<float> b(a);
+  ASSERT_TRUE(b == a);
+  Vector<float> empty;
+  b.addAll(empty);
+  ASSERT_EQ(b.size(), 20u);
+  b.clear();
+  ASSERT_EQ(b.size(), 0u);
+
+  Vector<BoneWorld> worlds;
+  worlds.setSize(3, BoneWorld());
+  ASSERT_EQ(worlds[2].a, 1.0f);
+  ASSERT_EQ(worlds[2].d, 1.0f);
+}
+
+TEST(Vector, generic) {
+  {
+    Vector<GenericFloat> a;
+    a.setSize(10, GenericFloat(1.5f));
+    ASSERT_EQ(GenericFloat::s_alive, 10);
+    a.addAll(a);
+    ASSERT_EQ(GenericFloat::s_alive, 20);
+    ASSERT_EQ(a[19].value, 1.5f);
+    a.removeAt(0);
+    ASSERT_EQ(GenericFloat::s_alive, 19);
+
+    Vector<GenericFloat> b(a);
+    ASSERT_EQ(GenericFloat::s_alive, 38);
+    b.clear();
+    ASSERT_EQ(GenericFloat::s_alive, 19);
+  }
+  ASSERT_EQ(GenericFloat::s_alive, 0);
+}
+
+template <typename T>
+static uint64_t bench_set_size(uint32_t times) {
+  Vector<T> v;
+  float sum = 0;
+  uint64_t start = time_now_us();
+  for (uint32_t i = 0; i < times; i++) {
+    /*SkeletonRenderer 每个插槽设置一次顶点数组的大小*/
+    v.clear();
+    v.setSize(8 + i % 200, T(0));
+    sum += value_of(v[v.size() - 1]);
+  }
+  EXPECT_EQ(sum, 0.0f);
+  return time_now_us() - start;
+}
+
+template <typename T>
+static uint64_t bench_add_all(uint32_t times) {
+  Vector<T> src;
+  Vector<T> dst;
+  src.setSize(300, T(1));
+  uint64_t start = time_now_us();
+  for (uint32_t i = 0; i < times; i++) {
+    dst.clear();
+    dst.addAll(src);
+    dst.addAll(src);
+  }
+  EXPECT_EQ(dst.size(), 600u);
+  return time_now_us() - start;
+}
+
+template <typename T>
+static uint64_t bench_copy(uint32_t times) {
+  Vector<T> src;
+  size_t size = 0;
+  src.setSize(300, T(1));
+  uint64_t start = time_now_us();
+  for (uint32_t i = 0; i < times; i++) {
+    Vector<T> copy(src);
+    size += copy.size();
+  }
+  EXPECT_EQ(size, (size_t)times * 300);
+  return time_now_us() - start;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(Vector, DISABLED_benchmark) {
+  uint32_t times = 100000;
+  log_debug("Vector setSize x %u: float %uus, generic %uus\n", times,
+            (uint32_t)bench_set_size<float>(times), (uint32_t)bench_set_size<GenericFloat>(times));
+  log_debug("Vector addAll x %u: float %uus, generic %uus\n", times,
+            (uint32_t)bench_add_all<float>(times), (uint32_t)bench_add_all<GenericFloat>(times));
+  log_debug("Vector copy x %u: float %uus, generic %uus\n", times,
+            (uint32_t)bench_copy<float>(times), (uint32_t)bench_copy<GenericFloat>(times));
+}
@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include "spine_test_helper.h"
+
+using namespace spine;
+
+static void compute_reference(VertexAttachment* attachment, Slot& slot, float* out) {
+  Vector<int>& bones = attachment->getBones();
+  Vector<float>& vertices = attachment->getVertices();
+  Vector<float>& deform = slot.getDeform();
+  Vector<Bone*>& skeletonBones = slot.getBone().getSkeleton().getBones();
+
+  for (size_t v = 0, b = 0, f = 0, w = 0; v < bones.size(); w += 2) {
+    float wx = 0, wy = 0;
+    int n = bones[v++];
+    for (int i = 0; i < n; i++, v++, b += 3, f += 2) {
+      Bone* bone = skeletonBones[bones[v]];
+      float vx = vertices[b] + (deform.size() > 0 ? deform[f] : 0);
+      float vy = vertices[b + 1] + (deform.size() > 0 ? deform[f + 1] : 0);
+      wx += (vx * bone->getA() + vy * bone->getB() + bone->getWorldX()) * vertices[b + 2];
+      wy += (vx * bone->getC() + vy * bone->getD() + bone->getWorldY()) * vertices[b + 2];
+    }
+    out[w] = wx;
+    out[w + 1] = wy;
+  }
+}
+
+static void collect_meshes(Skeleton* skeleton, Vector<MeshAttachment*>& meshes,
+                           Vector<Slot*>& slots) {
+  Skin::AttachmentMap::Entries entries = skeleton->getData()->getDefaultSkin()->getAttachments();
+  while (entries.hasNext()) {
+    Skin::AttachmentMap::Entry& entry = entries.next();
+    if (entry._attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+      meshes.add((MeshAttachment*)entry._attachment);
+      slots.add(skeleton->getSlots()[entry._slotIndex]);
+    }
+  }
+}
+
+TEST(VertexTransform, transform) {
+  float points[2 * 37];
+  float simd[2 * 37];
+  float scalar[2 * 37];
+
+  for (int i = 0; i < 2 * 37; i++) {
+    points[i] = (float)((i * 7919) % 1000) / 10.0f - 50.0f;
+  }
+
+  VertexTransform::setSimdEnabled(true);
+  VertexTransform::transform(points, 37, 0.5f, -0.8f, 0.8f, 0.5f, 10, 20, simd);
+  VertexTransform::setSimdEnabled(false);
+  VertexTransform::transform(points, 37, 0.5f, -0.8f, 0.8f, 0.5f, 10, 20, scalar);
+  VertexTransform::setSimdEnabled(true);
+
+  for (int i = 0; i < 37; i++) {
+    ASSERT_FLOAT_EQ(scalar[2 * i], points[2 * i] * 0.5f - points[2 * i + 1] * 0.8f + 10);
+    ASSERT_FLOAT_EQ(scalar[2 * i + 1], points[2 * i] * 0.8f + points[2 * i + 1] * 0.5f + 20);
+    ASSERT_FLOAT_EQ(simd[2 * i], scalar[2 * i]);
+    ASSERT_FLOAT_EQ(simd[2 * i + 1], scalar[2 * i + 1]);
+  }
+}
+
+TEST(VertexTransform, weighted) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton skeleton(data);
+  AnimationStateData state_data(data);
+  AnimationState state(&state_data);
+  Vector<MeshAttachment*> meshes;
+  Vector<Slot*> slots;
+  Vector<float> world;
+  Vector<float> expected;
+  uint32_t weighted = 0;
+
+  collect_meshes(&skeleton, meshes, slots);
+  ASSERT_TRUE(meshes.size() > 0);
+
+  state.setAnimation(0, "run", true);
+  for (int frame = 0; frame < 10; frame++) {
+    state.update(0.05f);
+    state.apply(skeleton);
+    skeleton.updateWorldTransform(Physics_Update);
+
+    for (size_t i = 0; i < meshes.size(); i++) {
+      MeshAttachment* mesh = meshes[i];
+      size_t length = mesh->getWorldVerticesLength();
+      if (mesh->getBones().size() == 0) continue;
+      weighted++;
+
+      ASSERT_TRUE(mesh->getWeightLayout().isValid(mesh->getVertices().size()));
+      world.setSize(length, 0);
+      expected.setSize(length, 0);
+      mesh->computeWorldVertices(*slots[i], 0, length, world.buffer(), 0, 2);
+      compute_reference(mesh, *slots[i], expected.buffer());
+      for (size_t j = 0; j < length; j++) {
+        ASSERT_NEAR(world[j], expected[j], 0.001f);
+      }
+    }
+  }
+  ASSERT_TRUE(weighted > 0);
+
+  delete data;
+  delete atlas;
+}
+
+/*计时对比，默认不运行，需要时加 --gtest_also_run_disabled_tests*/
+TEST(VertexTransform, DISABLED_bench) {
+  Atlas* atlas = spine_test_load_atlas();
+  SkeletonData* data = spine_test_load_skeleton_data(atlas, TRUE);
+  ASSERT_TRUE(data != NULL);
+
+  Skeleton skeleton(data);
+  Vector<MeshAttachment*> meshes;
+  Vector<Slot*> slots;
+  Vector<float> world;
+  uint64_t cost[2] = {0, 0};
+  uint32_t times = 2000;
+
+  collect_meshes(&skeleton, meshes, slots);
+  skeleton.updateWorldTransform(Physics_Update);
+  world.setSize(4096, 0);
+
+  for (int simd = 0; simd < 2; simd++) {
+    uint64_t start = time_now_us();
+    VertexTransform::setSimdEnabled(simd != 0);
+    for (uint32_t n = 0; n < times; n++) {
+      for (size_t i = 0; i < meshes.size(); i++) {
+        MeshAttachment* mesh = meshes[i];
+        mesh->computeWorldVertices(*slots[i], 0, mesh->getWorldVerticesLength(), world.buffer(), 0,
+                                   2);
+      }
+    }
+    cost[simd] = time_now_us() - start;
+  }
+  VertexTransform::setSimdEnabled(true);
+
+  log_debug("computeWorldVertices x %u on %d meshes: scalar %uus %s %uus\n", times,
+            (int)meshes.size(), (uint32_t)cost[0], VertexTransform::getSimdName(),
+            (uint32_t)cost[1]);
+
+  delete data;
+  delete atlas;
+}
@@ -0,0 +1,298 @@
+/**
+ * File:   spine2d_compile.cpp
+ * Author: AWTK Develop Team
+ * Brief:  把 spine 的资源转换成运行时直接加载的二进制格式。
+ *
+ * Copyright (c) 2025 - 2025 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <spine/spine.h>
+#include "spine2d/spine_texture.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "spine2d/stb_image.h"
+
+using namespace spine;
+
+typedef struct _compile_options_t {
+  const char* animations;
+  const char* skins;
+  bool raw_texture;
+} compile_options_t;
+
+static bool write_file(const char* filename, Vector<unsigned char>& data) {
+  FILE* fp = fopen(filename, "wb");
+  if (fp == NULL) {
+    printf("can not open %s\n", filename);
+    return false;
+  }
+
+  bool ret = fwrite(data.buffer(), 1, data.size(), fp) == data.size();
+  fclose(fp);
+
+  return ret;
+}
+
+static bool read_file(const char* filename, Vector<unsigned char>& data) {
+  FILE* fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    printf("can not open %s\n", filename);
+    return false;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  data.setSize(size > 0 ? size : 0, 0);
+  bool ret = size > 0 && fread(data.buffer(), 1, size, fp) == (size_t)size;
+  fclose(fp);
+
+  return ret;
+}
+
+static const char* file_name(const char* path) {
+  const char* name = path;
+  for (const char* p = path; *p; p++) {
+    if (*p == '/' || *p == '\\') {
+      name = p + 1;
+    }
+  }
+
+  return name;
+}
+
+static String join_path(const char* dir, const char* name) {
+  String path(dir);
+  size_t len = strlen(dir);
+  if (len > 0 && dir[len - 1] != '/' && dir[len - 1] != '\\') {
+    path.append("/");
+  }
+  path.append(name);
+
+  return path;
+}
+
+/*逗号分隔的名字列表中是否有 name，列表为空时表示全部保留。*/
+static bool name_in_list(const char* list, const String& name) {
+  if (list == NULL || *list == '\0') {
+    return true;
+  }
+
+  size_t len = name.length();
+  for (const char* p = list; *p;) {
+    const char* end = strchr(p, ',');
+    size_t n = end != NULL ? (size_t)(end - p) : strlen(p);
+    if (n == len && strncmp(p, name.buffer(), n) == 0) {
+      return true;
+    }
+    p += n + (end != NULL ? 1 : 0);
+  }
+
+  return false;
+}
+
+/*文本图集转换成二进制图集，运行时根据文件头识别格式，文件名可以保持不变。*/
+static bool compile_atlas(const char* input, const char* output) {
+  Atlas atlas(input, NULL, false);
+  if (atlas.getPages().size() == 0) {
+    printf("invalid atlas %s\n", input);
+    return false;
+  }
+
+  Vector<unsigned char> data;
+  atlas.writeBinary(data);
+  printf("%s => %s: %u pages, %u regions, %u bytes\n", input, output,
+         (unsigned int)atlas.getPages().size(), (unsigned int)atlas.getRegions().size(),
+         (unsigned int)data.size());
+
+  return write_file(output, data);
+}
+
+/*纹理解码成像素保存，运行时根据文件头识别格式，文件名保持图集中的名字。*/
+static bool compile_texture(const char* input, const char* output, bool raw) {
+  spine_texture_t texture;
+  Vector<unsigned char> data;
+  if (!read_file(input, data)) {
+    return false;
+  }
+
+  /*已经解码过的纹理原样保存*/
+  if (!raw || spine_texture_parse(&texture, data.buffer(), data.size()) == RET_OK) {
+    return write_file(output, data);
+  }
+
+  int w = 0, h = 0, channels = 0;
+  unsigned char* pixels =
+      stbi_load_from_memory(data.buffer(), (int)data.size(), &w, &h, &channels, 0);
+  if (pixels == NULL) {
+    printf("can not decode %s\n", input);
+    return false;
+  }
+
+  size_t size = (size_t)w * h * channels;
+  data.setSize(SPINE_TEXTURE_HEADER_SIZE + size, 0);
+  spine_texture_write_header(data.buffer(), w, h, channels);
+  memcpy(data.buffer() + SPINE_TEXTURE_HEADER_SIZE, pixels, size);
+  stbi_image_free(pixels);
+  printf("%s => %s: %dx%d, %d channels, %u bytes\n", input, output, w, h, channels,
+         (unsigned int)data.size());
+
+  return write_file(output, data);
+}
+
+static SkeletonData* load_skeleton(Atlas* atlas, const char* input) {
+  SkeletonData* data = NULL;
+  size_t len = strlen(input);
+
+  /*曲线以控制点读取，才能原样写出*/
+  if (len > 5 && strcmp(input + len - 5, ".json") == 0) {
+    SkeletonJson json(atlas);
+    json.setCompactCurves(true);
+    data = json.readSkeletonDataFile(input);
+    if (data == NULL) {
+      printf("invalid skeleton %s: %s\n", input, json.getError().buffer());
+    }
+  } else {
+    SkeletonBinary binary(atlas);
+    binary.setCompactCurves(true);
+    data = binary.readSkeletonDataFile(input);
+    if (data == NULL) {
+      printf("invalid skeleton %s: %s\n", input, binary.getError().buffer());
+    }
+  }
+
+  return data;
+}
+
+/*去掉不需要的动画和皮肤后写出，写完放回去由骨架数据释放。默认皮肤总是保留。*/
+static bool compile_skeleton(SkeletonData* data, const char* output,
+                             const compile_options_t* options) {
+  Vector<Animation*> animations;
+  Vector<Skin*> skins;
+  animations.addAll(data->getAnimations());
+  skins.addAll(data->getSkins());
+
+  data->getAnimations().clear();
+  for (size_t i = 0; i < animations.size(); i++) {
+    if (name_in_list(options->animations, animations[i]->getName())) {
+      data->getAnimations().add(animations[i]);
+    }
+  }
+
+  data->getSkins().clear();
+  for (size_t i = 0; i < skins.size(); i++) {
+    if (skins[i] == data->getDefaultSkin() || name_in_list(options->skins, skins[i]->getName())) {
+      data->getSkins().add(skins[i]);
+    }
+  }
+
+  Vector<unsigned char> binary;
+  SkeletonBinary writer((Atlas*)NULL);
+  bool ret = writer.writeSkeletonData(data, binary);
+  printf("skeleton => %s: %u/%u animations, %u/%u skins, %u bytes\n", output,
+         (unsigned int)data->getAnimations().size(), (unsigned int)animations.size(),
+         (unsigned int)data->getSkins().size(), (unsigned int)skins.size(),
+         (unsigned int)binary.size());
+
+  data->getAnimations().clear();
+  data->getAnimations().addAll(animations);
+  data->getSkins().clear();
+  data->getSkins().addAll(skins);
+
+  if (!ret) {
+    printf("can not write %s: %s\n", output, writer.getError().buffer());
+    return false;
+  }
+
+  return write_file(output, binary);
+}
+
+/*骨架、图集和纹理一起转换到输出目录，文件名不变(JSON 骨架换成 .skel)。*/
+static bool compile_bundle(const char* skeleton, const char* atlas_file, const char* output_dir,
+                           const compile_options_t* options) {
+  Atlas atlas(atlas_file, NULL, false);
+  if (atlas.getPages().size() == 0) {
+    printf("invalid atlas %s\n", atlas_file);
+    return false;
+  }
+
+  SkeletonData* data = load_skeleton(&atlas, skeleton);
+  if (data == NULL) {
+    return false;
+  }
+
+  char skel[256];
+  const char* name = file_name(skeleton);
+  const char* dot = strrchr(name, '.');
+  snprintf(skel, sizeof(skel), "%.*s.skel", dot != NULL ? (int)(dot - name) : (int)strlen(name), name);
+
+  bool ret = compile_skeleton(data, join_path(output_dir, skel).buffer(), options);
+  delete data;
+
+  ret = ret && compile_atlas(atlas_file, join_path(output_dir, file_name(atlas_file)).buffer());
+  for (size_t i = 0; ret && i < atlas.getPages().size(); i++) {
+    AtlasPage* page = atlas.getPages()[i];
+    ret = compile_texture(page->texturePath.buffer(),
+                          join_path(output_dir, page->name.buffer()).buffer(),
+                          options->raw_texture);
+  }
+
+  return ret;
+}
+
+static void show_usage(const char* name) {
+  printf("Usage: %s input.atlas output.atlas\n", name);
+  printf("       %s [options] skeleton.(json|skel) input.atlas output_dir\n", name);
+  printf("Options:\n");
+  printf("  --animations=a,b  keep only the specified animations\n");
+  printf("  --skins=a,b       keep only the specified skins (and the default skin)\n");
+  printf("  --texture=copy    copy textures unchanged (default)\n");
+  printf("  --texture=raw     save textures decoded to pixels\n");
+}
+
+int main(int argc, char* argv[]) {
+  const char* args[3];
+  int nr = 0;
+  compile_options_t options = {NULL, NULL, false};
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    if (strncmp(arg, "--animations=", 13) == 0) {
+      options.animations = arg + 13;
+    } else if (strncmp(arg, "--skins=", 8) == 0) {
+      options.skins = arg + 8;
+    } else if (strcmp(arg, "--texture=raw") == 0) {
+      options.raw_texture = true;
+    } else if (strcmp(arg, "--texture=copy") == 0) {
+      options.raw_texture = false;
+    } else if (strncmp(arg, "--", 2) != 0 && nr < 3) {
+      args[nr++] = arg;
+    } else {
+      show_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (nr == 2) {
+    return compile_atlas(args[0], args[1]) ? 0 : 1;
+  } else if (nr == 3) {
+    return compile_bundle(args[0], args[1], args[2], &options) ? 0 : 1;
+  }
+
+  show_usage(argv[0]);
+  return 1;
+}